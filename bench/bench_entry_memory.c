@@ -0,0 +1,85 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : bench/bench_entry_memory.c
+ * Module                    : Entry Memory Benchmark
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Measures heap bytes per string key for several value sizes. Run it
+ *  with and without value embedding to see the saving per key:
+ *
+ *    make run-bench EMBED_MAX=0
+ *    make run-bench
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include "../src/utils/hashTable.h"
+
+#define DEFAULT_KEYS 200000
+#define KEY_LEN 32
+
+static size_t heap_in_use(void) {
+    struct mallinfo2 mi = mallinfo2();
+    return mi.uordblks;
+}
+
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : DEFAULT_KEYS;
+    if (n <= 0) n = DEFAULT_KEYS;
+
+    static const size_t value_sizes[] = { 8, 16, 32, 64, 128, 512 };
+    char key[KEY_LEN];
+
+    hashtable_lock_init();
+
+    printf("=== Entry Memory Benchmark (index=%s, embed_max=%d, keys=%d) ===\n",
+           KEYSPACE_INDEX_NAME, ENTRY_EMBED_MAX, n);
+    printf("  %-10s %12s %12s %12s\n", "value", "bytes/key", "payload", "overhead");
+
+    //-- Grow the index once up front so its slot arrays are not charged to any row --//
+    for (int i = 0; i < n; i++) {
+        snprintf(key, sizeof(key), "session:%08d", i);
+        set_value(key, "", 0);
+    }
+    for (int i = 0; i < n; i++) {
+        snprintf(key, sizeof(key), "session:%08d", i);
+        delete_key(key);
+    }
+
+    for (size_t v = 0; v < sizeof(value_sizes) / sizeof(value_sizes[0]); v++) {
+        size_t vlen = value_sizes[v];
+        char *value = malloc(vlen + 1);
+        memset(value, 'v', vlen);
+        value[vlen] = '\0';
+
+        size_t before = heap_in_use();
+        for (int i = 0; i < n; i++) {
+            snprintf(key, sizeof(key), "session:%08d", i);
+            set_value(key, value, 0);
+        }
+        size_t after = heap_in_use();
+
+        double per_key = (double)(after - before) / n;
+        size_t payload = strlen("session:00000000") + 1 + vlen + 1;
+        printf("  %-10zu %12.1f %12zu %12.1f\n", vlen, per_key, payload, per_key - (double)payload);
+
+        for (int i = 0; i < n; i++) {
+            snprintf(key, sizeof(key), "session:%08d", i);
+            delete_key(key);
+        }
+        free(value);
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : bench/bench_hotkey_read.c
+ * Module                    : Hot-Key Read Scaling Benchmark
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Runs 1..N reader threads that GET the same key for a fixed time and
+ *  reports aggregate throughput, showing how well concurrent readers of
+ *  one bucket scale.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "../src/utils/hashTable.h"
+
+#define RUN_MS 300
+#define MAX_THREADS 64
+
+static volatile int running;
+static pthread_barrier_t start_barrier;
+
+typedef struct {
+    unsigned long long ops;
+    char pad[56];   //- keep per-thread counters on separate cache lines -//
+} ThreadResult;
+
+static ThreadResult results[MAX_THREADS];
+
+static void *reader(void *arg) {
+    ThreadResult *r = arg;
+    unsigned long long ops = 0;
+    pthread_barrier_wait(&start_barrier);
+    while (__atomic_load_n(&running, __ATOMIC_RELAXED)) {
+        if (get_value("hot:key")) ops++;
+    }
+    r->ops = ops;
+    return NULL;
+}
+
+static double run(int threads) {
+    pthread_t tids[MAX_THREADS];
+    pthread_barrier_init(&start_barrier, NULL, threads + 1);
+    __atomic_store_n(&running, 1, __ATOMIC_RELAXED);
+
+    for (int i = 0; i < threads; i++) {
+        results[i].ops = 0;
+        pthread_create(&tids[i], NULL, reader, &results[i]);
+    }
+    pthread_barrier_wait(&start_barrier);
+    usleep(RUN_MS * 1000);
+    __atomic_store_n(&running, 0, __ATOMIC_RELAXED);
+
+    unsigned long long total = 0;
+    for (int i = 0; i < threads; i++) {
+        pthread_join(tids[i], NULL);
+        total += results[i].ops;
+    }
+    pthread_barrier_destroy(&start_barrier);
+    return (double)total * 1000.0 / RUN_MS;
+}
+
+int main(int argc, char *argv[]) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int max_threads = argc > 1 ? atoi(argv[1]) : (int)(cpus < 16 ? cpus : 16);
+    if (max_threads < 1) max_threads = 1;
+    if (max_threads > MAX_THREADS) max_threads = MAX_THREADS;
+
+    hashtable_lock_init();
+    set_value("hot:key", "session-payload", 0);
+
+    printf("=== Hot-Key GET Scaling Benchmark (index=%s, cpus=%ld) ===\n", KEYSPACE_INDEX_NAME, cpus);
+    printf("  %-8s %14s %10s\n", "threads", "GET/s", "speedup");
+
+    double base = 0;
+    for (int t = 1; t <= max_threads; t *= 2) {
+        double rate = run(t);
+        if (t == 1) base = rate;
+        printf("  %-8d %14.0f %9.2fx\n", t, rate, rate / base);
+    }
+    return 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : bench/bench_keyspace.c
+ * Module                    : Keyspace Index Benchmark
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Single-threaded microbenchmark of the keyspace index: insert, lookup
+ *  (hit and miss), delete and heap bytes per key. Build it once per
+ *  backend to compare them head-to-head:
+ *
+ *    make run-bench INDEX=chain
+ *    make run-bench INDEX=swiss
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <malloc.h>
+#include "../src/utils/hashTable.h"
+
+#define DEFAULT_KEYS 1000000
+#define KEY_LEN 32
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static size_t heap_in_use(void) {
+    struct mallinfo2 mi = mallinfo2();
+    return mi.uordblks;
+}
+
+static void shuffle(char **keys, int n) {
+    for (int i = n - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        char *tmp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = tmp;
+    }
+}
+
+static void report(const char *op, int n, double start, double end) {
+    double ns = (end - start) / n;
+    printf("  %-12s %8.1f ns/op  %10.0f ops/s\n", op, ns, 1e9 / ns);
+}
+
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : DEFAULT_KEYS;
+    if (n <= 0) n = DEFAULT_KEYS;
+
+    hashtable_lock_init();
+    srand(42);
+
+    char **keys = malloc(sizeof(char *) * n);
+    char **misses = malloc(sizeof(char *) * n);
+    for (int i = 0; i < n; i++) {
+        keys[i] = malloc(KEY_LEN);
+        misses[i] = malloc(KEY_LEN);
+        snprintf(keys[i], KEY_LEN, "user:%d:session", i);
+        snprintf(misses[i], KEY_LEN, "miss:%d:session", i);
+    }
+
+    printf("=== Keyspace Index Benchmark (index=%s, keys=%d) ===\n", KEYSPACE_INDEX_NAME, n);
+
+    size_t heap_before = heap_in_use();
+    double t0 = now_ns();
+    for (int i = 0; i < n; i++) {
+        set_value(keys[i], "v", 0);
+    }
+    double t1 = now_ns();
+    size_t heap_after = heap_in_use();
+    report("insert", n, t0, t1);
+
+    shuffle(keys, n);
+    size_t found = 0;
+    t0 = now_ns();
+    for (int i = 0; i < n; i++) {
+        found += get_value(keys[i]) != NULL;
+    }
+    t1 = now_ns();
+    report("lookup hit", n, t0, t1);
+
+    t0 = now_ns();
+    for (int i = 0; i < n; i++) {
+        found += get_value(misses[i]) != NULL;
+    }
+    t1 = now_ns();
+    report("lookup miss", n, t0, t1);
+
+    shuffle(keys, n);
+    size_t deleted = 0;
+    t0 = now_ns();
+    for (int i = 0; i < n; i++) {
+        deleted += delete_key(keys[i]);
+    }
+    t1 = now_ns();
+    report("delete", n, t0, t1);
+
+    printf("  %-12s %8.1f bytes/key (heap, key \"user:N:session\" -> \"v\")\n",
+           "memory", (double)(heap_after - heap_before) / n);
+
+    if (found != (size_t)n || deleted != (size_t)n) {
+        fprintf(stderr, "[MemoraDB-BENCH: ERROR] found=%zu deleted=%zu expected=%d\n", found, deleted, n);
+        return 1;
+    }
+
+    for (int i = 0; i < n; i++) {
+        free(keys[i]);
+        free(misses[i]);
+    }
+    free(keys);
+    free(misses);
+    return 0;
+}
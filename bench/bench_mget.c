@@ -0,0 +1,114 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : bench/bench_mget.c
+ * Module                    : Multi-Key Benchmark
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Compares the per-key cost of batched lookups and writes
+ *  (get_strings / set_values) against one call per key, over a key
+ *  set far larger than the CPU caches.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../src/utils/hashTable.h"
+#include "../src/utils/epoch.h"
+
+#define DEFAULT_KEYS 200000
+#define LOOKUPS 400000
+#define MAX_BATCH 256
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static char (*keys)[32];
+static const char **picks;
+
+static double bench_single_get(size_t n) {
+    StringValue v;
+    double t0 = now_ns();
+    epoch_enter();
+    for (size_t i = 0; i < n; i++) {
+        get_string(picks[i], &v);
+    }
+    epoch_exit();
+    return (now_ns() - t0) / n;
+}
+
+static double bench_mget(size_t n, size_t batch) {
+    StringValue out[MAX_BATCH];
+    double t0 = now_ns();
+    epoch_enter();
+    for (size_t i = 0; i + batch <= n; i += batch) {
+        get_strings(&picks[i], batch, out);
+    }
+    epoch_exit();
+    return (now_ns() - t0) / (n - n % batch);
+}
+
+static double bench_single_set(size_t n) {
+    double t0 = now_ns();
+    for (size_t i = 0; i < n; i++) {
+        set_value(picks[i], "value", 0);
+    }
+    return (now_ns() - t0) / n;
+}
+
+static double bench_mset(size_t n, size_t batch) {
+    const char *vals[MAX_BATCH];
+    for (size_t i = 0; i < batch; i++) vals[i] = "value";
+    double t0 = now_ns();
+    for (size_t i = 0; i + batch <= n; i += batch) {
+        set_values(&picks[i], vals, batch, 0);
+    }
+    return (now_ns() - t0) / (n - n % batch);
+}
+
+int main(int argc, char *argv[]) {
+    size_t nkeys = argc > 1 ? strtoul(argv[1], NULL, 10) : DEFAULT_KEYS;
+    if (nkeys == 0) nkeys = DEFAULT_KEYS;
+    hashtable_lock_init();
+
+    keys = malloc(nkeys * sizeof(*keys));
+    picks = malloc(LOOKUPS * sizeof(*picks));
+    for (size_t i = 0; i < nkeys; i++) {
+        snprintf(keys[i], sizeof(keys[i]), "key:%zu", i);
+        set_value(keys[i], "value", 0);
+    }
+    srand(42);
+    for (size_t i = 0; i < LOOKUPS; i++) {
+        picks[i] = keys[(size_t)rand() % nkeys];
+    }
+
+    printf("=== Multi-key vs single-key (%s index, %zu keys, random access) ===\n",
+           KEYSPACE_INDEX_NAME, nkeys);
+    printf("%-12s %8s %12s\n", "op", "batch", "ns/key");
+    printf("%-12s %8d %12.1f\n", "GET", 1, bench_single_get(LOOKUPS));
+    size_t batches[] = { 16, 64, 200 };
+    for (size_t b = 0; b < sizeof(batches) / sizeof(batches[0]); b++) {
+        printf("%-12s %8zu %12.1f\n", "MGET", batches[b], bench_mget(LOOKUPS, batches[b]));
+    }
+    printf("%-12s %8d %12.1f\n", "SET", 1, bench_single_set(LOOKUPS));
+    for (size_t b = 0; b < sizeof(batches) / sizeof(batches[0]); b++) {
+        printf("%-12s %8zu %12.1f\n", "MSET", batches[b], bench_mset(LOOKUPS, batches[b]));
+    }
+
+    free(keys);
+    free(picks);
+    return 0;
+}
@@ -0,0 +1,117 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : bench/bench_reply.c
+ * Module                    : Reply Encoder Benchmark
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Compares printf-style replies against the shared reply encoder, both
+ *  for encoding alone and for a full reply written to /dev/null.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "../src/parser/reply.h"
+
+#define ROUNDS 2000000
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+//-- Keeps the encoders from being optimized away --//
+static volatile size_t sink;
+
+static const char value[] = "a typical forty-byte string value here!!";
+
+static double encode_snprintf_bulk(void) {
+    char buf[128];
+    double t0 = now_ns();
+    for (int i = 0; i < ROUNDS; i++) {
+        sink += (size_t)snprintf(buf, sizeof(buf), "$%zu\r\n%s\r\n", sizeof(value) - 1, value);
+    }
+    return (now_ns() - t0) / ROUNDS;
+}
+
+static double encode_resp_bulk(void) {
+    char buf[128];
+    double t0 = now_ns();
+    for (int i = 0; i < ROUNDS; i++) {
+        sink += resp_encode_bulk(buf, value, sizeof(value) - 1);
+    }
+    return (now_ns() - t0) / ROUNDS;
+}
+
+static double encode_snprintf_integer(void) {
+    char buf[32];
+    double t0 = now_ns();
+    for (int i = 0; i < ROUNDS; i++) {
+        sink += (size_t)snprintf(buf, sizeof(buf), ":%d\r\n", i % 1000);
+    }
+    return (now_ns() - t0) / ROUNDS;
+}
+
+static double encode_resp_integer(void) {
+    char buf[REPLY_HEADER_SIZE];
+    double t0 = now_ns();
+    for (int i = 0; i < ROUNDS; i++) {
+        sink += resp_encode_header(buf, ':', i % 1000);
+    }
+    return (now_ns() - t0) / ROUNDS;
+}
+
+static double write_dprintf(int fd, int kind) {
+    double t0 = now_ns();
+    for (int i = 0; i < ROUNDS; i++) {
+        if (kind == 0) dprintf(fd, "+OK\r\n");
+        else if (kind == 1) dprintf(fd, ":%d\r\n", i % 1000);
+        else dprintf(fd, "$%zu\r\n%s\r\n", sizeof(value) - 1, value);
+    }
+    return (now_ns() - t0) / ROUNDS;
+}
+
+static double write_reply(int fd, int kind) {
+    double t0 = now_ns();
+    for (int i = 0; i < ROUNDS; i++) {
+        if (kind == 0) reply_shared(fd, REPLY_OK);
+        else if (kind == 1) reply_integer(fd, i % 1000);
+        else reply_bulk(fd, value, sizeof(value) - 1);
+    }
+    return (now_ns() - t0) / ROUNDS;
+}
+
+int main(void) {
+    int fd = open("/dev/null", O_WRONLY);
+    if (fd < 0) {
+        perror("open /dev/null");
+        return 1;
+    }
+
+    printf("=== Reply encoding: printf-style vs shared encoder (%d rounds) ===\n", ROUNDS);
+    printf("%-22s %12s %12s\n", "encode only", "snprintf", "encoder");
+    printf("%-22s %12.1f %12.1f\n", "integer :n (ns)", encode_snprintf_integer(), encode_resp_integer());
+    printf("%-22s %12.1f %12.1f\n", "bulk 40 B (ns)", encode_snprintf_bulk(), encode_resp_bulk());
+
+    printf("%-22s %12s %12s\n", "write to /dev/null", "dprintf", "reply_*");
+    const char *kinds[] = { "+OK (ns)", "integer :n (ns)", "bulk 40 B (ns)" };
+    for (int k = 0; k < 3; k++) {
+        printf("%-22s %12.1f %12.1f\n", kinds[k], write_dprintf(fd, k), write_reply(fd, k));
+    }
+
+    close(fd);
+    return 0;
+}
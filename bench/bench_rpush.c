@@ -0,0 +1,112 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : bench/bench_rpush.c
+ * Module                    : Slab Allocator Benchmark
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Measures the allocation rate of an RPUSH-heavy workload (fill a
+ *  list, free it, repeat) at 1..N threads, and of bare ListNode-sized
+ *  allocations through the storage allocator against malloc. Build
+ *  once as is and once with `make bench ALLOCATOR=libc` to compare.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "../src/utils/list.h"
+#include "../src/utils/memAlloc.h"
+#include "../src/utils/slab.h"
+
+#define MAX_THREADS 16
+#define LIST_LEN 10000
+#define ROUNDS 50
+#define RAW_OPS 4000000
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static pthread_barrier_t start_barrier;
+
+//-- One RPUSH-heavy client: its own list, pushed to LIST_LEN and freed --//
+static void *rpush_worker(void *arg) {
+    (void)arg;
+    pthread_barrier_wait(&start_barrier);
+    for (int r = 0; r < ROUNDS; r++) {
+        List *list = list_create();
+        for (int i = 0; i < LIST_LEN; i++) {
+            list_rpush(list, "element");
+        }
+        list_free(list);
+    }
+    return NULL;
+}
+
+static double run_rpush(int threads) {
+    pthread_t tids[MAX_THREADS];
+    pthread_barrier_init(&start_barrier, NULL, threads + 1);
+    for (int i = 0; i < threads; i++) {
+        pthread_create(&tids[i], NULL, rpush_worker, NULL);
+    }
+    pthread_barrier_wait(&start_barrier);
+    double t0 = now_ns();
+    for (int i = 0; i < threads; i++) {
+        pthread_join(tids[i], NULL);
+    }
+    double elapsed = now_ns() - t0;
+    pthread_barrier_destroy(&start_barrier);
+    return (double)threads * ROUNDS * LIST_LEN / elapsed * 1e9;
+}
+
+static double run_raw(int use_mem) {
+    static void *objs[1024];
+    double t0 = now_ns();
+    for (int i = 0; i < RAW_OPS / 1024; i++) {
+        for (int j = 0; j < 1024; j++) {
+            objs[j] = use_mem ? mem_alloc(sizeof(ListNode)) : malloc(sizeof(ListNode));
+        }
+        for (int j = 0; j < 1024; j++) {
+            if (use_mem) mem_free(objs[j], sizeof(ListNode));
+            else free(objs[j]);
+        }
+    }
+    return (RAW_OPS - RAW_OPS % 1024) / (now_ns() - t0) * 1e9;
+}
+
+int main(int argc, char *argv[]) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : 4;
+    if (max_threads < 1) max_threads = 1;
+    if (max_threads > MAX_THREADS) max_threads = MAX_THREADS;
+
+    printf("=== RPUSH allocation rate (%s allocator, %d-element lists, %ld cpus) ===\n",
+           MEM_ALLOCATOR_NAME, LIST_LEN, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%8s %16s\n", "threads", "RPUSH/s");
+    for (int t = 1; t <= max_threads; t *= 2) {
+        printf("%8d %16.0f\n", t, run_rpush(t));
+    }
+
+    printf("\n%-26s %16s\n", "ListNode alloc+free", "pairs/s");
+    printf("%-26s %16.0f\n", "malloc/free", run_raw(0));
+    printf("%-26s %16.0f\n", "mem_alloc/mem_free", run_raw(1));
+
+    SlabStats st;
+    slab_thread_flush();
+    slab_stats(slab_class_for(sizeof(ListNode)), &st);
+    printf("\n16-byte slab: %zu chunks, %zu objects carved, %llu allocs\n",
+           st.chunks, st.objects_total, st.allocs);
+    return 0;
+}
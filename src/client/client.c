@@ -5,8 +5,8 @@
  * 
  * File                      : src/client/client.c
  * Module                    : Client Utilities
- * Last Updating Author      : shady0503
- * Last Update               : 01/23/2026
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
  * Version                   : 1.0.0
  * 
  * Description:
@@ -23,6 +23,7 @@
 #include "resp_parser.h"
 #include "../utils/logo.h"
 #include "history/history.h"
+#include "keyScan.h"
 #include <sys/time.h>
 #include <time.h>
 
@@ -32,19 +33,34 @@ int main(int argc, char *argv[]) {
     char buffer[BUFFER_SIZE];
     char command[BUFFER_SIZE];
     const char *server_ip = "127.0.0.1";
-    
-    //-- Override server IP if provided as argument --//
-    if (argc > 1) {
-        server_ip = argv[1];
+    int scan_mode = -1;
+    int hot_keys = 0;
+    double scan_interval = 0;
+
+    //-- [server-ip] [--bigkeys | --memkeys | --hotkeys] [-i seconds] --//
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--bigkeys") == 0) {
+            scan_mode = KEYSCAN_BIGKEYS;
+        } else if (strcmp(argv[i], "--memkeys") == 0) {
+            scan_mode = KEYSCAN_MEMKEYS;
+        } else if (strcmp(argv[i], "--hotkeys") == 0) {
+            hot_keys = 1;
+        } else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc) {
+            scan_interval = atof(argv[++i]);
+        } else {
+            server_ip = argv[i];
+        }
+    }
+
+    if (scan_mode < 0 && !hot_keys) {
+        display_memoradb_logo();
+        printf("\n\n");
+
+        printf("===============================================\n");
+        printf("     MemoraDB Client - Testing Interface      \n");
+        printf("        Connecting to: %s:%d               \n", server_ip, SERVER_PORT);
+        printf("===============================================\n");
     }
-    
-    display_memoradb_logo();
-    printf("\n\n");
-    
-    printf("===============================================\n");
-    printf("     MemoraDB Client - Testing Interface      \n");
-    printf("        Connecting to: %s:%d               \n", server_ip, SERVER_PORT);
-    printf("===============================================\n");
     
     //-- Create socket --//
     client_fd = socket(AF_INET, SOCK_STREAM, 0);
@@ -73,6 +89,14 @@ int main(int argc, char *argv[]) {
         return 1;
     }
 
+    //-- Report modes print once and exit --//
+    if (scan_mode >= 0 || hot_keys) {
+        int rc = hot_keys ? keyscan_hotkeys(client_fd, KEYSCAN_HOTKEYS_TOP)
+                          : keyscan_run(client_fd, (keyscan_mode_t)scan_mode, scan_interval);
+        close(client_fd);
+        return rc == 0 ? 0 : 1;
+    }
+
     printf("[Client: INFO] Connected to MemoraDB server\n\n");
     printf("[Client: INFO] Type commands (EXIT or QUIT to close the connection):\n");
     printf("=======================================================================\n");
@@ -0,0 +1,325 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/client/keyScan.c
+ * Module                    : Client Key Scanner
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of the client's --bigkeys, --memkeys and --hotkeys
+ *  modes.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+//-- Request POSIX.1-2008 APIs from system headers --//
+#define _POSIX_C_SOURCE 200809L
+#include "keyScan.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+/*
+ * The server answers one command per read, so nothing is pipelined: each
+ * command is sent and its whole reply read before the next goes out.
+ * Replies are parsed in place from a growing buffer; a SCAN batch of
+ * KEYSCAN_BATCH keys fits in a few kilobytes.
+ */
+
+typedef struct ReplyBuf {
+    char *data;
+    size_t len;
+    size_t cap;
+} ReplyBuf;
+
+typedef struct TypeScan {
+    const char *name;           // as TYPE replies it
+    const char *size_cmd;       // --bigkeys sizing command
+    const char *unit;           // --bigkeys unit
+    unsigned long long keys;
+    unsigned long long total;
+    unsigned long long biggest;
+    char *biggest_key;
+} TypeScan;
+
+/* ==================== Wire ==================== */
+
+static int send_command(int fd, int argc, const char *argv[]) {
+    //-- Sized from the arguments: keys may be far longer than any fixed buffer --//
+    size_t cap = 16;
+    for (int i = 0; i < argc; i++) cap += strlen(argv[i]) + 32;
+    char *buf = malloc(cap);
+    if (!buf) return -1;
+    size_t off = (size_t)snprintf(buf, cap, "*%d\r\n", argc);
+    for (int i = 0; i < argc; i++) {
+        off += (size_t)snprintf(buf + off, cap - off, "$%zu\r\n%s\r\n", strlen(argv[i]), argv[i]);
+    }
+    //-- One send per command: the server reads each command in one go --//
+    int rc = 0;
+    for (size_t sent = 0; sent < off;) {
+        ssize_t n = send(fd, buf + sent, off - sent, 0);
+        if (n <= 0) {
+            rc = -1;
+            break;
+        }
+        sent += (size_t)n;
+    }
+    free(buf);
+    return rc;
+}
+
+static const char *find_crlf(const char *p, size_t len) {
+    for (size_t i = 0; i + 1 < len; i++) {
+        if (p[i] == '\r' && p[i + 1] == '\n') return p + i;
+    }
+    return NULL;
+}
+
+//-- Bytes of the first complete reply in p, 0 if more are needed --//
+static size_t reply_span(const char *p, size_t len) {
+    if (len == 0) return 0;
+    if (!strchr("+-:$*", p[0])) {
+        //-- "[MemoraDB: ...]" messages end at the first newline --//
+        const char *nl = memchr(p, '\n', len);
+        return nl ? (size_t)(nl - p) + 1 : 0;
+    }
+    const char *crlf = find_crlf(p, len);
+    if (!crlf) return 0;
+    size_t head = (size_t)(crlf - p) + 2;
+    long long n = atoll(p + 1);
+
+    if (p[0] == '$') {
+        if (n < 0) return head;
+        return len >= head + (size_t)n + 2 ? head + (size_t)n + 2 : 0;
+    }
+    if (p[0] == '*') {
+        size_t off = head;
+        for (long long i = 0; i < n; i++) {
+            size_t span = reply_span(p + off, len - off);
+            if (span == 0) return 0;
+            off += span;
+        }
+        return off;
+    }
+    return head;
+}
+
+static int read_reply(int fd, ReplyBuf *rb) {
+    rb->len = 0;
+    while (reply_span(rb->data, rb->len) == 0) {
+        if (rb->len + 1 >= rb->cap) {
+            size_t cap = rb->cap ? rb->cap * 2 : 4096;
+            char *data = cap <= KEYSCAN_MAX_REPLY ? realloc(rb->data, cap) : NULL;
+            if (!data) return -1;
+            rb->data = data;
+            rb->cap = cap;
+        }
+        ssize_t n = recv(fd, rb->data + rb->len, rb->cap - rb->len - 1, 0);
+        if (n <= 0) return -1;
+        rb->len += (size_t)n;
+    }
+    rb->data[rb->len] = '\0';
+    return 0;
+}
+
+//-- Header line of the next element: its type byte and number --//
+static int next_header(const char **p, const char *end, char type, long long *n) {
+    const char *crlf = find_crlf(*p, (size_t)(end - *p));
+    if (!crlf || **p != type) return -1;
+    *n = atoll(*p + 1);
+    *p = crlf + 2;
+    return 0;
+}
+
+//-- The next bulk string, copied --//
+static char *next_bulk(const char **p, const char *end) {
+    long long n;
+    if (next_header(p, end, '$', &n) != 0 || n < 0 || end - *p < n + 2) return NULL;
+    char *s = malloc((size_t)n + 1);
+    if (!s) return NULL;
+    memcpy(s, *p, (size_t)n);
+    s[n] = '\0';
+    *p += n + 2;
+    return s;
+}
+
+/* ==================== Scanner ==================== */
+
+//-- SCAN one batch; returns the key count, -1 on error --//
+static int scan_batch(int fd, ReplyBuf *rb, char *cursor, size_t cursor_cap, char ***keys) {
+    char count[16];
+    snprintf(count, sizeof(count), "%d", KEYSCAN_BATCH);
+    const char *argv[] = { "SCAN", cursor, "COUNT", count };
+    if (send_command(fd, 4, argv) != 0 || read_reply(fd, rb) != 0) return -1;
+
+    const char *p = rb->data, *end = rb->data + rb->len;
+    long long n;
+    if (next_header(&p, end, '*', &n) != 0 || n != 2) return -1;
+    char *next = next_bulk(&p, end);
+    if (!next) return -1;
+    snprintf(cursor, cursor_cap, "%s", next);
+    free(next);
+
+    if (next_header(&p, end, '*', &n) != 0 || n < 0) return -1;
+    *keys = n ? calloc((size_t)n, sizeof(char *)) : NULL;
+    if (n && !*keys) return -1;
+    for (long long i = 0; i < n; i++) {
+        (*keys)[i] = next_bulk(&p, end);
+        if (!(*keys)[i]) {
+            while (i > 0) free((*keys)[--i]);
+            free(*keys);
+            return -1;
+        }
+    }
+    return (int)n;
+}
+
+//-- Size of key by the mode's measure; 0 if it vanished or changed type --//
+static int key_size(int fd, ReplyBuf *rb, keyscan_mode_t mode, const TypeScan *type,
+                    const char *key, unsigned long long *size) {
+    const char *usage[] = { "MEMORY", "USAGE", key };
+    const char *len[] = { type->size_cmd, key };
+    int rc = mode == KEYSCAN_MEMKEYS ? send_command(fd, 3, usage) : send_command(fd, 2, len);
+    if (rc != 0 || read_reply(fd, rb) != 0) return -1;
+    *size = rb->data[0] == ':' ? strtoull(rb->data + 1, NULL, 10) : 0;
+    return 0;
+}
+
+static void pause_for(double sec) {
+    if (sec <= 0) return;
+    struct timespec ts = { (time_t)sec, (long)((sec - (time_t)sec) * 1e9) };
+    nanosleep(&ts, NULL);
+}
+
+int keyscan_run(int fd, keyscan_mode_t mode, double interval_sec) {
+    TypeScan types[] = {
+        { "string", "STRLEN", "bytes", 0, 0, 0, NULL },
+        { "list", "LLEN", "items", 0, 0, 0, NULL },
+    };
+    const int ntypes = (int)(sizeof(types) / sizeof(types[0]));
+    ReplyBuf rb = { NULL, 0, 0 };
+    char cursor[32] = "0";
+    unsigned long long sampled = 0, key_bytes = 0;
+    int rc = 0;
+
+    printf("# Scanning the keyspace for the %s keys per type (SCAN COUNT %d, %.2f s between batches)\n\n",
+           mode == KEYSCAN_MEMKEYS ? "most memory-hungry" : "biggest", KEYSCAN_BATCH, interval_sec);
+
+    do {
+        char **keys = NULL;
+        int n = scan_batch(fd, &rb, cursor, sizeof(cursor), &keys);
+        if (n < 0) {
+            rc = -1;
+            break;
+        }
+        for (int i = 0; i < n && rc == 0; i++) {
+            const char *argv[] = { "TYPE", keys[i] };
+            if (send_command(fd, 2, argv) != 0 || read_reply(fd, &rb) != 0) {
+                rc = -1;
+                break;
+            }
+            TypeScan *type = NULL;
+            for (int t = 0; t < ntypes; t++) {
+                size_t tl = strlen(types[t].name);
+                if (rb.len >= tl + 1 && rb.data[0] == '+' && strncmp(rb.data + 1, types[t].name, tl) == 0
+                    && rb.data[tl + 1] == '\r') {
+                    type = &types[t];
+                }
+            }
+            //-- Expired or deleted since SCAN returned it --//
+            if (!type) continue;
+
+            unsigned long long size;
+            if (key_size(fd, &rb, mode, type, keys[i], &size) != 0) {
+                rc = -1;
+                break;
+            }
+            sampled++;
+            key_bytes += strlen(keys[i]);
+            type->keys++;
+            type->total += size;
+            if (size > type->biggest || !type->biggest_key) {
+                type->biggest = size;
+                free(type->biggest_key);
+                type->biggest_key = strdup(keys[i]);
+                printf("[%llu keys] Biggest %-6s found so far '%s' with %llu %s\n", sampled, type->name,
+                       keys[i], size, mode == KEYSCAN_MEMKEYS ? "bytes" : type->unit);
+            }
+        }
+        for (int i = 0; i < n; i++) free(keys[i]);
+        free(keys);
+        if (rc == 0 && strcmp(cursor, "0") != 0) pause_for(interval_sec);
+    } while (rc == 0 && strcmp(cursor, "0") != 0);
+
+    if (rc != 0) {
+        printf("[Client: ERROR] Scan aborted: connection lost or unexpected reply\n");
+    }
+
+    printf("\n-------- summary -------\n\n");
+    printf("Sampled %llu keys in the keyspace!\n", sampled);
+    printf("Total key length in bytes is %llu (avg len %.2f)\n\n", key_bytes,
+           sampled ? (double)key_bytes / sampled : 0.0);
+    for (int t = 0; t < ntypes; t++) {
+        const char *unit = mode == KEYSCAN_MEMKEYS ? "bytes" : types[t].unit;
+        if (types[t].biggest_key) {
+            printf("Biggest %6s found '%s' has %llu %s\n", types[t].name, types[t].biggest_key,
+                   types[t].biggest, unit);
+        }
+    }
+    printf("\n");
+    for (int t = 0; t < ntypes; t++) {
+        const char *unit = mode == KEYSCAN_MEMKEYS ? "bytes" : types[t].unit;
+        printf("%llu %ss with %llu %s (%.2f%% of keys, avg size %.2f)\n", types[t].keys, types[t].name,
+               types[t].total, unit, sampled ? 100.0 * types[t].keys / sampled : 0.0,
+               types[t].keys ? (double)types[t].total / types[t].keys : 0.0);
+        free(types[t].biggest_key);
+    }
+    free(rb.data);
+    return rc;
+}
+
+int keyscan_hotkeys(int fd, int top) {
+    char count[16];
+    snprintf(count, sizeof(count), "%d", top);
+    const char *argv[] = { "HOTKEYS", "COUNT", count };
+    ReplyBuf rb = { NULL, 0, 0 };
+    if (send_command(fd, 3, argv) != 0 || read_reply(fd, &rb) != 0) {
+        free(rb.data);
+        printf("[Client: ERROR] HOTKEYS failed: connection lost\n");
+        return -1;
+    }
+
+    const char *p = rb.data, *end = rb.data + rb.len;
+    long long n, ops;
+    if (next_header(&p, end, '*', &n) != 0 || n % 2 != 0) {
+        printf("[Client: ERROR] HOTKEYS failed: %s", rb.data);
+        free(rb.data);
+        return -1;
+    }
+
+    printf("# Hottest keys, estimated from sampled accesses over the last 10-20 s\n\n");
+    printf("  %-4s %-48s %14s\n", "rank", "key", "ops/sec");
+    int rc = 0;
+    for (long long i = 0; i < n / 2; i++) {
+        char *key = next_bulk(&p, end);
+        if (!key || next_header(&p, end, ':', &ops) != 0) {
+            free(key);
+            rc = -1;
+            break;
+        }
+        printf("  %-4lld %-48s %14lld\n", i + 1, key, ops);
+        free(key);
+    }
+    if (n == 0) printf("  (no key sampled yet)\n");
+    free(rb.data);
+    return rc;
+}
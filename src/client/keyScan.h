@@ -0,0 +1,60 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/client/keyScan.h
+ * Module                    : Client Key Scanner Header
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for the client's --bigkeys and --memkeys modes, which walk the
+ *  keyspace with SCAN and report the largest key of every type, and for
+ *  --hotkeys, which prints the server's hot-key report.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef KEYSCAN_H
+#define KEYSCAN_H
+
+/* ==================== CONSTANTS ==================== */
+#define KEYSCAN_BATCH       100     // SCAN COUNT per round trip
+#define KEYSCAN_MAX_REPLY   (1 << 20)
+#define KEYSCAN_HOTKEYS_TOP 10      // keys listed by --hotkeys
+
+/* ==================== ENUMERATIONS ==================== */
+typedef enum {
+    KEYSCAN_BIGKEYS,        // size as STRLEN / LLEN
+    KEYSCAN_MEMKEYS         // size as MEMORY USAGE
+} keyscan_mode_t;
+
+/* ==================== FUNCTION DECLARATIONS ==================== */
+
+/**
+ * Walk the whole keyspace and print the biggest key per type.
+ *
+ * Keys are fetched with SCAN, one batch per round trip, and sized one
+ * command at a time, so the server is never busy with more than a single
+ * bucket walk or key. A pause between batches lowers the load further.
+ *
+ * @param fd Connected socket
+ * @param mode What "biggest" means
+ * @param interval_sec Pause between SCAN batches, 0 for none
+ * @return 0 on success, -1 if the connection failed or a reply was malformed
+ */
+int keyscan_run(int fd, keyscan_mode_t mode, double interval_sec);
+
+/**
+ * Print the hottest keys with their estimated ops/sec (HOTKEYS).
+ *
+ * @param fd Connected socket
+ * @param top Number of keys to list
+ * @return 0 on success, -1 if the connection failed or a reply was malformed
+ */
+int keyscan_hotkeys(int fd, int top);
+
+#endif // KEYSCAN_H
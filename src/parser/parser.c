@@ -5,8 +5,8 @@
  * 
  * File                      : src/parser/parser.c
  * Module                    : RESP Protocol Parser
- * Last Updating Author      : youssefbouraoui1
- * Last Update               : 02/08/2026
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
  * Version                   : 1.0.0
  * 
  * Description:
@@ -20,9 +20,25 @@
 
 #define _GNU_SOURCE
 #include "parser.h"
+#include "reply.h"
 #include "../utils/hashTable.h"
+#include "../utils/epoch.h"
+#include "../utils/expire.h"
+#include "../utils/lazyfree.h"
+#include "../utils/defrag.h"
+#include "../utils/evict.h"
+#include "../utils/hotKeys.h"
+#include "../utils/slab.h"
+#include "../utils/memAlloc.h"
+#include "../utils/hugePages.h"
+#include "../utils/glob.h"
+#include "../utils/numeric.h"
+#include "../utils/monoClock.h"
 #include <stdio.h>
+#include <limits.h>
+#include <stdarg.h>
 #include <stdbool.h>
+#include <unistd.h>
 
 int parse_command(char * input, char * tokens[], int max_tokens){
     int counter = 0;
@@ -64,59 +80,732 @@ enum command_t identify_command(const char * cmd){
     if(strcasecmp(cmd, "LPOP") == 0) return CMD_LPOP;
     if(strcasecmp(cmd, "BLPOP") == 0) return CMD_BLPOP;
     if(strcasecmp(cmd,"TYPE")==0) return CMD_TYPE;
+    if(strcasecmp(cmd, "INFO") == 0) return CMD_INFO;
+    if(strcasecmp(cmd, "SCAN") == 0) return CMD_SCAN;
+    if(strcasecmp(cmd, "KEYS") == 0) return CMD_KEYS;
+    if(strcasecmp(cmd, "INCR") == 0) return CMD_INCR;
+    if(strcasecmp(cmd, "DECR") == 0) return CMD_DECR;
+    if(strcasecmp(cmd, "INCRBY") == 0) return CMD_INCRBY;
+    if(strcasecmp(cmd, "DECRBY") == 0) return CMD_DECRBY;
+    if(strcasecmp(cmd, "INCRBYFLOAT") == 0) return CMD_INCRBYFLOAT;
+    if(strcasecmp(cmd, "MGET") == 0) return CMD_MGET;
+    if(strcasecmp(cmd, "MSET") == 0) return CMD_MSET;
+    if(strcasecmp(cmd, "MSETNX") == 0) return CMD_MSETNX;
+    if(strcasecmp(cmd, "EXPIRE") == 0) return CMD_EXPIRE;
+    if(strcasecmp(cmd, "PEXPIRE") == 0) return CMD_PEXPIRE;
+    if(strcasecmp(cmd, "EXPIREAT") == 0) return CMD_EXPIREAT;
+    if(strcasecmp(cmd, "PEXPIREAT") == 0) return CMD_PEXPIREAT;
+    if(strcasecmp(cmd, "TTL") == 0) return CMD_TTL;
+    if(strcasecmp(cmd, "PTTL") == 0) return CMD_PTTL;
+    if(strcasecmp(cmd, "PERSIST") == 0) return CMD_PERSIST;
+    if(strcasecmp(cmd, "UNLINK") == 0) return CMD_UNLINK;
+    if(strcasecmp(cmd, "FLUSHALL") == 0) return CMD_FLUSHALL;
+    if(strcasecmp(cmd, "FLUSHDB") == 0) return CMD_FLUSHDB;
+    if(strcasecmp(cmd, "STRLEN") == 0) return CMD_STRLEN;
+    if(strcasecmp(cmd, "MEMORY") == 0) return CMD_MEMORY;
+    if(strcasecmp(cmd, "HOTKEYS") == 0) return CMD_HOTKEYS;
     return CMD_UNKNOWN;
 }
 
-void dispatch_command(int client_fd, char * tokens[], int token_count){
+static void reply_incr_error(int client_fd, incr_status_t status) {
+    switch (status) {
+    case INCR_WRONGTYPE:
+        reply_printf(client_fd, "[MemoraDB: ERROR] WRONGTYPE Operation against a key holding the wrong kind of value\r\n");
+        break;
+    case INCR_NOT_INTEGER:
+        reply_printf(client_fd, "[MemoraDB: ERROR] value is not an integer or out of range\r\n");
+        break;
+    case INCR_NOT_FLOAT:
+        reply_printf(client_fd, "[MemoraDB: ERROR] value is not a valid float\r\n");
+        break;
+    case INCR_OVERFLOW:
+        reply_printf(client_fd, "[MemoraDB: ERROR] increment or decrement would overflow\r\n");
+        break;
+    default:
+        reply_printf(client_fd, "[MemoraDB: ERROR] out of memory\r\n");
+        break;
+    }
+}
+
+static void incr_command(int client_fd, enum command_t cmd, char *tokens[], int token_count) {
+    int wants_arg = cmd == CMD_INCRBY || cmd == CMD_DECRBY;
+    if (token_count != (wants_arg ? 3 : 2)) {
+        reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for '%s'\r\n", tokens[0]);
+        return;
+    }
+
+    long long delta = 1;
+    if (wants_arg && !string2ll(tokens[2], strlen(tokens[2]), &delta)) {
+        reply_incr_error(client_fd, INCR_NOT_INTEGER);
+        return;
+    }
+    if (cmd == CMD_DECR || cmd == CMD_DECRBY) {
+        if (delta == LLONG_MIN) {
+            reply_incr_error(client_fd, INCR_OVERFLOW);
+            return;
+        }
+        delta = -delta;
+    }
+
+    long long result;
+    incr_status_t status = incr_by(tokens[1], delta, &result);
+    if (status == INCR_OK) {
+        reply_integer(client_fd, result);
+    } else {
+        reply_incr_error(client_fd, status);
+    }
+}
+
+/* ==================== TTL ==================== */
+
+/*
+ * Turn a client timeout into a monotonic deadline. unit_ms is 1000 for
+ * seconds and 1 for milliseconds; absolute timeouts are Unix times.
+ * Returns 0 if arg is not an integer or the result overflows.
+ */
+static int parse_deadline(const char *arg, long long unit_ms, int absolute, long long *deadline) {
+    long long v;
+    if (!string2ll(arg, strlen(arg), &v)) return 0;
+    if (__builtin_mul_overflow(v, unit_ms, &v)) return 0;
+    long long base = absolute ? mono_clock_ms() - wall_clock_ms() : current_millis();
+    return !__builtin_add_overflow(v, base, deadline);
+}
+
+static void set_command(int client_fd, char *tokens[], int token_count) {
+    long long deadline = 0;
+    if (token_count == 5) {
+        const char *opt = tokens[3];
+        int is_ex = strcasecmp(opt, "EX") == 0, is_px = strcasecmp(opt, "PX") == 0;
+        int is_exat = strcasecmp(opt, "EXAT") == 0, is_pxat = strcasecmp(opt, "PXAT") == 0;
+        if (!is_ex && !is_px && !is_exat && !is_pxat) {
+            reply_printf(client_fd, "[MemoraDB: ERROR] syntax error\r\n");
+            return;
+        }
+        long long v;
+        if (!string2ll(tokens[4], strlen(tokens[4]), &v) || v <= 0 ||
+            !parse_deadline(tokens[4], (is_ex || is_exat) ? 1000 : 1, is_exat || is_pxat, &deadline)) {
+            reply_printf(client_fd, "[MemoraDB: ERROR] invalid expire time in 'set' command\r\n");
+            return;
+        }
+        //-- An absolute time in the past still sets a TTL: the key is born expired --//
+        if (deadline < 1) deadline = 1;
+    } else if (token_count != 3) {
+        reply_printf(client_fd, "[MemoraDB: ERROR] syntax error\r\n");
+        return;
+    }
+    set_value_at(tokens[1], tokens[2], deadline);
+    reply_shared(client_fd, REPLY_OK);
+}
+
+static void expire_command(int client_fd, enum command_t cmd, char *tokens[], int token_count) {
+    if (token_count != 3 && token_count != 4) {
+        reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for '%s'\r\n", tokens[0]);
+        return;
+    }
+
+    expire_cond_t cond = EXPIRE_ALWAYS;
+    if (token_count == 4) {
+        const char *opt = tokens[3];
+        if (strcasecmp(opt, "NX") == 0) cond = EXPIRE_NX;
+        else if (strcasecmp(opt, "XX") == 0) cond = EXPIRE_XX;
+        else if (strcasecmp(opt, "GT") == 0) cond = EXPIRE_GT;
+        else if (strcasecmp(opt, "LT") == 0) cond = EXPIRE_LT;
+        else {
+            reply_printf(client_fd, "[MemoraDB: ERROR] Unsupported option %s\r\n", opt);
+            return;
+        }
+    }
+
+    long long unit = (cmd == CMD_EXPIRE || cmd == CMD_EXPIREAT) ? 1000 : 1;
+    int absolute = cmd == CMD_EXPIREAT || cmd == CMD_PEXPIREAT;
+    long long deadline;
+    if (!parse_deadline(tokens[2], unit, absolute, &deadline)) {
+        reply_printf(client_fd, "[MemoraDB: ERROR] invalid expire time in '%s' command\r\n", tokens[0]);
+        return;
+    }
+
+    int rc = set_expiry(tokens[1], deadline, cond);
+    if (rc < 0)
+        reply_printf(client_fd, "[MemoraDB: ERROR] out of memory\r\n");
+    else
+        reply_integer(client_fd, rc);
+}
+
+static void ttl_command(int client_fd, enum command_t cmd, char *tokens[], int token_count) {
+    if (token_count != 2) {
+        reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for '%s'\r\n", tokens[0]);
+        return;
+    }
+    long long ttl = get_ttl_ms(tokens[1]);
+    if (cmd == CMD_TTL && ttl > 0) {
+        ttl = (ttl + 500) / 1000;
+    }
+    reply_integer(client_fd, ttl);
+}
+
+/* ==================== Multi-Key ==================== */
+
+static void mget_command(int client_fd, char *tokens[], int token_count, Arena *arena) {
+    size_t n = (size_t)token_count - 1;
+    StringValue *values = arena_alloc(arena, n * sizeof(StringValue));
+    if (!values) {
+        reply_printf(client_fd, "[MemoraDB: ERROR] out of memory\r\n");
+        return;
+    }
+
+    get_strings((const char *const *)&tokens[1], n, values);
+
+    //-- The whole reply in one buffer and one write --//
+    size_t total = REPLY_HEADER_SIZE;
+    for (size_t i = 0; i < n; i++) {
+        total += REPLY_HEADER_SIZE + 2 + (values[i].is_int ? LL_STR_SIZE : values[i].len);
+    }
+    char *buf = arena_alloc(arena, total);
+    if (!buf) {
+        reply_printf(client_fd, "[MemoraDB: ERROR] out of memory\r\n");
+        return;
+    }
+    size_t pos = resp_encode_header(buf, '*', (long long)n);
+    for (size_t i = 0; i < n; i++) {
+        if (values[i].is_int) {
+            char digits[LL_STR_SIZE];
+            pos += resp_encode_bulk(buf + pos, digits, ll2str(digits, values[i].int_value));
+        } else if (values[i].ptr) {
+            pos += resp_encode_bulk(buf + pos, values[i].ptr, values[i].len);
+        } else {
+            pos += resp_encode_header(buf + pos, '$', -1);
+        }
+    }
+    reply_write(client_fd, buf, pos);
+}
+
+static void mset_command(int client_fd, char *tokens[], int token_count, int nx, Arena *arena) {
+    size_t n = ((size_t)token_count - 1) / 2;
+    const char **keys = arena_alloc(arena, n * sizeof(char *));
+    const char **vals = arena_alloc(arena, n * sizeof(char *));
+    if (!keys || !vals) {
+        reply_printf(client_fd, "[MemoraDB: ERROR] out of memory\r\n");
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = tokens[1 + 2 * i];
+        vals[i] = tokens[2 + 2 * i];
+    }
+
+    int rc = set_values(keys, vals, n, nx);
+    if (rc < 0)
+        reply_printf(client_fd, "[MemoraDB: ERROR] out of memory\r\n");
+    else if (nx)
+        reply_integer(client_fd, rc);
+    else
+        reply_shared(client_fd, REPLY_OK);
+}
+
+#define INFO_BUFFER_SIZE 4096
+#define INFO_HOT_STRIPES 5
+
+//-- Append one formatted line to an INFO reply, truncating silently when full --//
+static void info_append(char *buf, size_t *len, const char *fmt, ...) {
+    if (*len >= INFO_BUFFER_SIZE) return;
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf + *len, INFO_BUFFER_SIZE - *len, fmt, args);
+    va_end(args);
+    if (n > 0) {
+        *len += (size_t)n;
+        if (*len > INFO_BUFFER_SIZE - 1) *len = INFO_BUFFER_SIZE - 1;
+    }
+}
+
+static void info_locks(char *buf, size_t *len) {
+    StripeStats total;
+    hashtable_lock_stats(&total);
+    info_append(buf, len, "# Locks\r\n");
+    info_append(buf, len, "lock_stripes:%d\r\n", LOCK_STRIPES);
+    info_append(buf, len, "lock_acquisitions:%llu\r\n", (unsigned long long)total.acquisitions);
+    info_append(buf, len, "lock_contended:%llu\r\n", (unsigned long long)total.contended);
+    info_append(buf, len, "lock_parked:%llu\r\n", (unsigned long long)total.parked);
+
+    //-- Top stripes by contention, as stripe=contended pairs --//
+    int hot[INFO_HOT_STRIPES];
+    uint64_t hot_count[INFO_HOT_STRIPES];
+    int found = 0;
+    for (int i = 0; i < LOCK_STRIPES; i++) {
+        StripeStats st;
+        stripe_lock_stats(&key_locks[i], &st);
+        if (st.contended == 0) continue;
+        int pos;
+        if (found < INFO_HOT_STRIPES) {
+            pos = found++;
+        } else if (st.contended > hot_count[INFO_HOT_STRIPES - 1]) {
+            pos = INFO_HOT_STRIPES - 1;
+        } else {
+            continue;
+        }
+        while (pos > 0 && hot_count[pos - 1] < st.contended) {
+            hot[pos] = hot[pos - 1];
+            hot_count[pos] = hot_count[pos - 1];
+            pos--;
+        }
+        hot[pos] = i;
+        hot_count[pos] = st.contended;
+    }
+    info_append(buf, len, "lock_hot_stripes:");
+    for (int i = 0; i < found; i++) {
+        info_append(buf, len, "%s%d=%llu", i ? "," : "", hot[i], (unsigned long long)hot_count[i]);
+    }
+    info_append(buf, len, "\r\n");
+}
+
+static void info_expiry(char *buf, size_t *len) {
+    ExpireStats st;
+    expire_get_stats(&st);
+    info_append(buf, len, "# Expiry\r\n");
+    info_append(buf, len, "expired_keys:%llu\r\n", st.expired_keys);
+    info_append(buf, len, "expired_active_keys:%llu\r\n", st.active_expired);
+    info_append(buf, len, "expired_wheel_keys:%llu\r\n", st.wheel_expired);
+    info_append(buf, len, "expired_keys_per_sec:%.2f\r\n", st.expired_per_sec);
+    info_append(buf, len, "expired_stale_perc:%.2f\r\n", st.stale_perc);
+    info_append(buf, len, "expire_cycles:%llu\r\n", st.cycles);
+    info_append(buf, len, "expire_cycle_cpu_ms:%llu\r\n", st.cycle_time_us / 1000);
+    info_append(buf, len, "expire_time_cap_reached:%llu\r\n", st.time_cap_reached);
+}
+
+static void info_lazyfree(char *buf, size_t *len) {
+    info_append(buf, len, "# Lazyfree\r\n");
+    info_append(buf, len, "lazyfree_pending_objects:%zu\r\n", lazyfree_pending());
+    info_append(buf, len, "lazyfreed_objects:%llu\r\n", lazyfree_freed());
+}
+
+static void info_defrag(char *buf, size_t *len) {
+    DefragStats st;
+    defrag_get_stats(&st);
+    size_t frag_bytes;
+    double frag_pct = defrag_fragmentation(&frag_bytes);
+    info_append(buf, len, "# Defrag\r\n");
+    info_append(buf, len, "active_defrag_enabled:%d\r\n", defrag_enabled());
+    info_append(buf, len, "active_defrag_running:%d\r\n", st.running);
+    info_append(buf, len, "allocator_frag_pct:%.2f\r\n", frag_pct);
+    info_append(buf, len, "allocator_frag_bytes:%zu\r\n", frag_bytes);
+    info_append(buf, len, "active_defrag_cpu_pct:%d\r\n", st.cpu_pct);
+    info_append(buf, len, "active_defrag_hits:%llu\r\n", st.hits);
+    info_append(buf, len, "active_defrag_misses:%llu\r\n", st.misses);
+    info_append(buf, len, "active_defrag_bytes_moved:%llu\r\n", st.bytes_moved);
+    info_append(buf, len, "active_defrag_released_bytes:%llu\r\n", st.released_bytes);
+    info_append(buf, len, "active_defrag_passes:%llu\r\n", st.passes);
+    info_append(buf, len, "active_defrag_cycles:%llu\r\n", st.cycles);
+    info_append(buf, len, "active_defrag_cycle_time_us:%llu\r\n", st.cycle_time_us);
+}
+
+static void info_eviction(char *buf, size_t *len) {
+    EvictConfig cfg;
+    EvictStats st;
+    evict_get_config(&cfg);
+    evict_get_stats(&st);
+    info_append(buf, len, "# Eviction\r\n");
+    info_append(buf, len, "maxmemory:%zu\r\n", cfg.maxmemory);
+    info_append(buf, len, "maxmemory_policy:%s\r\n", evict_policy_name(cfg.policy));
+    info_append(buf, len, "maxmemory_samples:%d\r\n", cfg.samples);
+    info_append(buf, len, "used_memory_counted:%zu\r\n", evict_used_memory());
+    info_append(buf, len, "evicted_keys:%llu\r\n", st.evicted_keys);
+    info_append(buf, len, "evicted_bytes:%llu\r\n", st.evicted_bytes);
+    info_append(buf, len, "evicted_pending_bytes:%zu\r\n", st.pending_bytes);
+    info_append(buf, len, "eviction_time_us:%llu\r\n", st.evict_time_us);
+    info_append(buf, len, "oom_rejected_commands:%llu\r\n", st.oom_rejections);
+}
+
+static void info_hotkeys(char *buf, size_t *len) {
+    HotKeysStats st;
+    hotkeys_stats(&st);
+    info_append(buf, len, "# Hotkeys\r\n");
+    info_append(buf, len, "hotkeys_sample_rate:%d\r\n", st.sample_rate);
+    info_append(buf, len, "hotkeys_sampled:%llu\r\n", st.sampled);
+    info_append(buf, len, "hotkeys_sketches:%zu\r\n", st.sketches);
+    HotKey top;
+    if (hotkeys_top(&top, 1) == 1) {
+        info_append(buf, len, "hotkeys_top:%s%s,ops_per_sec=%.0f\r\n", top.key,
+                    top.len > HOTKEYS_KEY_MAX ? "..." : "", top.ops_per_sec);
+    }
+}
+
+static void info_memory(char *buf, size_t *len) {
+    MemStats st;
+    mem_stats(&st);
+    info_append(buf, len, "# Memory\r\n");
+    info_append(buf, len, "mem_allocator:%s\r\n", MEM_ALLOCATOR_NAME);
+    info_append(buf, len, "used_memory:%zu\r\n", st.used);
+    info_append(buf, len, "used_memory_requested:%zu\r\n", st.requested);
+    info_append(buf, len, "used_memory_allocations:%zu\r\n", st.allocations);
+    info_append(buf, len, "slab_reserved:%zu\r\n", st.slab_reserved);
+    info_append(buf, len, "used_memory_rss:%zu\r\n", st.rss);
+    info_append(buf, len, "mem_fragmentation_ratio:%.2f\r\n", st.used ? (double)st.rss / st.used : 0.0);
+    HugePagesStats hp;
+    hugepages_stats(&hp);
+    info_append(buf, len, "hugepages_mode:%s\r\n", hugepages_mode_name(hp.mode));
+    info_append(buf, len, "hugepages_mapped:%zu\r\n", hp.mapped);
+    info_append(buf, len, "hugepages_explicit_bytes:%zu\r\n", hp.explicit_total);
+    info_append(buf, len, "hugepages_fallbacks:%llu\r\n", hp.fallbacks);
+    info_append(buf, len, "hugepages_thp_resident:%zu\r\n", hp.thp_resident);
+    //-- Only the size classes that ever reserved a chunk --//
+    for (int cls = 0; cls < SLAB_CLASS_COUNT; cls++) {
+        SlabStats ss;
+        slab_stats(cls, &ss);
+        if (ss.chunks == 0) continue;
+        info_append(buf, len, "slab_%zu:chunks=%zu,objects=%zu,in_use=%zu,allocs=%llu,frees=%llu\r\n",
+                    ss.object_size, ss.chunks, ss.objects_total, ss.objects_in_use, ss.allocs, ss.frees);
+    }
+}
+
+#define SCAN_DEFAULT_COUNT 10
+#define SCAN_TYPE_ANY     -1
+#define SCAN_TYPE_UNKNOWN -2     //- TYPE filter naming no known type: matches nothing -//
+
+typedef struct ScanReply {
+    const char **keys;       //- point into entries, valid for this epoch -//
+    size_t count;
+    size_t cap;
+    const char *match;       //- NULL = no MATCH filter -//
+    int type;                //- value_type_t or SCAN_TYPE_* -//
+    Arena *arena;            //- keys[] grows here; old copies are dropped with the arena -//
+} ScanReply;
+
+static void scan_collect(const Entry *entry, void *ctx) {
+    ScanReply *r = ctx;
+    if (r->type != SCAN_TYPE_ANY && entry->type != r->type) return;
+    if (r->match && !glob_match(r->match, entry->key)) return;
+    if (r->count == r->cap) {
+        size_t cap = r->cap ? r->cap * 2 : 16;
+        const char **keys = arena_alloc(r->arena, cap * sizeof(*keys));
+        if (!keys) return;
+        if (r->count) memcpy(keys, r->keys, r->count * sizeof(*keys));
+        r->keys = keys;
+        r->cap = cap;
+    }
+    r->keys[r->count++] = entry->key;
+}
+
+//-- [next-cursor, [keys...]] --//
+static void scan_reply(int client_fd, const char *cursor, size_t cursor_len, const ScanReply *reply, Arena *arena) {
+    char *header = arena_alloc(arena, REPLY_HEADER_SIZE * 2 + cursor_len + 2);
+    if (!header) {
+        reply_printf(client_fd, "[MemoraDB: ERROR] out of memory\r\n");
+        return;
+    }
+    size_t header_len = resp_encode_header(header, '*', 2);
+    header_len += resp_encode_bulk(header + header_len, cursor, cursor_len);
+    reply_write(client_fd, header, header_len);
+    reply_bulk_array(client_fd, (char *const *)reply->keys, reply->count, arena);
+}
+
+/*
+ * Ordered SCAN: with the key index on, a MATCH pattern with a literal
+ * prefix walks only the keys under that prefix, in byte order. The
+ * cursor is then ">" followed by the last key visited.
+ */
+static void scan_ordered(int client_fd, ScanReply *reply, size_t prefix_len, const char *after,
+                         size_t count, Arena *arena) {
+    char *prefix = arena_strndup(arena, reply->match ? reply->match : "", prefix_len);
+    char *next = NULL;
+    if (!prefix || hashtable_scan_prefix(prefix, after, count, scan_collect, reply, &next) != 0) {
+        reply_printf(client_fd, "[MemoraDB: ERROR] ordered scan failed\r\n");
+        return;
+    }
+    if (!next) {
+        scan_reply(client_fd, "0", 1, reply, arena);
+        return;
+    }
+    size_t next_len = strlen(next);
+    char *cursor = arena_alloc(arena, next_len + 1);
+    if (cursor) {
+        cursor[0] = '>';
+        memcpy(cursor + 1, next, next_len);
+        scan_reply(client_fd, cursor, next_len + 1, reply, arena);
+    } else {
+        reply_printf(client_fd, "[MemoraDB: ERROR] out of memory\r\n");
+    }
+    free(next);
+}
+
+static void scan_command(int client_fd, char *tokens[], int token_count, Arena *arena) {
+    char *end = NULL;
+    unsigned long cursor = 0;
+    const char *after = NULL;
+    if (tokens[1][0] == '>' && hashtable_key_index_enabled()) {
+        after = tokens[1] + 1;
+    } else {
+        cursor = strtoul(tokens[1], &end, 10);
+        if (end == tokens[1] || *end != '\0') {
+            reply_printf(client_fd, "[MemoraDB: ERROR] invalid cursor\r\n");
+            return;
+        }
+    }
+
+    ScanReply reply = { NULL, 0, 0, NULL, SCAN_TYPE_ANY, arena };
+    long count = SCAN_DEFAULT_COUNT;
+    for (int i = 2; i < token_count; i += 2) {
+        if (i + 1 >= token_count) {
+            reply_printf(client_fd, "[MemoraDB: ERROR] syntax error in 'SCAN'\r\n");
+            return;
+        }
+        if (strcasecmp(tokens[i], "MATCH") == 0) {
+            //-- "*" matches everything, skip the matcher entirely --//
+            reply.match = strcmp(tokens[i + 1], "*") == 0 ? NULL : tokens[i + 1];
+        } else if (strcasecmp(tokens[i], "COUNT") == 0) {
+            count = atol(tokens[i + 1]);
+            if (count < 1) {
+                reply_printf(client_fd, "[MemoraDB: ERROR] COUNT must be positive\r\n");
+                return;
+            }
+        } else if (strcasecmp(tokens[i], "TYPE") == 0) {
+            if (strcasecmp(tokens[i + 1], "string") == 0) {
+                reply.type = VALUE_STRING;
+            } else if (strcasecmp(tokens[i + 1], "list") == 0) {
+                reply.type = VALUE_LIST;
+            } else {
+                reply.type = SCAN_TYPE_UNKNOWN;
+            }
+        } else {
+            reply_printf(client_fd, "[MemoraDB: ERROR] syntax error in 'SCAN'\r\n");
+            return;
+        }
+    }
+
+    size_t prefix_len = reply.match ? glob_literal_prefix(reply.match) : 0;
+    if (after || (cursor == 0 && prefix_len > 0 && hashtable_key_index_enabled())) {
+        scan_ordered(client_fd, &reply, prefix_len, after, (size_t)count, arena);
+        return;
+    }
+
+    cursor = hashtable_scan(cursor, (size_t)count, scan_collect, &reply);
+
+    //-- Cursors index the table, far below LLONG_MAX --//
+    char cursor_str[LL_STR_SIZE];
+    scan_reply(client_fd, cursor_str, ll2str(cursor_str, (long long)cursor), &reply, arena);
+}
+
+#define KEYS_SCAN_BATCH 1024
+
+static void keys_command(int client_fd, const char *pattern, Arena *arena) {
+    ScanReply reply = { NULL, 0, 0, strcmp(pattern, "*") == 0 ? NULL : pattern, SCAN_TYPE_ANY, arena };
+    size_t prefix_len = glob_literal_prefix(pattern);
+    char *prefix = prefix_len ? arena_strndup(arena, pattern, prefix_len) : NULL;
+
+    //-- A literal prefix is one walk of the key index; otherwise every bucket is visited --//
+    if (!prefix || hashtable_scan_prefix(prefix, NULL, 0, scan_collect, &reply, NULL) != 0) {
+        unsigned long cursor = 0;
+        do {
+            cursor = hashtable_scan(cursor, KEYS_SCAN_BATCH, scan_collect, &reply);
+        } while (cursor);
+    }
+    reply_bulk_array(client_fd, (char *const *)reply.keys, reply.count, arena);
+}
+
+/* ==================== MEMORY ==================== */
+
+//-- One name/value pair of a MEMORY STATS reply --//
+static void stats_pair(char *buf, size_t *len, const char *name, unsigned long long value) {
+    info_append(buf, len, "$%zu\r\n%s\r\n:%llu\r\n", strlen(name), name, value);
+}
+
+#define MEMORY_STATS_FIELDS 13
+
+static void memory_stats(int client_fd) {
+    MemStats ms;
+    KeyspaceMemory km;
+    mem_stats(&ms);
+    hashtable_memory_stats(&km);
+
+    size_t keys = km.strings.keys + km.lists.keys;
+    size_t dataset = km.strings.bytes + km.lists.bytes;
+    char buf[INFO_BUFFER_SIZE];
+    size_t len = 0;
+    info_append(buf, &len, "*%d\r\n", MEMORY_STATS_FIELDS * 2);
+    stats_pair(buf, &len, "total.allocated", ms.used);
+    stats_pair(buf, &len, "total.requested", ms.requested);
+    stats_pair(buf, &len, "allocations", ms.allocations);
+    stats_pair(buf, &len, "rss", ms.rss);
+    stats_pair(buf, &len, "keys.count", keys);
+    stats_pair(buf, &len, "keys.bytes-per-key", keys ? dataset / keys : 0);
+    stats_pair(buf, &len, "dataset.bytes", dataset);
+    //-- Index arrays, and retired memory still waiting for its grace period --//
+    stats_pair(buf, &len, "overhead.bytes", ms.used > dataset ? ms.used - dataset : 0);
+    stats_pair(buf, &len, "strings.count", km.strings.keys);
+    stats_pair(buf, &len, "strings.bytes", km.strings.bytes);
+    stats_pair(buf, &len, "lists.count", km.lists.keys);
+    stats_pair(buf, &len, "lists.bytes", km.lists.bytes);
+    stats_pair(buf, &len, "expires.count", km.expires);
+    reply_write(client_fd, buf, len);
+}
+
+static void memory_command(int client_fd, char *tokens[], int token_count) {
+    if (token_count < 2) {
+        reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'MEMORY'\r\n");
+    } else if (strcasecmp(tokens[1], "USAGE") == 0) {
+        //-- SAMPLES is accepted for compatibility; the count is always exact --//
+        if (token_count != 3 && !(token_count == 5 && strcasecmp(tokens[3], "SAMPLES") == 0)) {
+            reply_printf(client_fd, "[MemoraDB: ERROR] syntax error in 'MEMORY USAGE'\r\n");
+            return;
+        }
+        size_t bytes = get_key_memory(tokens[2]);
+        if (bytes)
+            reply_integer(client_fd, (long long)bytes);
+        else
+            reply_shared(client_fd, REPLY_NULL_BULK);
+    } else if (strcasecmp(tokens[1], "STATS") == 0 && token_count == 2) {
+        memory_stats(client_fd);
+    } else {
+        reply_printf(client_fd, "[MemoraDB: ERROR] unknown subcommand '%s' for 'MEMORY'\r\n", tokens[1]);
+    }
+}
+
+/* ==================== HOTKEYS ==================== */
+
+static void hotkeys_command(int client_fd, char *tokens[], int token_count, Arena *arena) {
+    long top = HOTKEYS_DEFAULT_TOP;
+    if (token_count == 2 && strcasecmp(tokens[1], "RESET") == 0) {
+        hotkeys_reset();
+        reply_shared(client_fd, REPLY_OK);
+        return;
+    }
+    if (token_count == 3 && strcasecmp(tokens[1], "COUNT") == 0) {
+        char *end = NULL;
+        top = strtol(tokens[2], &end, 10);
+        if (end == tokens[2] || *end != '\0' || top < 1 || top > 1000) {
+            reply_printf(client_fd, "[MemoraDB: ERROR] COUNT must be between 1 and 1000\r\n");
+            return;
+        }
+    } else if (token_count != 1) {
+        reply_printf(client_fd, "[MemoraDB: ERROR] syntax error in 'HOTKEYS'\r\n");
+        return;
+    }
+
+    HotKey *keys = arena_alloc(arena, (size_t)top * sizeof(HotKey));
+    size_t n = keys ? hotkeys_top(keys, (size_t)top) : 0;
+    //-- key, estimated ops/sec, key, ... --//
+    size_t cap = 16 + n * (HOTKEYS_KEY_MAX + 3 + 2 * LL_STR_SIZE + 10);
+    char *buf = arena_alloc(arena, cap);
+    if (!buf) {
+        reply_printf(client_fd, "[MemoraDB: ERROR] out of memory\r\n");
+        return;
+    }
+    size_t len = (size_t)snprintf(buf, cap, "*%zu\r\n", n * 2);
+    for (size_t i = 0; i < n; i++) {
+        const char *more = keys[i].len > HOTKEYS_KEY_MAX ? "..." : "";
+        len += (size_t)snprintf(buf + len, cap - len, "$%zu\r\n%s%s\r\n:%.0f\r\n",
+                                strlen(keys[i].key) + strlen(more), keys[i].key, more, keys[i].ops_per_sec);
+    }
+    reply_write(client_fd, buf, len);
+}
+
+//-- Feed the hot-key sampler with every key a command touches --//
+static void record_keys(enum command_t cmd, char *tokens[], int token_count) {
+    int step = 1, last = token_count;
+    switch (cmd) {
+    case CMD_PING:
+    case CMD_ECHO:
+    case CMD_INFO:
+    case CMD_SCAN:
+    case CMD_KEYS:
+    case CMD_FLUSHALL:
+    case CMD_FLUSHDB:
+    case CMD_MEMORY:
+    case CMD_HOTKEYS:
+    case CMD_UNKNOWN:
+        return;
+    case CMD_DEL:
+    case CMD_UNLINK:
+    case CMD_MGET:
+        break;
+    case CMD_MSET:
+    case CMD_MSETNX:
+        step = 2;
+        break;
+    default:
+        last = token_count > 1 ? 2 : 1;
+        break;
+    }
+    for (int i = 1; i < last; i += step) {
+        hotkeys_record(tokens[i], strlen(tokens[i]));
+    }
+}
+
+//-- Commands that can add keys or bytes; they make room under maxmemory first --//
+static int command_may_grow(enum command_t cmd) {
+    switch (cmd) {
+    case CMD_SET:
+    case CMD_MSET:
+    case CMD_MSETNX:
+    case CMD_RPUSH:
+    case CMD_LPUSH:
+    case CMD_INCR:
+    case CMD_DECR:
+    case CMD_INCRBY:
+    case CMD_DECRBY:
+    case CMD_INCRBYFLOAT:
+    case CMD_EXPIRE:
+    case CMD_PEXPIRE:
+    case CMD_EXPIREAT:
+    case CMD_PEXPIREAT:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static void execute_command(int client_fd, char * tokens[], int token_count, Arena *arena){
     if(token_count == 0){
-        dprintf(client_fd, "[MemoraDB: ERROR] Empty Command\n");
+        reply_printf(client_fd, "[MemoraDB: ERROR] Empty Command\n");
         return;
     }
 
     enum command_t cmd = identify_command(tokens[0]);
+    record_keys(cmd, tokens, token_count);
+    if (command_may_grow(cmd) && evict_make_room() != 0) {
+        reply_printf(client_fd, "[MemoraDB: ERROR] OOM command not allowed when used memory > 'maxmemory'\r\n");
+        return;
+    }
 
     switch (cmd)
     {
     case CMD_PING:
-        dprintf(client_fd, "+PONG\r\n");
+        reply_shared(client_fd, REPLY_PONG);
         break;
     case CMD_ECHO:
         if(token_count < 2){
-            dprintf(client_fd, "[MemoraDB: WARN] ECHO needs one argument\n");
+            reply_printf(client_fd, "[MemoraDB: WARN] ECHO needs one argument\n");
         } else {
-            dprintf(client_fd, "$%lu\r\n%s\r\n", strlen(tokens[1]), tokens[1]);
+            reply_bulk(client_fd, tokens[1], strlen(tokens[1]));
         }
         break;
     case CMD_SET:
         if (token_count < 3) {
-            dprintf(client_fd, "[MemoraDB: WARN] SET needs key and value\r\n");
+            reply_printf(client_fd, "[MemoraDB: WARN] SET needs key and value\r\n");
         } else {
-            long long px = 0;
-            if (token_count >= 5 && strcasecmp(tokens[3], "PX") == 0) {
-                px = atoll(tokens[4]);
-            }
-            set_value(tokens[1], tokens[2], px);
-            dprintf(client_fd, "+OK\r\n");
+            set_command(client_fd, tokens, token_count);
         }
         break;
     case CMD_GET:
         if(token_count < 2){
-            dprintf(client_fd, "[MemoraDB: WARN] GET needs key\r\n");
+            reply_printf(client_fd, "[MemoraDB: WARN] GET needs key\r\n");
         } else {
-            const char *value = get_value(tokens[1]);
-            if(value)
-                dprintf(client_fd, "$%lu\r\n%s\r\n", strlen(value), value);
+            StringValue value;
+            if (!get_string(tokens[1], &value))
+                reply_shared(client_fd, REPLY_NULL_BULK);
+            else if (value.is_int)
+                reply_bulk_integer(client_fd, value.int_value);
             else
-                dprintf(client_fd, "$-1\r\n");
+                reply_bulk(client_fd, value.ptr, value.len);
         }
         break;
     case CMD_RPUSH:
         if (token_count < 3) {
-            dprintf(client_fd, "[MemoraDB: WARN] RPUSH needs key and at least one value\r\n");
+            reply_printf(client_fd, "[MemoraDB: WARN] RPUSH needs key and at least one value\r\n");
         } else {
-            List *list = get_or_create_list(tokens[1]);
+            StripeLock *lock;
+            List *list = lock_list(tokens[1], 1, &lock);
             if (!list) {
-                dprintf(client_fd, "[MemoraDB: ERROR] could not create list\r\n");
+                stripe_lock_release(lock);
+                reply_printf(client_fd, "[MemoraDB: ERROR] could not create list\r\n");
                 break;
             }
 
@@ -127,17 +816,20 @@ void dispatch_command(int client_fd, char * tokens[], int token_count){
                     total_elements = new_len;
                 }
             }
+            stripe_lock_release(lock);
 
-            dprintf(client_fd, ":%zu\r\n", total_elements);
+            reply_integer(client_fd, (long long)total_elements);
         }
         break;
     case CMD_LPUSH:
         if (token_count < 3) {
-            dprintf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'LPUSH'\r\n");
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'LPUSH'\r\n");
         } else {
-            List *list = get_or_create_list(tokens[1]);
+            StripeLock *lock;
+            List *list = lock_list(tokens[1], 1, &lock);
             if (!list) {
-                dprintf(client_fd, "[MemoraDB: ERROR] could not create list\r\n");
+                stripe_lock_release(lock);
+                reply_printf(client_fd, "[MemoraDB: ERROR] could not create list\r\n");
                 break;
             }
 
@@ -148,81 +840,80 @@ void dispatch_command(int client_fd, char * tokens[], int token_count){
                     total_elements = new_len;
                 }
             }
+            stripe_lock_release(lock);
 
-            dprintf(client_fd, ":%zu\r\n", total_elements);
+            reply_integer(client_fd, (long long)total_elements);
         }
         break;
     case CMD_LRANGE:
         if (token_count < 4) {
-            dprintf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'LRANGE'\r\n");
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'LRANGE'\r\n");
         } else {
             int start = atoi(tokens[2]);
             int end = atoi(tokens[3]);
             
-            List *list = get_list_if_exists(tokens[1]);
+            //-- list_range copies into the arena, so the stripe is only held for the walk --//
+            StripeLock *lock;
+            List *list = lock_list(tokens[1], 0, &lock);
             int result_count = 0;
             char **elements = NULL;
             if (list) {
-                elements = list_range(list, start, end, &result_count);
+                elements = list_range(list, start, end, &result_count, arena);
             }
+            stripe_lock_release(lock);
             
             if (elements) {
-                dprintf(client_fd, "*%d\r\n", result_count);
-                for (int i = 0; i < result_count; i++) {
-                    dprintf(client_fd, "$%lu\r\n%s\r\n", strlen(elements[i]), elements[i]);
-                    free(elements[i]);
-                }
-                free(elements);
+                reply_bulk_array(client_fd, elements, (size_t)result_count, arena);
             } else {
-                dprintf(client_fd, "*0\r\n");
+                reply_shared(client_fd, REPLY_EMPTY_ARRAY);
             }
         }
         break;
     case CMD_LLEN:
         if (token_count < 2) {
-            dprintf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'LLEN'\r\n");
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'LLEN'\r\n");
         } else {
-            List *list = get_list_if_exists(tokens[1]);
+            StripeLock *lock;
+            List *list = lock_list(tokens[1], 0, &lock);
             int length = 0;
             if (list) {
                 length = list_length(list);
             }
-            dprintf(client_fd, ":%d\r\n", length);
+            stripe_lock_release(lock);
+            reply_integer(client_fd, length);
         }
         break;
     case CMD_LPOP:
         if (token_count == 2) {
-            List *list = get_list_if_exists(tokens[1]);
+            StripeLock *lock;
+            List *list = lock_list(tokens[1], 0, &lock);
             char *popped = lpop_element(list);
+            stripe_lock_release(lock);
             if (popped) {
-                dprintf(client_fd, "$%lu\r\n%s\r\n", strlen(popped), popped);
-                free(popped);
+                reply_bulk(client_fd, popped, strlen(popped));
+                mem_free_str(popped);
             } else {
-                dprintf(client_fd, "$-1\r\n");
+                reply_shared(client_fd, REPLY_NULL_BULK);
             }
         } else if (token_count == 3) {
-            List *list = get_list_if_exists(tokens[1]);
             int count = atoi(tokens[2]);
             if (count <= 0) {
-                dprintf(client_fd, "*0\r\n");
+                reply_shared(client_fd, REPLY_EMPTY_ARRAY);
             } else {
                 int actual_count = 0;
-                char **popped_elements = lpop_multiple(list, count, &actual_count);
-
-                dprintf(client_fd, "*%d\r\n", actual_count);
-                for (int i = 0; i < actual_count; i++) {
-                    dprintf(client_fd, "$%lu\r\n%s\r\n", strlen(popped_elements[i]), popped_elements[i]);
-                    free(popped_elements[i]);
-                }
-                free(popped_elements);
+                StripeLock *lock;
+                List *list = lock_list(tokens[1], 0, &lock);
+                char **popped_elements = lpop_multiple(list, count, &actual_count, arena);
+                stripe_lock_release(lock);
+                reply_bulk_array(client_fd, popped_elements, (size_t)actual_count, arena);
             }
         } else {
-            dprintf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'LPOP'\r\n");
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'LPOP'\r\n");
         }
         break;
     case CMD_BLPOP: {
         if (token_count != 3) {
-            dprintf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'BLPOP'\r\n");
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'BLPOP'\r\n");
             break;
         }
 
@@ -231,34 +922,39 @@ void dispatch_command(int client_fd, char * tokens[], int token_count){
         long long start_time = current_millis();
         long long timeout_ms = (long long)(timeout_sec * 1000);
 
-        List *list = get_list_if_exists(list_name);
         char *element = NULL;
 
         while (1) {
+            //-- Re-fetch each round: the list may be created or replaced while we wait --//
+            StripeLock *lock;
+            List *list = lock_list(list_name, 0, &lock);
             element = lpop_element(list);
+            stripe_lock_release(lock);
             if (element != NULL) {
-                dprintf(client_fd, "*2\r\n$%lu\r\n%s\r\n$%lu\r\n%s\r\n",
-                        strlen(list_name), list_name,
-                        strlen(element), element);
-                free(element);
+                char *reply[2] = { (char *)list_name, element };
+                reply_bulk_array(client_fd, reply, 2, arena);
+                mem_free_str(element);
                 break;
             }
 
             long long elapsed = current_millis() - start_time;
 
             if (timeout_sec == 0.0 || elapsed < timeout_ms) {
+                //-- Never sleep inside an epoch: it would stall reclamation for everyone --//
+                epoch_exit();
                 usleep(100 * 1000);
+                epoch_enter();
                 continue;
             }
 
-            dprintf(client_fd, "$-1\r\n");
+            reply_shared(client_fd, REPLY_NULL_BULK);
             break;
         }
         break;
     }
     case CMD_DEL:
         if (token_count < 2) {
-            dprintf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'DEL'\r\n");
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'DEL'\r\n");
         } else {
             int deleted_count = 0;
             /* delete each key provided */
@@ -267,19 +963,167 @@ void dispatch_command(int client_fd, char * tokens[], int token_count){
                     deleted_count++;
                 }
             }
-            dprintf(client_fd, ":%d\r\n", deleted_count);
+            reply_integer(client_fd, deleted_count);
+        }
+        break;
+    case CMD_UNLINK:
+        if (token_count < 2) {
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'UNLINK'\r\n");
+        } else {
+            int unlinked = 0;
+            for (int i = 1; i < token_count; i++) {
+                unlinked += unlink_key(tokens[i]);
+            }
+            reply_integer(client_fd, unlinked);
+        }
+        break;
+    case CMD_FLUSHALL:
+    case CMD_FLUSHDB:
+        //-- One keyspace, so FLUSHDB and FLUSHALL are the same --//
+        if (token_count > 2) {
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for '%s'\r\n", tokens[0]);
+        } else if (token_count == 2 && strcasecmp(tokens[1], "ASYNC") != 0
+                   && strcasecmp(tokens[1], "SYNC") != 0) {
+            reply_printf(client_fd, "[MemoraDB: ERROR] syntax error\r\n");
+        } else {
+            hashtable_flush(token_count == 2 && strcasecmp(tokens[1], "ASYNC") == 0);
+            reply_shared(client_fd, REPLY_OK);
         }
         break;
     case CMD_TYPE:
         if (token_count<2){
-            dprintf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'TYPE', the 'TYPE' command expects a key\r\n");
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'TYPE', the 'TYPE' command expects a key\r\n");
         }else{
             const char *type = get_type(tokens[1]); 
-            dprintf(client_fd, "+%s\r\n", type); 
+            reply_status(client_fd, type);
+        }
+        break;
+    case CMD_INCR:
+    case CMD_DECR:
+    case CMD_INCRBY:
+    case CMD_DECRBY:
+        incr_command(client_fd, cmd, tokens, token_count);
+        break;
+    case CMD_INCRBYFLOAT:
+        if (token_count != 3) {
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'INCRBYFLOAT'\r\n");
+        } else {
+            long double delta;
+            char out[LD_STR_SIZE];
+            size_t out_len = 0;
+            incr_status_t status = INCR_NOT_FLOAT;
+            if (string2ld(tokens[2], strlen(tokens[2]), &delta)) {
+                status = incr_by_float(tokens[1], delta, out, &out_len);
+            }
+            if (status == INCR_OK)
+                reply_bulk(client_fd, out, out_len);
+            else
+                reply_incr_error(client_fd, status);
+        }
+        break;
+    case CMD_MGET:
+        if (token_count < 2) {
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'MGET'\r\n");
+        } else {
+            mget_command(client_fd, tokens, token_count, arena);
+        }
+        break;
+    case CMD_MSET:
+    case CMD_MSETNX:
+        if (token_count < 3 || token_count % 2 == 0) {
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for '%s'\r\n", tokens[0]);
+        } else {
+            mset_command(client_fd, tokens, token_count, cmd == CMD_MSETNX, arena);
+        }
+        break;
+    case CMD_EXPIRE:
+    case CMD_PEXPIRE:
+    case CMD_EXPIREAT:
+    case CMD_PEXPIREAT:
+        expire_command(client_fd, cmd, tokens, token_count);
+        break;
+    case CMD_TTL:
+    case CMD_PTTL:
+        ttl_command(client_fd, cmd, tokens, token_count);
+        break;
+    case CMD_PERSIST:
+        if (token_count != 2) {
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'PERSIST'\r\n");
+        } else {
+            int rc = persist_key(tokens[1]);
+            if (rc < 0)
+                reply_printf(client_fd, "[MemoraDB: ERROR] out of memory\r\n");
+            else
+                reply_integer(client_fd, rc);
+        }
+        break;
+    case CMD_SCAN:
+        if (token_count < 2) {
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'SCAN'\r\n");
+        } else {
+            scan_command(client_fd, tokens, token_count, arena);
+        }
+        break;
+    case CMD_KEYS:
+        if (token_count != 2) {
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'KEYS'\r\n");
+        } else {
+            keys_command(client_fd, tokens[1], arena);
+        }
+        break;
+    case CMD_STRLEN:
+        if (token_count != 2) {
+            reply_printf(client_fd, "[MemoraDB: ERROR] wrong number of arguments for 'STRLEN'\r\n");
+        } else {
+            StringValue value;
+            char digits[LL_STR_SIZE];
+            if (get_string(tokens[1], &value))
+                reply_integer(client_fd, value.is_int ? (long long)ll2str(digits, value.int_value) : (long long)value.len);
+            else if (strcmp(get_type(tokens[1]), "list") == 0)
+                reply_printf(client_fd, "[MemoraDB: ERROR] WRONGTYPE Operation against a key holding the wrong kind of value\r\n");
+            else
+                reply_integer(client_fd, 0);
         }
         break;
+    case CMD_MEMORY:
+        memory_command(client_fd, tokens, token_count);
+        break;
+    case CMD_HOTKEYS:
+        hotkeys_command(client_fd, tokens, token_count, arena);
+        break;
+    case CMD_INFO: {
+        char info[INFO_BUFFER_SIZE];
+        size_t len = 0;
+        info_append(info, &len, "# Keyspace\r\nindex:%s\r\n", KEYSPACE_INDEX_NAME);
+        size_t ordered_keys, ordered_bytes;
+        hashtable_key_index_stats(&ordered_keys, &ordered_bytes);
+        info_append(info, &len, "ordered_index:%s\r\nordered_index_keys:%zu\r\nordered_index_bytes:%zu\r\n",
+                    hashtable_key_index_enabled() ? "on" : "off", ordered_keys, ordered_bytes);
+        info_locks(info, &len);
+        info_expiry(info, &len);
+        info_lazyfree(info, &len);
+        info_memory(info, &len);
+        info_defrag(info, &len);
+        info_eviction(info, &len);
+        info_hotkeys(info, &len);
+        reply_bulk(client_fd, info, len);
+        break;
+    }
     default:
-        dprintf(client_fd, "[MemoraDB: WARN] Unknown command '%s'\n", tokens[0]);
+        reply_printf(client_fd, "[MemoraDB: WARN] Unknown command '%s'\n", tokens[0]);
         break;
     }
 }
+
+void dispatch_command(int client_fd, char * tokens[], int token_count, Arena *arena){
+    //-- Values returned by the keyspace stay valid until the reply is copied out --//
+    reply_defer_begin();
+    epoch_enter();
+    execute_command(client_fd, tokens, token_count, arena);
+    epoch_exit();
+    //-- A slow reader only blocks this connection, never a grace period --//
+    reply_defer_flush(client_fd);
+    //-- Everything the command took from the arena dies with its reply --//
+    arena_reset(arena);
+    slab_thread_publish();
+}
@@ -5,8 +5,8 @@
  * 
  * File                      : src/parser/parser.h
  * Module                    : RESP Protocol Parser
- * Last Updating Author      : youssefbouraoui1
- * Last Update               : 02/08/2026
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
  * Version                   : 1.0.0
  * 
  * Description:
@@ -25,6 +25,7 @@
 #include <stdlib.h>
 #include <strings.h>
 #include <unistd.h>
+#include "../utils/arena.h"
 
 /**
  * Command types supported by MemoraDB
@@ -42,6 +43,30 @@ enum command_t {
     CMD_LPOP,
     CMD_BLPOP,
     CMD_TYPE,
+    CMD_INFO,
+    CMD_SCAN,
+    CMD_KEYS,
+    CMD_INCR,
+    CMD_DECR,
+    CMD_INCRBY,
+    CMD_DECRBY,
+    CMD_INCRBYFLOAT,
+    CMD_MGET,
+    CMD_MSET,
+    CMD_MSETNX,
+    CMD_EXPIRE,
+    CMD_PEXPIRE,
+    CMD_EXPIREAT,
+    CMD_PEXPIREAT,
+    CMD_TTL,
+    CMD_PTTL,
+    CMD_PERSIST,
+    CMD_UNLINK,
+    CMD_FLUSHALL,
+    CMD_FLUSHDB,
+    CMD_STRLEN,
+    CMD_MEMORY,
+    CMD_HOTKEYS,
     CMD_UNKNOWN
 };
 
@@ -65,10 +90,15 @@ enum command_t identify_command(const char *cmd);
 
 /**
  * Dispatch and execute command based on tokens
+ * Runs inside an epoch critical section so values read from the
+ * keyspace cannot be freed while the reply is being written.
+ * Transient buffers (key arrays, range copies, reply text) come from
+ * the connection's arena, which is reset once the reply is sent.
  * @param client_fd Client socket file descriptor
  * @param tokens Array of parsed command tokens
  * @param token_count Number of tokens in array
+ * @param arena Per-connection scratch arena
  */
-void dispatch_command(int client_fd, char *tokens[], int token_count);
+void dispatch_command(int client_fd, char *tokens[], int token_count, Arena *arena);
 
 #endif // PARSER_H
@@ -0,0 +1,316 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/parser/reply.c
+ * Module                    : RESP Reply Encoder
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of the reply writers: a table of pre-serialized
+ *  replies, shared integer and header encodings, single-write bulk and
+ *  array replies, and the per-thread buffer that holds a command's
+ *  replies until its epoch is left.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#define _GNU_SOURCE
+#include "reply.h"
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+/*
+ * Most replies are one of a handful of constants, a small count or a
+ * short value. None of them goes through printf: constants are string
+ * literals, small numbers are copied out of tables rendered once, and
+ * everything else is built by hand with ll2str() into a buffer that is
+ * handed to the kernel in one call.
+ */
+
+#define HEADER_STRIDE 8     //- ":9999\r\n" and "$1023\r\n" plus NUL -//
+
+#define SHARED(s) { s, sizeof(s) - 1 }
+
+static const struct {
+    const char *buf;
+    size_t len;
+} shared_replies[REPLY_SHARED_COUNT] = {
+    [REPLY_OK] = SHARED("+OK\r\n"),
+    [REPLY_PONG] = SHARED("+PONG\r\n"),
+    [REPLY_NULL_BULK] = SHARED("$-1\r\n"),
+    [REPLY_EMPTY_ARRAY] = SHARED("*0\r\n"),
+    [REPLY_ZERO] = SHARED(":0\r\n"),
+    [REPLY_ONE] = SHARED(":1\r\n"),
+};
+
+static char integer_replies[SHARED_INTEGERS][HEADER_STRIDE];
+static char bulk_headers[REPLY_SHARED_HEADERS][HEADER_STRIDE];
+static char array_headers[REPLY_SHARED_HEADERS][HEADER_STRIDE];
+static unsigned char integer_lengths[SHARED_INTEGERS];
+static unsigned char header_lengths[REPLY_SHARED_HEADERS];  //- same for '$' and '*' -//
+static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
+
+static size_t encode_header(char *buf, char type, long long v) {
+    buf[0] = type;
+    size_t n = 1 + ll2str(buf + 1, v);
+    buf[n++] = '\r';
+    buf[n++] = '\n';
+    return n;
+}
+
+static void build_tables(void) {
+    for (int i = 0; i < SHARED_INTEGERS; i++) {
+        integer_lengths[i] = (unsigned char)encode_header(integer_replies[i], ':', i);
+    }
+    for (int i = 0; i < REPLY_SHARED_HEADERS; i++) {
+        header_lengths[i] = (unsigned char)encode_header(bulk_headers[i], '$', i);
+        encode_header(array_headers[i], '*', i);
+    }
+}
+
+/* ==================== Encoders ==================== */
+
+const char *resp_shared_header(char type, long long v, size_t *len) {
+    if (v < 0) return NULL;
+    pthread_once(&tables_once, build_tables);
+    if (type == ':' && v < SHARED_INTEGERS) {
+        if (len) *len = integer_lengths[v];
+        return integer_replies[v];
+    }
+    if ((type == '$' || type == '*') && v < REPLY_SHARED_HEADERS) {
+        if (len) *len = header_lengths[v];
+        return type == '$' ? bulk_headers[v] : array_headers[v];
+    }
+    return NULL;
+}
+
+size_t resp_encode_header(char *buf, char type, long long v) {
+    size_t len;
+    const char *shared = resp_shared_header(type, v, &len);
+    if (!shared) return encode_header(buf, type, v);
+    //-- Every shared encoding fits one 8-byte copy --//
+    memcpy(buf, shared, HEADER_STRIDE);
+    return len;
+}
+
+size_t resp_encode_bulk(char *buf, const char *s, size_t len) {
+    size_t n = resp_encode_header(buf, '$', (long long)len);
+    memcpy(buf + n, s, len);
+    n += len;
+    buf[n++] = '\r';
+    buf[n++] = '\n';
+    return n;
+}
+
+/* ==================== Deferred Output ==================== */
+
+typedef struct ReplyBuffer {
+    char *data;
+    size_t len;
+    size_t cap;
+    int active;              //- between reply_defer_begin() and reply_defer_flush() -//
+} ReplyBuffer;
+
+static __thread ReplyBuffer pending;
+static pthread_key_t pending_key;          //- frees a thread's buffer when the thread exits -//
+static pthread_once_t pending_once = PTHREAD_ONCE_INIT;
+
+static void free_pending(void *ptr) {
+    ReplyBuffer *buf = ptr;
+    free(buf->data);
+    buf->data = NULL;
+    buf->cap = 0;
+}
+
+static void make_pending_key(void) {
+    pthread_key_create(&pending_key, free_pending);
+}
+
+static void write_all(int client_fd, const char *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(client_fd, buf, len);
+        if (n <= 0) return;
+        buf += n;
+        len -= (size_t)n;
+    }
+}
+
+//-- Out of memory: send what is buffered, then buf, straight away --//
+static void append_pending(int client_fd, const char *buf, size_t len) {
+    if (pending.len + len > pending.cap) {
+        size_t cap = pending.cap ? pending.cap : REPLY_BUFFER_MIN;
+        while (cap < pending.len + len) cap *= 2;
+        char *data = realloc(pending.data, cap);
+        if (!data) {
+            write_all(client_fd, pending.data, pending.len);
+            pending.len = 0;
+            write_all(client_fd, buf, len);
+            return;
+        }
+        if (!pending.data) {
+            pthread_once(&pending_once, make_pending_key);
+            pthread_setspecific(pending_key, &pending);
+        }
+        pending.data = data;
+        pending.cap = cap;
+    }
+    memcpy(pending.data + pending.len, buf, len);
+    pending.len += len;
+}
+
+void reply_defer_begin(void) {
+    pending.active = 1;
+}
+
+void reply_defer_flush(int client_fd) {
+    pending.active = 0;
+    write_all(client_fd, pending.data, pending.len);
+    pending.len = 0;
+    //-- One huge reply does not pin its buffer for the life of the connection --//
+    if (pending.cap > REPLY_BUFFER_RETAIN) {
+        free(pending.data);
+        pending.data = NULL;
+        pending.cap = 0;
+    }
+}
+
+/* ==================== Replies ==================== */
+
+void reply_write(int client_fd, const char *buf, size_t len) {
+    if (pending.active) {
+        append_pending(client_fd, buf, len);
+    } else {
+        write_all(client_fd, buf, len);
+    }
+}
+
+void reply_printf(int client_fd, const char *fmt, ...) {
+    char buf[REPLY_INLINE_MAX];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n < 0) return;
+    if ((size_t)n < sizeof(buf)) {
+        reply_write(client_fd, buf, (size_t)n);
+        return;
+    }
+
+    char *big = malloc((size_t)n + 1);
+    if (!big) return;
+    va_start(ap, fmt);
+    vsnprintf(big, (size_t)n + 1, fmt, ap);
+    va_end(ap);
+    reply_write(client_fd, big, (size_t)n);
+    free(big);
+}
+
+void reply_shared(int client_fd, shared_reply_t reply) {
+    reply_write(client_fd, shared_replies[reply].buf, shared_replies[reply].len);
+}
+
+void reply_status(int client_fd, const char *s) {
+    size_t len = strlen(s);
+    char buf[REPLY_INLINE_MAX];
+    if (len + 3 > sizeof(buf)) {
+        reply_printf(client_fd, "+%s\r\n", s);
+        return;
+    }
+    buf[0] = '+';
+    memcpy(buf + 1, s, len);
+    buf[len + 1] = '\r';
+    buf[len + 2] = '\n';
+    reply_write(client_fd, buf, len + 3);
+}
+
+void reply_integer(int client_fd, long long v) {
+    size_t len;
+    const char *shared = resp_shared_header(':', v, &len);
+    if (shared) {
+        reply_write(client_fd, shared, len);
+        return;
+    }
+    char buf[REPLY_HEADER_SIZE];
+    reply_write(client_fd, buf, encode_header(buf, ':', v));
+}
+
+void reply_bulk(int client_fd, const char *s, size_t len) {
+    char buf[REPLY_HEADER_SIZE + REPLY_INLINE_MAX + 2];
+    if (len <= REPLY_INLINE_MAX) {
+        reply_write(client_fd, buf, resp_encode_bulk(buf, s, len));
+        return;
+    }
+
+    size_t header_len = resp_encode_header(buf, '$', (long long)len);
+    if (pending.active) {
+        append_pending(client_fd, buf, header_len);
+        append_pending(client_fd, s, len);
+        append_pending(client_fd, "\r\n", 2);
+        return;
+    }
+
+    //-- Large values are not copied: header, value and CRLF in one writev --//
+    struct iovec iov[3] = {
+        { buf, header_len },
+        { (void *)s, len },
+        { "\r\n", 2 },
+    };
+    int first = 0;
+    while (first < 3) {
+        ssize_t n = writev(client_fd, iov + first, 3 - first);
+        if (n <= 0) return;
+        while (first < 3 && (size_t)n >= iov[first].iov_len) {
+            n -= (ssize_t)iov[first].iov_len;
+            first++;
+        }
+        if (first < 3) {
+            iov[first].iov_base = (char *)iov[first].iov_base + n;
+            iov[first].iov_len -= (size_t)n;
+        }
+    }
+}
+
+void reply_bulk_integer(int client_fd, long long v) {
+    size_t len;
+    const char *digits = shared_integer(v, &len);
+    char tmp[LL_STR_SIZE];
+    if (!digits) {
+        len = ll2str(tmp, v);
+        digits = tmp;
+    }
+    reply_bulk(client_fd, digits, len);
+}
+
+void reply_bulk_array(int client_fd, char *const *items, size_t n, Arena *arena) {
+    size_t *lens = arena_alloc(arena, n * sizeof(size_t));
+    size_t total = REPLY_HEADER_SIZE;
+    for (size_t i = 0; lens && i < n; i++) {
+        lens[i] = strlen(items[i]);
+        total += lens[i] + REPLY_HEADER_SIZE + 2;
+    }
+    char *buf = lens ? arena_alloc(arena, total) : NULL;
+    if (!buf) {
+        char header[REPLY_HEADER_SIZE];
+        reply_write(client_fd, header, resp_encode_header(header, '*', (long long)n));
+        for (size_t i = 0; i < n; i++) {
+            reply_bulk(client_fd, items[i], strlen(items[i]));
+        }
+        return;
+    }
+
+    size_t pos = resp_encode_header(buf, '*', (long long)n);
+    for (size_t i = 0; i < n; i++) {
+        pos += resp_encode_bulk(buf + pos, items[i], lens[i]);
+    }
+    reply_write(client_fd, buf, pos);
+}
@@ -0,0 +1,149 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/parser/reply.h
+ * Module                    : RESP Reply Encoder
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for the server's reply writers: pre-encoded shared replies,
+ *  integer and bulk encoders, and the one-write helpers the commands
+ *  answer with.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef REPLY_H
+#define REPLY_H
+
+#include <stddef.h>
+#include "../utils/arena.h"
+#include "../utils/numeric.h"
+
+/* ==================== Tuning ==================== */
+/*
+ * ":<n>\r\n" is pre-encoded for n in [0, SHARED_INTEGERS) and the
+ * "$<n>\r\n" / "*<n>\r\n" headers for n in [0, REPLY_SHARED_HEADERS);
+ * anything else is encoded on the spot with ll2str().
+ */
+#define REPLY_SHARED_HEADERS 1024
+#define REPLY_HEADER_SIZE (LL_STR_SIZE + 3)    //- type byte, digits, CRLF -//
+#define REPLY_INLINE_MAX 512                   //- bulk replies up to this are copied into one buffer -//
+#define REPLY_BUFFER_MIN 4096                  //- first size of a thread's deferred reply buffer -//
+#define REPLY_BUFFER_RETAIN (1 << 20)          //- bigger buffers are freed after each flush -//
+
+typedef enum {
+    REPLY_OK,               // +OK
+    REPLY_PONG,             // +PONG
+    REPLY_NULL_BULK,        // $-1
+    REPLY_EMPTY_ARRAY,      // *0
+    REPLY_ZERO,             // :0
+    REPLY_ONE,              // :1
+    REPLY_SHARED_COUNT
+} shared_reply_t;
+
+/* ==================== Encoders ==================== */
+
+/**
+ * @brief Encode "<type><v>\r\n" (an integer reply or a bulk/array header).
+ *
+ * @param buf Destination, at least REPLY_HEADER_SIZE bytes; not NUL-terminated.
+ * @param type ':', '$' or '*'.
+ * @param v The number.
+ * @return Bytes written.
+ */
+size_t resp_encode_header(char *buf, char type, long long v);
+
+/**
+ * @brief Encode "$<len>\r\n<s>\r\n".
+ *
+ * @param buf Destination, at least len + REPLY_HEADER_SIZE + 2 bytes.
+ * @return Bytes written.
+ */
+size_t resp_encode_bulk(char *buf, const char *s, size_t len);
+
+/**
+ * @brief The pre-encoded "<type><v>\r\n" for a small v.
+ *
+ * @param len Receives the length (may be NULL).
+ * @return A static string, or NULL if v has no shared encoding.
+ */
+const char *resp_shared_header(char type, long long v, size_t *len);
+
+/* ==================== Deferred Output ==================== */
+/*
+ * A command runs inside an epoch, and a write to a client that stopped
+ * reading can block for as long as the client likes; if that happened
+ * inside the epoch, no grace period could end and nothing could be
+ * reclaimed. dispatch_command therefore defers: every reply the thread
+ * sends in between is copied into a per-thread buffer, and the buffer
+ * is written out once the epoch has been left.
+ */
+
+/**
+ * @brief Buffer this thread's replies from now on.
+ */
+void reply_defer_begin(void);
+
+/**
+ * @brief Stop buffering and write everything buffered since reply_defer_begin().
+ */
+void reply_defer_flush(int client_fd);
+
+/* ==================== Replies ==================== */
+
+/**
+ * @brief Write all of buf, retrying short writes; gives up on error.
+ *
+ * While replies are deferred, buf is copied into the thread's buffer.
+ */
+void reply_write(int client_fd, const char *buf, size_t len);
+
+/**
+ * @brief Send a printf-formatted reply (errors and warnings).
+ */
+void reply_printf(int client_fd, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+/**
+ * @brief Send one of the constant replies; nothing is formatted.
+ */
+void reply_shared(int client_fd, shared_reply_t reply);
+
+/**
+ * @brief Send "+<s>\r\n".
+ */
+void reply_status(int client_fd, const char *s);
+
+/**
+ * @brief Send ":<v>\r\n".
+ */
+void reply_integer(int client_fd, long long v);
+
+/**
+ * @brief Send a bulk string in a single write.
+ *
+ * Short values are copied behind a shared header into one buffer;
+ * longer ones go out with writev() straight from where they live,
+ * unless replies are deferred.
+ */
+void reply_bulk(int client_fd, const char *s, size_t len);
+
+/**
+ * @brief Send "$<len>\r\n<v>\r\n" for an integer-encoded string value.
+ */
+void reply_bulk_integer(int client_fd, long long v);
+
+/**
+ * @brief Send "*<n>\r\n" and one bulk string per item, in a single write.
+ *
+ * The reply is assembled in the connection's arena; if that fails it
+ * falls back to one write per item.
+ */
+void reply_bulk_array(int client_fd, char *const *items, size_t n, Arena *arena);
+
+#endif // REPLY_H
@@ -5,8 +5,8 @@
  *
  * File                      : src/server/server.c
  * Module                    : MemoraDB Server
- * Last Updating Author      : m0hamed541
- * Last Update               : 03/08/2026
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
  * Version                   : 1.0.0
  *
  * Description:
@@ -20,6 +20,13 @@
 #include "server.h"
 #include "../utils/log.h"
 #include "../utils/hashTable.h"
+#include "../utils/expire.h"
+#include "../utils/lazyfree.h"
+#include "../utils/defrag.h"
+#include "../utils/hugePages.h"
+#include "../utils/evict.h"
+#include "../utils/hotKeys.h"
+#include "../utils/monoClock.h"
 #include "../parser/parser.h"
 #include "../utils/logo.h"
 
@@ -33,6 +40,8 @@ void *handle_client(void *arg) {
 
     char buffer[BUFFER_SIZE];
     char *tokens[MAX_TOKENS];
+    Arena scratch;
+    arena_init(&scratch);
 
     while (1) {
         ssize_t bytes = recv(client_fd, buffer, sizeof(buffer)-1, 0);
@@ -45,27 +54,50 @@ void *handle_client(void *arg) {
             dprintf(client_fd, "[MemoraDB: WARN] Invalid RESP format\r\n");
             continue;
         }
-        dispatch_command(client_fd, tokens, token_count);
+        dispatch_command(client_fd, tokens, token_count, &scratch);
     }
 
+    arena_destroy(&scratch);
     close(client_fd);
     log_message(LOG_INFO, "Client %s disconnected on port %d", client_ip, client_port);
     return NULL;
 }
 
-static int parse_port_env(const char *name, int def_port) {
+static int parse_int_env(const char *name, int def, long min, long max) {
     const char *s = getenv(name);
-    if (!s || !*s) return def_port;
+    if (!s || !*s) return def;
     char *end = NULL;
     long v = strtol(s, &end, 10);
-    if (end == s || *end != '\0' || v < 1 || v > 65535) {
-        log_message(LOG_WARN, "Invalid %s='%s', falling back to %d", name, s, def_port);
-        return def_port;
+    if (end == s || *end != '\0' || v < min || v > max) {
+        log_message(LOG_WARN, "Invalid %s='%s', falling back to %d", name, s, def);
+        return def;
     }
     return (int)v;
 }
 
+static int parse_port_env(const char *name, int def_port) {
+    return parse_int_env(name, def_port, 1, 65535);
+}
+
 #ifndef TESTING
+//-- A byte count with an optional kb/mb/gb suffix, as in "512mb" --//
+static size_t parse_bytes_env(const char *name, size_t def) {
+    const char *s = getenv(name);
+    if (!s || !*s) return def;
+    char *end = NULL;
+    unsigned long long v = strtoull(s, &end, 10);
+    unsigned long long unit = 1;
+    if (strcasecmp(end, "kb") == 0) unit = 1ULL << 10;
+    else if (strcasecmp(end, "mb") == 0) unit = 1ULL << 20;
+    else if (strcasecmp(end, "gb") == 0) unit = 1ULL << 30;
+    else if (*end != '\0') end = NULL;
+    if (!end || end == s || *s == '-' || v > SIZE_MAX / unit) {
+        log_message(LOG_WARN, "Invalid %s='%s', falling back to %zu", name, s, def);
+        return def;
+    }
+    return (size_t)(v * unit);
+}
+
 int main() {
     setbuf(stdout, NULL);
     setbuf(stderr, NULL);
@@ -75,8 +107,62 @@ int main() {
 
     log_message(LOG_INFO, "MemoraDB Server started successfully.");
 
+    if (mono_clock_start() != 0) {
+        log_message(LOG_WARN, "Failed to start the clock ticker, reading the clock directly");
+    }
+    //-- Before the first storage allocation: the mode is fixed once used --//
+    const char *huge = getenv("MEMORADB_HUGEPAGES");
+    if (huge && *huge) {
+        hugepages_mode_t mode;
+        if (hugepages_parse(huge, &mode) != 0) {
+            log_message(LOG_WARN, "Invalid MEMORADB_HUGEPAGES='%s', falling back to off", huge);
+        } else {
+            hugepages_set_mode(mode);
+        }
+    }
     hashtable_lock_init();
 
+    int hz = parse_int_env("MEMORADB_HZ", EXPIRE_DEFAULT_HZ, 1, 500);
+    if (expire_start(hz) != 0) {
+        log_message(LOG_WARN, "Failed to start the active expiry thread");
+    }
+    if (lazyfree_start() != 0) {
+        log_message(LOG_WARN, "Failed to start the lazyfree thread, freeing large values inline");
+    }
+    hashtable_set_lazy_user_del(parse_int_env("MEMORADB_LAZYFREE_DEL", 0, 0, 1));
+    if (parse_int_env("MEMORADB_ORDERED_INDEX", 0, 0, 1) && hashtable_set_key_index(1) != 0) {
+        log_message(LOG_WARN, "Failed to build the ordered key index, prefix scans walk the whole table");
+    }
+
+    if (parse_int_env("MEMORADB_ACTIVEDEFRAG", 0, 0, 1)) {
+        DefragConfig dcfg;
+        defrag_default_config(&dcfg);
+        dcfg.threshold_lower = parse_int_env("MEMORADB_DEFRAG_THRESHOLD_LOWER", dcfg.threshold_lower, 0, 1000);
+        dcfg.threshold_upper = parse_int_env("MEMORADB_DEFRAG_THRESHOLD_UPPER", dcfg.threshold_upper, 0, 1000);
+        dcfg.ignore_bytes = (size_t)parse_int_env("MEMORADB_DEFRAG_IGNORE_MB",
+                                                  (int)(dcfg.ignore_bytes >> 20), 0, 1 << 20) << 20;
+        dcfg.cycle_min = parse_int_env("MEMORADB_DEFRAG_CYCLE_MIN", dcfg.cycle_min, 1, 99);
+        dcfg.cycle_max = parse_int_env("MEMORADB_DEFRAG_CYCLE_MAX", dcfg.cycle_max, 1, 99);
+        defrag_configure(&dcfg);
+        if (defrag_start(hz) != 0) {
+            log_message(LOG_WARN, "Failed to start the active defrag thread");
+        }
+    }
+
+    EvictConfig ecfg;
+    evict_default_config(&ecfg);
+    ecfg.maxmemory = parse_bytes_env("MEMORADB_MAXMEMORY", ecfg.maxmemory);
+    const char *policy = getenv("MEMORADB_MAXMEMORY_POLICY");
+    if (policy && *policy && evict_parse_policy(policy, &ecfg.policy) != 0) {
+        log_message(LOG_WARN, "Invalid MEMORADB_MAXMEMORY_POLICY='%s', falling back to %s",
+                    policy, evict_policy_name(ecfg.policy));
+    }
+    ecfg.samples = parse_int_env("MEMORADB_MAXMEMORY_SAMPLES", ecfg.samples, 1, 64);
+    evict_configure(&ecfg);
+    hashtable_set_lfu_params(parse_int_env("MEMORADB_LFU_LOG_FACTOR", LFU_DEFAULT_LOG_FACTOR, 0, 1000000),
+                             parse_int_env("MEMORADB_LFU_DECAY_TIME", LFU_DEFAULT_DECAY_TIME, 0, 1000000));
+    hotkeys_set_sample_rate(parse_int_env("MEMORADB_HOTKEYS_SAMPLE_RATE", HOTKEYS_DEFAULT_SAMPLE_RATE, 0, 1000000));
+
     int server_fd;
     socklen_t client_addr_len;
     struct sockaddr_in client_addr;
@@ -5,8 +5,8 @@
  * 
  * File                      : src/server/server.h
  * Module                    : MemoraDB Server Header
- * Last Updating Author      : youssefbouraoui1
- * Last Update               : 02/02/2026
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
  * Version                   : 1.0.0
  * 
  * Description:
@@ -34,8 +34,8 @@
 #include <signal.h>
 
 //-- Config Constants --//
-#define BUFFER_SIZE 1024
-#define MAX_TOKENS 16
+#define BUFFER_SIZE 65536   //- one request per recv(), large enough for a few hundred keys -//
+#define MAX_TOKENS 1024     //- MGET/MSET take many arguments -//
 #define DEFAULT_PORT 6379
 #define CONNECTION_BACKLOG 5
 #define RESP_TERMINATOR_LEN 2
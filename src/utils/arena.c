@@ -0,0 +1,107 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/arena.c
+ * Module                    : Scratch Arena
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of the per-connection bump arena.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include "arena.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_ALIGN 16
+
+void arena_init(Arena *arena) {
+    arena->first = NULL;
+    arena->current = NULL;
+    arena->used = 0;
+    arena->retained = 0;
+}
+
+static ArenaBlock *new_block(size_t size) {
+    if (size < ARENA_BLOCK_SIZE) size = ARENA_BLOCK_SIZE;
+    ArenaBlock *block = malloc(sizeof(ArenaBlock) + size);
+    if (!block) return NULL;
+    block->next = NULL;
+    block->size = size;
+    return block;
+}
+
+void *arena_alloc(Arena *arena, size_t size) {
+    size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    if (size == 0) size = ARENA_ALIGN;
+
+    ArenaBlock *block = arena->current;
+    if (block && block->size - arena->used >= size) {
+        void *ptr = block->data + arena->used;
+        arena->used += size;
+        return ptr;
+    }
+
+    //-- Reuse the next block kept from earlier commands if it is big enough --//
+    ArenaBlock *next = block ? block->next : arena->first;
+    if (!next || next->size < size) {
+        ArenaBlock *fresh = new_block(size);
+        if (!fresh) return NULL;
+        fresh->next = next;
+        if (block) {
+            block->next = fresh;
+        } else {
+            arena->first = fresh;
+        }
+        arena->retained += fresh->size;
+        next = fresh;
+    }
+    arena->current = next;
+    arena->used = size;
+    return next->data;
+}
+
+char *arena_strndup(Arena *arena, const char *s, size_t len) {
+    char *copy = arena_alloc(arena, len + 1);
+    if (!copy) return NULL;
+    memcpy(copy, s, len);
+    copy[len] = '\0';
+    return copy;
+}
+
+void arena_reset(Arena *arena) {
+    if (arena->retained > ARENA_RETAIN_MAX && arena->first) {
+        //-- A huge reply grew the chain: keep only the first block, unless it is the huge one --//
+        ArenaBlock *block = arena->first->next;
+        while (block) {
+            ArenaBlock *next = block->next;
+            free(block);
+            block = next;
+        }
+        arena->first->next = NULL;
+        arena->retained = arena->first->size;
+        if (arena->retained > ARENA_RETAIN_MAX) {
+            free(arena->first);
+            arena_init(arena);
+        }
+    }
+    arena->current = arena->first;
+    arena->used = 0;
+}
+
+void arena_destroy(Arena *arena) {
+    ArenaBlock *block = arena->first;
+    while (block) {
+        ArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    arena_init(arena);
+}
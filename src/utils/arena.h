@@ -0,0 +1,77 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/arena.h
+ * Module                    : Scratch Arena
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for the per-connection bump arena that holds allocations
+ *  living only as long as one command: result arrays, copied elements
+ *  and reply formatting buffers.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+#define ARENA_BLOCK_SIZE (16 * 1024)       //- smallest block requested from malloc -//
+#define ARENA_RETAIN_MAX (1024 * 1024)     //- blocks kept across resets beyond this are freed -//
+
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;
+    size_t size;                           //- usable bytes in data[] -//
+    char data[] __attribute__((aligned(16)));
+} ArenaBlock;
+
+/*
+ * Blocks form a chain that is reused in order after a reset, so a
+ * connection that keeps sending similar commands stops calling malloc.
+ */
+typedef struct Arena {
+    ArenaBlock *first;
+    ArenaBlock *current;
+    size_t used;                           //- bytes taken from current -//
+    size_t retained;                       //- bytes held in all blocks -//
+} Arena;
+
+/**
+ * @brief Initialize an empty arena (nothing is allocated until first use).
+ */
+void arena_init(Arena *arena);
+
+/**
+ * @brief Bump-allocate size bytes, 16-byte aligned.
+ *
+ * @return The memory, valid until the next arena_reset(), or NULL when
+ *         out of memory.
+ */
+void *arena_alloc(Arena *arena, size_t size);
+
+/**
+ * @brief Copy len bytes of s into the arena and NUL-terminate them.
+ */
+char *arena_strndup(Arena *arena, const char *s, size_t len);
+
+/**
+ * @brief Release everything allocated since the last reset.
+ *
+ * O(1): the cursor returns to the first block. Only when more than
+ * ARENA_RETAIN_MAX bytes are held are the extra blocks freed.
+ */
+void arena_reset(Arena *arena);
+
+/**
+ * @brief Free every block.
+ */
+void arena_destroy(Arena *arena);
+
+#endif // ARENA_H
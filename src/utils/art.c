@@ -0,0 +1,690 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/art.c
+ * Module                    : Adaptive Radix Tree
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of the adaptive radix tree (Leis et al., ICDE 2013):
+ *  four node sizes, path compression with a bounded stored prefix, and
+ *  ordered walks that start at a lower bound.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include "art.h"
+#include "memAlloc.h"
+#include <string.h>
+
+typedef enum {
+    NODE4 = 1,
+    NODE16,
+    NODE48,
+    NODE256
+} node_type_t;
+
+typedef struct Node {
+    uint8_t type;
+    uint16_t children;
+    uint32_t partial_len;                 //- full compressed path length -//
+    unsigned char partial[ART_MAX_PREFIX]; //- its first ART_MAX_PREFIX bytes -//
+} Node;
+
+//- Node4 and Node16 keep keys[] sorted -//
+typedef struct Node4 {
+    Node n;
+    unsigned char keys[4];
+    void *child[4];
+} Node4;
+
+typedef struct Node16 {
+    Node n;
+    unsigned char keys[16];
+    void *child[16];
+} Node16;
+
+//- index[byte] is a slot in child[] plus one, 0 = no child -//
+typedef struct Node48 {
+    Node n;
+    unsigned char index[256];
+    void *child[48];
+} Node48;
+
+typedef struct Node256 {
+    Node n;
+    void *child[256];
+} Node256;
+
+typedef struct Leaf {
+    size_t len;
+    char key[];              //- NUL-terminated -//
+} Leaf;
+
+/* ==================== Helpers ==================== */
+
+//-- Leaves are told apart by the low pointer bit; mem_alloc is 16-byte aligned --//
+static inline int is_leaf(const void *p) {
+    return (uintptr_t)p & 1;
+}
+
+static inline Leaf *leaf_of(const void *p) {
+    return (Leaf *)((uintptr_t)p & ~(uintptr_t)1);
+}
+
+static inline void *leaf_ref(const Leaf *l) {
+    return (void *)((uintptr_t)l | 1);
+}
+
+//-- Byte i of a key as the tree indexes it: the terminating NUL is byte len --//
+static inline unsigned char key_byte(const char *key, size_t len, size_t i) {
+    return i < len ? (unsigned char)key[i] : 0;
+}
+
+static inline size_t min_size(size_t a, size_t b) {
+    return a < b ? a : b;
+}
+
+static int compare(const char *a, size_t alen, const char *b, size_t blen) {
+    int c = memcmp(a, b, min_size(alen, blen));
+    if (c) return c;
+    return alen < blen ? -1 : alen > blen;
+}
+
+static inline int leaf_matches(const Leaf *l, const char *key, size_t len) {
+    return l->len == len && memcmp(l->key, key, len) == 0;
+}
+
+static size_t node_size(uint8_t type) {
+    switch (type) {
+    case NODE4:  return sizeof(Node4);
+    case NODE16: return sizeof(Node16);
+    case NODE48: return sizeof(Node48);
+    default:     return sizeof(Node256);
+    }
+}
+
+static Node *alloc_node(ArtTree *t, uint8_t type) {
+    size_t size = node_size(type);
+    Node *n = mem_alloc(size);
+    if (!n) return NULL;
+    memset(n, 0, size);
+    n->type = type;
+    t->bytes += mem_alloc_size(size);
+    return n;
+}
+
+static void free_node(ArtTree *t, Node *n) {
+    size_t size = node_size(n->type);
+    t->bytes -= mem_alloc_size(size);
+    mem_free(n, size);
+}
+
+static Leaf *alloc_leaf(ArtTree *t, const char *key, size_t len) {
+    size_t size = sizeof(Leaf) + len + 1;
+    Leaf *l = mem_alloc(size);
+    if (!l) return NULL;
+    l->len = len;
+    memcpy(l->key, key, len);
+    l->key[len] = '\0';
+    t->bytes += mem_alloc_size(size);
+    return l;
+}
+
+static void free_leaf(ArtTree *t, Leaf *l) {
+    size_t size = sizeof(Leaf) + l->len + 1;
+    t->bytes -= mem_alloc_size(size);
+    mem_free(l, size);
+}
+
+//-- Everything but the type, for a node changing size --//
+static void copy_header(Node *dst, const Node *src) {
+    dst->children = src->children;
+    dst->partial_len = src->partial_len;
+    memcpy(dst->partial, src->partial, ART_MAX_PREFIX);
+}
+
+static void **find_child(Node *n, unsigned char c) {
+    switch (n->type) {
+    case NODE4: {
+        Node4 *p = (Node4 *)n;
+        for (int i = 0; i < n->children; i++) {
+            if (p->keys[i] == c) return &p->child[i];
+        }
+        break;
+    }
+    case NODE16: {
+        Node16 *p = (Node16 *)n;
+        for (int i = 0; i < n->children && p->keys[i] <= c; i++) {
+            if (p->keys[i] == c) return &p->child[i];
+        }
+        break;
+    }
+    case NODE48: {
+        Node48 *p = (Node48 *)n;
+        if (p->index[c]) return &p->child[p->index[c] - 1];
+        break;
+    }
+    default: {
+        Node256 *p = (Node256 *)n;
+        if (p->child[c]) return &p->child[c];
+        break;
+    }
+    }
+    return NULL;
+}
+
+//-- The smallest leaf below n, which holds the full path for prefixes longer than ART_MAX_PREFIX --//
+static const Leaf *minimum(const void *n) {
+    while (n && !is_leaf(n)) {
+        const Node *node = n;
+        int b = 0;
+        switch (node->type) {
+        case NODE4:
+            n = ((const Node4 *)node)->child[0];
+            break;
+        case NODE16:
+            n = ((const Node16 *)node)->child[0];
+            break;
+        case NODE48: {
+            const Node48 *p = (const Node48 *)node;
+            while (b < 256 && !p->index[b]) b++;
+            n = b < 256 ? p->child[p->index[b] - 1] : NULL;
+            break;
+        }
+        default: {
+            const Node256 *p = (const Node256 *)node;
+            while (b < 256 && !p->child[b]) b++;
+            n = b < 256 ? p->child[b] : NULL;
+            break;
+        }
+        }
+    }
+    return n ? leaf_of(n) : NULL;
+}
+
+//-- Matching bytes among the stored prefix (optimistic: the leaf has the last word) --//
+static size_t check_prefix(const Node *n, const char *key, size_t len, size_t depth) {
+    size_t remaining = depth <= len ? len + 1 - depth : 0;
+    size_t max = min_size(min_size(n->partial_len, ART_MAX_PREFIX), remaining);
+    size_t i = 0;
+    while (i < max && n->partial[i] == key_byte(key, len, depth + i)) i++;
+    return i;
+}
+
+//-- Matching bytes along the whole compressed path --//
+static size_t prefix_mismatch(const Node *n, const char *key, size_t len, size_t depth) {
+    size_t remaining = len + 1 - depth;
+    size_t i = check_prefix(n, key, len, depth);
+    if (i < ART_MAX_PREFIX || n->partial_len <= ART_MAX_PREFIX) return i;
+    const Leaf *l = minimum(n);
+    size_t max = min_size(n->partial_len, remaining);
+    while (i < max && (unsigned char)l->key[depth + i] == key_byte(key, len, depth + i)) i++;
+    return i;
+}
+
+/* ==================== Growing and Shrinking ==================== */
+
+static void add_sorted(Node *n, unsigned char *keys, void **child, unsigned char c, void *ptr) {
+    int i = 0;
+    while (i < n->children && keys[i] < c) i++;
+    memmove(keys + i + 1, keys + i, (size_t)(n->children - i));
+    memmove(child + i + 1, child + i, (size_t)(n->children - i) * sizeof(void *));
+    keys[i] = c;
+    child[i] = ptr;
+    n->children++;
+}
+
+//-- Add a child for byte c, moving n to the next size up if it is full; *ref points at n --//
+static int add_child(ArtTree *t, void **ref, Node *n, unsigned char c, void *ptr) {
+    switch (n->type) {
+    case NODE4: {
+        Node4 *p = (Node4 *)n;
+        if (n->children < 4) {
+            add_sorted(n, p->keys, p->child, c, ptr);
+            return 0;
+        }
+        Node16 *g = (Node16 *)alloc_node(t, NODE16);
+        if (!g) return -1;
+        copy_header(&g->n, n);
+        memcpy(g->keys, p->keys, sizeof(p->keys));
+        memcpy(g->child, p->child, sizeof(p->child));
+        *ref = g;
+        free_node(t, n);
+        add_sorted(&g->n, g->keys, g->child, c, ptr);
+        return 0;
+    }
+    case NODE16: {
+        Node16 *p = (Node16 *)n;
+        if (n->children < 16) {
+            add_sorted(n, p->keys, p->child, c, ptr);
+            return 0;
+        }
+        Node48 *g = (Node48 *)alloc_node(t, NODE48);
+        if (!g) return -1;
+        copy_header(&g->n, n);
+        for (int i = 0; i < 16; i++) {
+            g->index[p->keys[i]] = (unsigned char)(i + 1);
+            g->child[i] = p->child[i];
+        }
+        *ref = g;
+        free_node(t, n);
+        return add_child(t, ref, &g->n, c, ptr);
+    }
+    case NODE48: {
+        Node48 *p = (Node48 *)n;
+        if (n->children < 48) {
+            int pos = 0;
+            while (p->child[pos]) pos++;
+            p->child[pos] = ptr;
+            p->index[c] = (unsigned char)(pos + 1);
+            n->children++;
+            return 0;
+        }
+        Node256 *g = (Node256 *)alloc_node(t, NODE256);
+        if (!g) return -1;
+        copy_header(&g->n, n);
+        for (int b = 0; b < 256; b++) {
+            if (p->index[b]) g->child[b] = p->child[p->index[b] - 1];
+        }
+        *ref = g;
+        free_node(t, n);
+        return add_child(t, ref, &g->n, c, ptr);
+    }
+    default: {
+        Node256 *p = (Node256 *)n;
+        p->child[c] = ptr;
+        n->children++;
+        return 0;
+    }
+    }
+}
+
+//-- A Node4 down to one child is replaced by it, its path folded into the child's prefix --//
+static void collapse(ArtTree *t, void **ref, Node4 *p) {
+    void *only = p->child[0];
+    if (!is_leaf(only)) {
+        Node *c = only;
+        size_t prefix = p->n.partial_len;
+        if (prefix < ART_MAX_PREFIX) {
+            p->n.partial[prefix++] = p->keys[0];
+        }
+        if (prefix < ART_MAX_PREFIX) {
+            size_t sub = min_size(c->partial_len, ART_MAX_PREFIX - prefix);
+            memcpy(p->n.partial + prefix, c->partial, sub);
+            prefix += sub;
+        }
+        memcpy(c->partial, p->n.partial, min_size(prefix, ART_MAX_PREFIX));
+        c->partial_len += p->n.partial_len + 1;
+    }
+    *ref = only;
+    free_node(t, &p->n);
+}
+
+/*
+ * Remove the child in slot for byte c. Nodes shrink once they fall well
+ * below the smaller size, so a key added and removed at the boundary
+ * does not reallocate every time. A failed shrink keeps the bigger node.
+ */
+static void remove_child(ArtTree *t, void **ref, Node *n, unsigned char c, void **slot) {
+    switch (n->type) {
+    case NODE4: {
+        Node4 *p = (Node4 *)n;
+        int i = (int)(slot - p->child);
+        memmove(p->keys + i, p->keys + i + 1, (size_t)(n->children - 1 - i));
+        memmove(p->child + i, p->child + i + 1, (size_t)(n->children - 1 - i) * sizeof(void *));
+        n->children--;
+        if (n->children == 1) collapse(t, ref, p);
+        break;
+    }
+    case NODE16: {
+        Node16 *p = (Node16 *)n;
+        int i = (int)(slot - p->child);
+        memmove(p->keys + i, p->keys + i + 1, (size_t)(n->children - 1 - i));
+        memmove(p->child + i, p->child + i + 1, (size_t)(n->children - 1 - i) * sizeof(void *));
+        n->children--;
+        if (n->children <= 3) {
+            Node4 *s = (Node4 *)alloc_node(t, NODE4);
+            if (!s) break;
+            copy_header(&s->n, n);
+            memcpy(s->keys, p->keys, n->children);
+            memcpy(s->child, p->child, n->children * sizeof(void *));
+            *ref = s;
+            free_node(t, n);
+        }
+        break;
+    }
+    case NODE48: {
+        Node48 *p = (Node48 *)n;
+        p->child[p->index[c] - 1] = NULL;
+        p->index[c] = 0;
+        n->children--;
+        if (n->children <= 12) {
+            Node16 *s = (Node16 *)alloc_node(t, NODE16);
+            if (!s) break;
+            copy_header(&s->n, n);
+            int j = 0;
+            for (int b = 0; b < 256; b++) {
+                if (!p->index[b]) continue;
+                s->keys[j] = (unsigned char)b;
+                s->child[j++] = p->child[p->index[b] - 1];
+            }
+            *ref = s;
+            free_node(t, n);
+        }
+        break;
+    }
+    default: {
+        Node256 *p = (Node256 *)n;
+        p->child[c] = NULL;
+        n->children--;
+        if (n->children <= 37) {
+            Node48 *s = (Node48 *)alloc_node(t, NODE48);
+            if (!s) break;
+            copy_header(&s->n, n);
+            int j = 0;
+            for (int b = 0; b < 256; b++) {
+                if (!p->child[b]) continue;
+                s->child[j] = p->child[b];
+                s->index[b] = (unsigned char)(++j);
+            }
+            *ref = s;
+            free_node(t, n);
+        }
+        break;
+    }
+    }
+}
+
+/* ==================== Public API ==================== */
+
+void art_init(ArtTree *t) {
+    t->root = NULL;
+    t->size = 0;
+    t->bytes = 0;
+}
+
+static void free_subtree(ArtTree *t, void *n) {
+    if (!n) return;
+    if (is_leaf(n)) {
+        free_leaf(t, leaf_of(n));
+        return;
+    }
+    Node *node = n;
+    switch (node->type) {
+    case NODE4:
+        for (int i = 0; i < node->children; i++) free_subtree(t, ((Node4 *)node)->child[i]);
+        break;
+    case NODE16:
+        for (int i = 0; i < node->children; i++) free_subtree(t, ((Node16 *)node)->child[i]);
+        break;
+    case NODE48:
+        for (int i = 0; i < 48; i++) free_subtree(t, ((Node48 *)node)->child[i]);
+        break;
+    default:
+        for (int b = 0; b < 256; b++) free_subtree(t, ((Node256 *)node)->child[b]);
+        break;
+    }
+    free_node(t, node);
+}
+
+void art_clear(ArtTree *t) {
+    free_subtree(t, t->root);
+    t->root = NULL;
+    t->size = 0;
+}
+
+int art_insert(ArtTree *t, const char *key, size_t len) {
+    void **ref = &t->root;
+    size_t depth = 0;
+
+    for (;;) {
+        void *n = *ref;
+        if (!n) {
+            Leaf *l = alloc_leaf(t, key, len);
+            if (!l) return -1;
+            *ref = leaf_ref(l);
+            t->size++;
+            return 1;
+        }
+
+        if (is_leaf(n)) {
+            //-- Two keys now share this spot: split it with a Node4 over their common path --//
+            Leaf *old = leaf_of(n);
+            if (leaf_matches(old, key, len)) return 0;
+            Leaf *l = alloc_leaf(t, key, len);
+            Node4 *nn = l ? (Node4 *)alloc_node(t, NODE4) : NULL;
+            if (!nn) {
+                if (l) free_leaf(t, l);
+                return -1;
+            }
+            size_t lcp = 0;
+            while (key_byte(old->key, old->len, depth + lcp) == key_byte(key, len, depth + lcp)) lcp++;
+            nn->n.partial_len = (uint32_t)lcp;
+            memcpy(nn->n.partial, key + depth, min_size(lcp, ART_MAX_PREFIX));
+            add_sorted(&nn->n, nn->keys, nn->child, key_byte(old->key, old->len, depth + lcp), n);
+            add_sorted(&nn->n, nn->keys, nn->child, key_byte(key, len, depth + lcp), leaf_ref(l));
+            *ref = nn;
+            t->size++;
+            return 1;
+        }
+
+        Node *node = n;
+        if (node->partial_len) {
+            size_t diff = prefix_mismatch(node, key, len, depth);
+            if (diff < node->partial_len) {
+                //-- The key leaves the compressed path: split it where they part --//
+                Leaf *l = alloc_leaf(t, key, len);
+                Node4 *nn = l ? (Node4 *)alloc_node(t, NODE4) : NULL;
+                if (!nn) {
+                    if (l) free_leaf(t, l);
+                    return -1;
+                }
+                nn->n.partial_len = (uint32_t)diff;
+                memcpy(nn->n.partial, node->partial, min_size(diff, ART_MAX_PREFIX));
+                if (node->partial_len <= ART_MAX_PREFIX) {
+                    add_sorted(&nn->n, nn->keys, nn->child, node->partial[diff], node);
+                    node->partial_len -= (uint32_t)(diff + 1);
+                    memmove(node->partial, node->partial + diff + 1, node->partial_len);
+                } else {
+                    const Leaf *min = minimum(node);
+                    add_sorted(&nn->n, nn->keys, nn->child, (unsigned char)min->key[depth + diff], node);
+                    node->partial_len -= (uint32_t)(diff + 1);
+                    memcpy(node->partial, min->key + depth + diff + 1, min_size(node->partial_len, ART_MAX_PREFIX));
+                }
+                add_sorted(&nn->n, nn->keys, nn->child, key_byte(key, len, depth + diff), leaf_ref(l));
+                *ref = nn;
+                t->size++;
+                return 1;
+            }
+            depth += node->partial_len;
+        }
+
+        unsigned char c = key_byte(key, len, depth);
+        void **child = find_child(node, c);
+        if (child) {
+            ref = child;
+            depth++;
+            continue;
+        }
+        Leaf *l = alloc_leaf(t, key, len);
+        if (!l) return -1;
+        if (add_child(t, ref, node, c, leaf_ref(l)) != 0) {
+            free_leaf(t, l);
+            return -1;
+        }
+        t->size++;
+        return 1;
+    }
+}
+
+int art_delete(ArtTree *t, const char *key, size_t len) {
+    void **ref = &t->root;
+    size_t depth = 0;
+
+    while (*ref) {
+        if (is_leaf(*ref)) {
+            //-- Only a leaf at the root gets here --//
+            Leaf *l = leaf_of(*ref);
+            if (!leaf_matches(l, key, len)) return 0;
+            *ref = NULL;
+            free_leaf(t, l);
+            t->size--;
+            return 1;
+        }
+
+        Node *node = *ref;
+        if (node->partial_len) {
+            if (check_prefix(node, key, len, depth) != min_size(node->partial_len, ART_MAX_PREFIX)) return 0;
+            depth += node->partial_len;
+        }
+        if (depth > len) return 0;
+        unsigned char c = key_byte(key, len, depth);
+        void **child = find_child(node, c);
+        if (!child) return 0;
+        if (is_leaf(*child)) {
+            Leaf *l = leaf_of(*child);
+            if (!leaf_matches(l, key, len)) return 0;
+            remove_child(t, ref, node, c, child);
+            free_leaf(t, l);
+            t->size--;
+            return 1;
+        }
+        ref = child;
+        depth++;
+    }
+    return 0;
+}
+
+int art_contains(const ArtTree *t, const char *key, size_t len) {
+    const void *n = t->root;
+    size_t depth = 0;
+    while (n) {
+        if (is_leaf(n)) return leaf_matches(leaf_of(n), key, len);
+        const Node *node = n;
+        if (node->partial_len) {
+            if (check_prefix(node, key, len, depth) != min_size(node->partial_len, ART_MAX_PREFIX)) return 0;
+            depth += node->partial_len;
+        }
+        if (depth > len) return 0;
+        void **child = find_child((Node *)node, key_byte(key, len, depth));
+        n = child ? *child : NULL;
+        depth++;
+    }
+    return 0;
+}
+
+/* ==================== Ordered Walks ==================== */
+
+typedef struct Walk {
+    const char *lo;          //- NULL = no lower bound -//
+    size_t lo_len;
+    int lo_exclusive;
+    const char *hi;          //- NULL = no upper bound -//
+    size_t hi_len;
+    const char *prefix;      //- NULL = no prefix filter -//
+    size_t prefix_len;
+    art_visit_fn fn;
+    void *ctx;
+    int result;              //- what fn returned when it stopped the walk -//
+} Walk;
+
+//-- 1 ends the walk: a bound was passed or fn asked to stop --//
+static int visit_leaf(Walk *w, const Leaf *l) {
+    if (w->lo) {
+        int c = compare(l->key, l->len, w->lo, w->lo_len);
+        if (c < 0 || (c == 0 && w->lo_exclusive)) return 0;
+    }
+    //-- Leaves come in order, so the first one out of range ends the walk --//
+    if (w->hi && compare(l->key, l->len, w->hi, w->hi_len) >= 0) return 1;
+    if (w->prefix && (l->len < w->prefix_len || memcmp(l->key, w->prefix, w->prefix_len) != 0)) return 1;
+    w->result = w->fn(l->key, l->len, w->ctx);
+    return w->result != 0;
+}
+
+/*
+ * In-order walk from depth. While bounded, every key below n shares
+ * lo's first depth bytes: subtrees whose path sorts below lo are skipped
+ * and only the child on lo's next byte stays bounded. Once a path sorts
+ * above lo, or lo runs out, the rest is walked unconditionally.
+ */
+static int walk(Walk *w, const void *n, size_t depth, int bounded) {
+    if (is_leaf(n)) return visit_leaf(w, leaf_of(n));
+
+    const Node *node = n;
+    if (bounded) {
+        const Leaf *min = node->partial_len > ART_MAX_PREFIX ? minimum(node) : NULL;
+        for (size_t i = 0; i < node->partial_len; i++) {
+            if (depth + i >= w->lo_len) {
+                bounded = 0;
+                break;
+            }
+            unsigned char p = i < ART_MAX_PREFIX ? node->partial[i] : (unsigned char)min->key[depth + i];
+            unsigned char c = (unsigned char)w->lo[depth + i];
+            if (p < c) return 0;
+            if (p > c) {
+                bounded = 0;
+                break;
+            }
+        }
+    }
+    depth += node->partial_len;
+    if (bounded && depth >= w->lo_len) bounded = 0;
+    unsigned char from = bounded ? (unsigned char)w->lo[depth] : 0;
+
+    switch (node->type) {
+    case NODE4:
+    case NODE16: {
+        const unsigned char *keys = node->type == NODE4 ? ((const Node4 *)node)->keys : ((const Node16 *)node)->keys;
+        void *const *child = node->type == NODE4 ? ((const Node4 *)node)->child : ((const Node16 *)node)->child;
+        for (int i = 0; i < node->children; i++) {
+            if (keys[i] < from) continue;
+            if (walk(w, child[i], depth + 1, bounded && keys[i] == from)) return 1;
+        }
+        break;
+    }
+    case NODE48: {
+        const Node48 *p = (const Node48 *)node;
+        for (int b = from; b < 256; b++) {
+            if (!p->index[b]) continue;
+            if (walk(w, p->child[p->index[b] - 1], depth + 1, bounded && b == from)) return 1;
+        }
+        break;
+    }
+    default: {
+        const Node256 *p = (const Node256 *)node;
+        for (int b = from; b < 256; b++) {
+            if (!p->child[b]) continue;
+            if (walk(w, p->child[b], depth + 1, bounded && b == from)) return 1;
+        }
+        break;
+    }
+    }
+    return 0;
+}
+
+int art_range(const ArtTree *t, const char *lo, size_t lo_len, int lo_exclusive,
+              const char *hi, size_t hi_len, art_visit_fn fn, void *ctx) {
+    Walk w = { lo, lo_len, lo_exclusive, hi, hi_len, NULL, 0, fn, ctx, 0 };
+    if (t->root) walk(&w, t->root, 0, lo != NULL);
+    return w.result;
+}
+
+int art_prefix(const ArtTree *t, const char *prefix, size_t prefix_len,
+               const char *after, size_t after_len, art_visit_fn fn, void *ctx) {
+    Walk w = { prefix_len ? prefix : NULL, prefix_len, 0, NULL, 0,
+               prefix_len ? prefix : NULL, prefix_len, fn, ctx, 0 };
+    //-- Resume after a key, unless it sorts before every match anyway --//
+    if (after && compare(after, after_len, prefix, prefix_len) >= 0) {
+        w.lo = after;
+        w.lo_len = after_len;
+        w.lo_exclusive = 1;
+    }
+    if (t->root) walk(&w, t->root, 0, w.lo != NULL);
+    return w.result;
+}
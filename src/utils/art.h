@@ -0,0 +1,101 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/art.h
+ * Module                    : Adaptive Radix Tree
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for the adaptive radix tree that keeps key names in
+ *  lexicographic order, for prefix and range scans over the keyspace.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef ART_H
+#define ART_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* ==================== Tuning ==================== */
+#define ART_MAX_PREFIX 10        //- compressed path bytes stored in a node; longer paths are checked at the leaf -//
+
+/* ==================== Tree Struct ==================== */
+/*
+ * Inner nodes come in four sizes (4, 16, 48 and 256 children) and grow
+ * or shrink as children come and go; a chain of single-child nodes is
+ * collapsed into the prefix of the node below. Keys are C strings, so
+ * the terminating NUL is indexed too: no key is then a prefix of
+ * another, and a key sorts before its extensions. The tree does no
+ * locking of its own.
+ */
+typedef struct ArtTree {
+    void *root;              //- inner node, tagged leaf, or NULL -//
+    size_t size;             //- keys -//
+    size_t bytes;            //- node and leaf memory, as mem_alloc_size() counts it -//
+} ArtTree;
+
+/**
+ * @brief Called for each key of a scan, in ascending order.
+ * @return 0 to continue, anything else to stop the scan with that value.
+ */
+typedef int (*art_visit_fn)(const char *key, size_t len, void *ctx);
+
+/**
+ * @brief Initialize an empty tree.
+ */
+void art_init(ArtTree *t);
+
+/**
+ * @brief Free every node and leaf; the tree is left empty.
+ */
+void art_clear(ArtTree *t);
+
+/**
+ * @brief Add a key (a NUL-free string of len bytes).
+ * @return 1 if added, 0 if already present, -1 if out of memory (the tree is unchanged).
+ */
+int art_insert(ArtTree *t, const char *key, size_t len);
+
+/**
+ * @brief Remove a key.
+ * @return 1 if removed, 0 if it was not present.
+ */
+int art_delete(ArtTree *t, const char *key, size_t len);
+
+/**
+ * @brief Test whether a key is present.
+ */
+int art_contains(const ArtTree *t, const char *key, size_t len);
+
+/**
+ * @brief Visit the keys in [lo, hi) in ascending order.
+ *
+ * Subtrees entirely below lo are skipped without being entered and the
+ * walk stops at the first key >= hi, so the cost is the depth of the
+ * tree plus the keys visited, whatever the size of the tree.
+ *
+ * @param lo Lower bound, or NULL for the first key.
+ * @param lo_exclusive Nonzero to leave out lo itself.
+ * @param hi Upper bound (exclusive), or NULL for no bound.
+ * @return 0 if the range was exhausted, otherwise the value that stopped fn.
+ */
+int art_range(const ArtTree *t, const char *lo, size_t lo_len, int lo_exclusive,
+              const char *hi, size_t hi_len, art_visit_fn fn, void *ctx);
+
+/**
+ * @brief Visit the keys starting with prefix in ascending order.
+ *
+ * @param after Resume strictly after this key, or NULL to start at the prefix.
+ * @return 0 if every matching key was visited, otherwise the value that stopped fn.
+ */
+int art_prefix(const ArtTree *t, const char *prefix, size_t prefix_len,
+               const char *after, size_t after_len, art_visit_fn fn, void *ctx);
+
+#endif // ART_H
@@ -0,0 +1,180 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/defrag.c
+ * Module                    : Active Defrag
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of the active defrag cycle and the thread that runs
+ *  it on a CPU budget.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include "defrag.h"
+#include "hashTable.h"
+#include "memAlloc.h"
+#include "epoch.h"
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * After mass deletes the slab chunks are left sparsely populated: RSS
+ * stays at its peak even though most objects are free. A pass starts by
+ * marking, per size class, the emptiest chunks that the live objects do
+ * not need (slab_plan_defrag()). It then walks the keyspace bucket by
+ * bucket and moves every allocation in a marked chunk into the fullest
+ * ones (see hashtable_defrag_bucket()), so the marked chunks drain and
+ * can be released. Work is time-sliced like the expiry cycle: the
+ * thread only starts a pass when the wasted bytes exceed both
+ * thresholds, and grants itself more CPU the worse fragmentation is.
+ */
+
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static DefragStats stats;                  // guarded by stats_lock
+static DefragConfig config = {
+    DEFRAG_DEFAULT_THRESHOLD_LOWER, DEFRAG_DEFAULT_THRESHOLD_UPPER,
+    DEFRAG_DEFAULT_IGNORE_BYTES, DEFRAG_DEFAULT_CYCLE_MIN, DEFRAG_DEFAULT_CYCLE_MAX,
+};                                         // guarded by stats_lock
+static unsigned int defrag_cursor;         // next bucket, 0 = no pass under way
+static pthread_mutex_t cycle_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static pthread_t defrag_thread;
+static volatile int defrag_running;
+static int defrag_hz;
+
+static long long monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+void defrag_default_config(DefragConfig *cfg) {
+    cfg->threshold_lower = DEFRAG_DEFAULT_THRESHOLD_LOWER;
+    cfg->threshold_upper = DEFRAG_DEFAULT_THRESHOLD_UPPER;
+    cfg->ignore_bytes = DEFRAG_DEFAULT_IGNORE_BYTES;
+    cfg->cycle_min = DEFRAG_DEFAULT_CYCLE_MIN;
+    cfg->cycle_max = DEFRAG_DEFAULT_CYCLE_MAX;
+}
+
+void defrag_configure(const DefragConfig *cfg) {
+    pthread_mutex_lock(&stats_lock);
+    config = *cfg;
+    pthread_mutex_unlock(&stats_lock);
+}
+
+double defrag_fragmentation(size_t *bytes) {
+    MemStats ms;
+    mem_stats(&ms);
+    size_t waste = ms.slab_reserved > ms.slab_used ? ms.slab_reserved - ms.slab_used : 0;
+    *bytes = waste;
+    return ms.slab_used ? (double)waste * 100.0 / (double)ms.slab_used : 0.0;
+}
+
+int defrag_cpu_percent(const DefragConfig *cfg, double frag_pct, size_t frag_bytes) {
+    if (frag_pct < cfg->threshold_lower || frag_bytes < cfg->ignore_bytes) return 0;
+    if (frag_pct >= cfg->threshold_upper || cfg->threshold_upper <= cfg->threshold_lower) {
+        return cfg->cycle_max;
+    }
+    double t = (frag_pct - cfg->threshold_lower) / (cfg->threshold_upper - cfg->threshold_lower);
+    return cfg->cycle_min + (int)(t * (cfg->cycle_max - cfg->cycle_min));
+}
+
+size_t defrag_cycle(long long budget_us) {
+    long long start = monotonic_us();
+    DefragSample sample = { 0 };
+    size_t released = 0;
+    int pass_done = 0;
+
+    pthread_mutex_lock(&cycle_lock);
+    //-- Copies moved by the last cycle may have emptied chunks since --//
+    released += mem_defrag_release();
+    if (defrag_cursor == 0) mem_defrag_prepare();
+    do {
+        defrag_cursor = hashtable_defrag_bucket(defrag_cursor, &sample);
+        if (defrag_cursor == 0) {
+            //-- The old copies go back to their chunks once no reader can hold them --//
+            epoch_synchronize();
+            released += mem_defrag_release();
+            pass_done = 1;
+            break;
+        }
+    } while (monotonic_us() - start < budget_us);
+    int running = defrag_cursor != 0;
+    pthread_mutex_unlock(&cycle_lock);
+
+    long long elapsed = monotonic_us() - start;
+    pthread_mutex_lock(&stats_lock);
+    stats.running = running;
+    stats.hits += sample.hits;
+    stats.misses += sample.misses;
+    stats.bytes_moved += sample.bytes_moved;
+    stats.released_bytes += released;
+    stats.passes += pass_done;
+    stats.cycles++;
+    stats.cycle_time_us += (unsigned long long)elapsed;
+    pthread_mutex_unlock(&stats_lock);
+    return sample.hits;
+}
+
+static void *defrag_main(void *arg) {
+    (void)arg;
+    long long period_us = 1000000 / defrag_hz;
+
+    while (__atomic_load_n(&defrag_running, __ATOMIC_RELAXED)) {
+        long long started = monotonic_us();
+        size_t frag_bytes;
+        double frag_pct = defrag_fragmentation(&frag_bytes);
+
+        pthread_mutex_lock(&stats_lock);
+        DefragConfig cfg = config;
+        int cpu = defrag_cpu_percent(&cfg, frag_pct, frag_bytes);
+        //-- A pass that was started is finished at the minimum rate --//
+        if (cpu == 0 && stats.running) cpu = cfg.cycle_min;
+        stats.frag_pct = frag_pct;
+        stats.frag_bytes = frag_bytes;
+        stats.cpu_pct = cpu;
+        pthread_mutex_unlock(&stats_lock);
+
+        if (cpu > 0) defrag_cycle(period_us * cpu / 100);
+
+        long long spent = monotonic_us() - started;
+        if (spent < period_us) usleep((useconds_t)(period_us - spent));
+    }
+    return NULL;
+}
+
+int defrag_start(int hz) {
+    if (hz < 1) hz = 1;
+    if (hz > 500) hz = 500;
+    defrag_hz = hz;
+    __atomic_store_n(&defrag_running, 1, __ATOMIC_RELAXED);
+    if (pthread_create(&defrag_thread, NULL, defrag_main, NULL) != 0) {
+        __atomic_store_n(&defrag_running, 0, __ATOMIC_RELAXED);
+        return -1;
+    }
+    return 0;
+}
+
+void defrag_stop(void) {
+    if (!__atomic_load_n(&defrag_running, __ATOMIC_RELAXED)) return;
+    __atomic_store_n(&defrag_running, 0, __ATOMIC_RELAXED);
+    pthread_join(defrag_thread, NULL);
+}
+
+int defrag_enabled(void) {
+    return __atomic_load_n(&defrag_running, __ATOMIC_RELAXED);
+}
+
+void defrag_get_stats(DefragStats *out) {
+    pthread_mutex_lock(&stats_lock);
+    *out = stats;
+    pthread_mutex_unlock(&stats_lock);
+}
@@ -0,0 +1,121 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/defrag.h
+ * Module                    : Active Defrag
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for the incremental active defragmenter, which moves live
+ *  keyspace allocations out of sparse slab chunks so the emptied
+ *  chunks can be returned to the OS.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef DEFRAG_H
+#define DEFRAG_H
+
+#include <stddef.h>
+
+/* ==================== Tuning ==================== */
+#define DEFRAG_DEFAULT_THRESHOLD_LOWER 10     //- % fragmentation at which a pass starts -//
+#define DEFRAG_DEFAULT_THRESHOLD_UPPER 100    //- % fragmentation at which the most CPU is used -//
+#define DEFRAG_DEFAULT_IGNORE_BYTES (100UL * 1024 * 1024)  //- less waste than this is left alone -//
+#define DEFRAG_DEFAULT_CYCLE_MIN 1            //- % CPU at the lower threshold -//
+#define DEFRAG_DEFAULT_CYCLE_MAX 25           //- % CPU at the upper threshold -//
+
+typedef struct DefragConfig {
+    int threshold_lower;
+    int threshold_upper;
+    size_t ignore_bytes;
+    int cycle_min;
+    int cycle_max;
+} DefragConfig;
+
+typedef struct DefragStats {
+    int running;                           //- a pass is in progress -//
+    unsigned long long hits;               //- allocations moved -//
+    unsigned long long misses;             //- allocations examined and left in place -//
+    unsigned long long bytes_moved;
+    unsigned long long released_bytes;     //- resident bytes returned to the OS -//
+    unsigned long long passes;             //- full keyspace passes completed -//
+    unsigned long long cycles;
+    unsigned long long cycle_time_us;      //- total time spent in cycles -//
+    double frag_pct;                       //- slab fragmentation at the last check -//
+    size_t frag_bytes;
+    int cpu_pct;                           //- CPU share granted at the last check -//
+} DefragStats;
+
+/**
+ * @brief Fill cfg with the DEFRAG_DEFAULT_* values.
+ */
+void defrag_default_config(DefragConfig *cfg);
+
+/**
+ * @brief Replace the thresholds used by the background thread.
+ */
+void defrag_configure(const DefragConfig *cfg);
+
+/**
+ * @brief Slab fragmentation: reserved chunk bytes not holding live objects.
+ *
+ * @param bytes Receives the wasted bytes.
+ * @return The waste as a percentage of the bytes in use.
+ */
+double defrag_fragmentation(size_t *bytes);
+
+/**
+ * @brief CPU share to spend on defrag at the given fragmentation.
+ *
+ * 0 below threshold_lower or ignore_bytes; cycle_min at the lower
+ * threshold rising linearly to cycle_max at the upper one.
+ */
+int defrag_cpu_percent(const DefragConfig *cfg, double frag_pct, size_t frag_bytes);
+
+/**
+ * @brief Run one defrag cycle.
+ *
+ * Works through the keyspace a bucket at a time, continuing from where
+ * the previous cycle stopped, until the budget is spent or the pass
+ * completes. A pass ends by waiting out the grace period of the moved
+ * copies and releasing the chunks they emptied.
+ *
+ * @param budget_us Time budget in microseconds.
+ * @return Number of allocations moved.
+ */
+size_t defrag_cycle(long long budget_us);
+
+/**
+ * @brief Start the background thread.
+ *
+ * hz times a second the thread measures fragmentation and, when it is
+ * above the thresholds (or a pass is under way), runs defrag_cycle()
+ * with its share of the period.
+ *
+ * @param hz Checks per second (1..500).
+ * @return 0 on success, -1 if the thread could not be started.
+ */
+int defrag_start(int hz);
+
+/**
+ * @brief Stop the background thread and wait for it to exit.
+ */
+void defrag_stop(void);
+
+/**
+ * @brief Whether the background thread is running.
+ */
+int defrag_enabled(void);
+
+/**
+ * @brief Snapshot the defrag statistics.
+ */
+void defrag_get_stats(DefragStats *out);
+
+#endif // DEFRAG_H
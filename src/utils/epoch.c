@@ -0,0 +1,260 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/epoch.c
+ * Module                    : Epoch Reclamation
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of epoch-based memory reclamation (EBR).
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include "epoch.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+/*
+ * Epoch Reclamation
+ *
+ * A global epoch counter only moves from e to e+1 once every thread that
+ * is inside a critical section has announced e. An object retired while
+ * the global epoch was r was unlinked before any reader that started in
+ * r+1 could look for it, so once the global epoch reaches r+2 nobody can
+ * still hold it and it is freed.
+ *
+ * Each thread owns a record in a global registry (records are recycled,
+ * never unlinked) holding its announced epoch and its list of retired
+ * objects. Memory still pending when a thread exits is handed to a
+ * shared orphan list that any thread drains.
+ */
+
+#define EPOCH_RECLAIM_THRESHOLD 64
+#define CACHE_LINE 64
+
+typedef struct Retired {
+    void *ptr;
+    void (*free_fn)(void *);
+    uint64_t epoch;
+} Retired;
+
+typedef struct RetireList {
+    Retired *items;
+    size_t head;     //- first item not yet freed -//
+    size_t count;    //- one past the last item -//
+    size_t cap;
+} RetireList;
+
+typedef struct EpochRecord {
+    uint64_t state;                //- (epoch << 1) | active; read by other threads -//
+    int in_use;                    //- claimed by a live thread -//
+    struct EpochRecord *next;      //- registry link -//
+    unsigned int nesting;          //- owner only -//
+    RetireList limbo;              //- owner only -//
+} __attribute__((aligned(CACHE_LINE))) EpochRecord;
+
+static uint64_t global_epoch = 1;
+static EpochRecord *registry = NULL;
+static pthread_mutex_t registry_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static RetireList orphans = {0};
+static pthread_mutex_t orphan_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static size_t pending = 0;
+
+static pthread_key_t exit_key;
+static pthread_once_t exit_key_once = PTHREAD_ONCE_INIT;
+static __thread EpochRecord *self = NULL;
+
+/* ==================== Retire Lists ==================== */
+
+static int list_push(RetireList *l, Retired item) {
+    if (l->count == l->cap) {
+        //-- Compact freed prefix before growing --//
+        if (l->head > 0) {
+            for (size_t i = l->head; i < l->count; i++) {
+                l->items[i - l->head] = l->items[i];
+            }
+            l->count -= l->head;
+            l->head = 0;
+        }
+        if (l->count == l->cap) {
+            size_t cap = l->cap ? l->cap * 2 : EPOCH_RECLAIM_THRESHOLD * 2;
+            Retired *items = realloc(l->items, cap * sizeof(Retired));
+            if (!items) return -1;
+            l->items = items;
+            l->cap = cap;
+        }
+    }
+    l->items[l->count++] = item;
+    return 0;
+}
+
+//-- Free every item whose grace period has elapsed (items are in epoch order) --//
+static void list_reclaim(RetireList *l, uint64_t epoch) {
+    size_t freed = 0;
+    while (l->head < l->count && l->items[l->head].epoch + 2 <= epoch) {
+        Retired *r = &l->items[l->head++];
+        r->free_fn(r->ptr);
+        freed++;
+    }
+    if (l->head == l->count) {
+        l->head = l->count = 0;
+    }
+    if (freed) {
+        __atomic_fetch_sub(&pending, freed, __ATOMIC_RELAXED);
+    }
+}
+
+static size_t list_size(const RetireList *l) {
+    return l->count - l->head;
+}
+
+/* ==================== Registry ==================== */
+
+static void thread_exit(void *arg) {
+    EpochRecord *rec = arg;
+
+    pthread_mutex_lock(&orphan_lock);
+    for (size_t i = rec->limbo.head; i < rec->limbo.count; i++) {
+        if (list_push(&orphans, rec->limbo.items[i]) != 0) {
+            //-- Out of memory: leak rather than free early --//
+            __atomic_fetch_sub(&pending, 1, __ATOMIC_RELAXED);
+        }
+    }
+    pthread_mutex_unlock(&orphan_lock);
+
+    free(rec->limbo.items);
+    rec->limbo = (RetireList){0};
+    rec->nesting = 0;
+    __atomic_store_n(&rec->state, 0, __ATOMIC_RELEASE);
+    __atomic_store_n(&rec->in_use, 0, __ATOMIC_RELEASE);
+    self = NULL;
+}
+
+static void make_exit_key(void) {
+    pthread_key_create(&exit_key, thread_exit);
+}
+
+static EpochRecord *register_thread(void) {
+    pthread_once(&exit_key_once, make_exit_key);
+
+    pthread_mutex_lock(&registry_lock);
+    EpochRecord *rec = registry;
+    while (rec && __atomic_load_n(&rec->in_use, __ATOMIC_ACQUIRE)) {
+        rec = rec->next;
+    }
+    if (!rec) {
+        void *mem = NULL;
+        if (posix_memalign(&mem, CACHE_LINE, sizeof(EpochRecord)) != 0) {
+            pthread_mutex_unlock(&registry_lock);
+            abort();
+        }
+        rec = mem;
+        *rec = (EpochRecord){0};
+        rec->next = registry;
+        __atomic_store_n(&registry, rec, __ATOMIC_RELEASE);
+    }
+    rec->in_use = 1;
+    pthread_mutex_unlock(&registry_lock);
+
+    pthread_setspecific(exit_key, rec);
+    self = rec;
+    return rec;
+}
+
+static inline EpochRecord *current_record(void) {
+    return self ? self : register_thread();
+}
+
+/* ==================== Epoch Advance ==================== */
+
+static void try_advance(void) {
+    uint64_t epoch = __atomic_load_n(&global_epoch, __ATOMIC_SEQ_CST);
+    for (EpochRecord *rec = __atomic_load_n(&registry, __ATOMIC_ACQUIRE); rec; rec = rec->next) {
+        uint64_t state = __atomic_load_n(&rec->state, __ATOMIC_SEQ_CST);
+        if ((state & 1) && (state >> 1) != epoch) {
+            return;
+        }
+    }
+    __atomic_compare_exchange_n(&global_epoch, &epoch, epoch + 1, 0,
+                                __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+static void reclaim(EpochRecord *rec, int wait_for_orphans) {
+    uint64_t epoch = __atomic_load_n(&global_epoch, __ATOMIC_SEQ_CST);
+    list_reclaim(&rec->limbo, epoch);
+
+    if (__atomic_load_n(&orphans.count, __ATOMIC_RELAXED) == 0) return;
+    if (wait_for_orphans) {
+        pthread_mutex_lock(&orphan_lock);
+    } else if (pthread_mutex_trylock(&orphan_lock) != 0) {
+        return;
+    }
+    list_reclaim(&orphans, epoch);
+    pthread_mutex_unlock(&orphan_lock);
+}
+
+/* ==================== Public API ==================== */
+
+void epoch_enter(void) {
+    EpochRecord *rec = current_record();
+    if (rec->nesting++ == 0) {
+        uint64_t epoch = __atomic_load_n(&global_epoch, __ATOMIC_SEQ_CST);
+        __atomic_store_n(&rec->state, (epoch << 1) | 1, __ATOMIC_SEQ_CST);
+    }
+}
+
+void epoch_exit(void) {
+    EpochRecord *rec = self;
+    if (!rec || rec->nesting == 0) return;
+    if (--rec->nesting == 0) {
+        __atomic_store_n(&rec->state, 0, __ATOMIC_RELEASE);
+        if (list_size(&rec->limbo) >= EPOCH_RECLAIM_THRESHOLD) {
+            try_advance();
+            reclaim(rec, 0);
+        }
+    }
+}
+
+void epoch_retire(void *ptr, void (*free_fn)(void *)) {
+    if (!ptr) return;
+    EpochRecord *rec = current_record();
+    Retired item = {
+        .ptr = ptr,
+        .free_fn = free_fn,
+        .epoch = __atomic_load_n(&global_epoch, __ATOMIC_SEQ_CST),
+    };
+    if (list_push(&rec->limbo, item) != 0) {
+        return;  //- out of memory: leaking is the only safe option -//
+    }
+    __atomic_fetch_add(&pending, 1, __ATOMIC_RELAXED);
+
+    if (rec->nesting == 0 && list_size(&rec->limbo) >= EPOCH_RECLAIM_THRESHOLD) {
+        try_advance();
+        reclaim(rec, 0);
+    }
+}
+
+void epoch_synchronize(void) {
+    EpochRecord *rec = current_record();
+    uint64_t target = __atomic_load_n(&global_epoch, __ATOMIC_SEQ_CST) + 2;
+    while (__atomic_load_n(&global_epoch, __ATOMIC_SEQ_CST) < target) {
+        try_advance();
+        if (__atomic_load_n(&global_epoch, __ATOMIC_SEQ_CST) < target) {
+            sched_yield();
+        }
+    }
+    reclaim(rec, 1);
+}
+
+size_t epoch_pending(void) {
+    return __atomic_load_n(&pending, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,67 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/epoch.h
+ * Module                    : Epoch Reclamation
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for epoch-based memory reclamation. Readers bracket their
+ *  lock-free accesses with epoch_enter()/epoch_exit(); writers hand
+ *  unlinked memory to epoch_retire() instead of free(), and it is only
+ *  released once no reader that could still see it remains.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef EPOCH_H
+#define EPOCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Enter a read-side critical section.
+ *
+ * Pointers loaded from shared structures after this call stay valid
+ * until the matching epoch_exit(). Calls nest; only the outermost pair
+ * announces and withdraws the thread.
+ */
+void epoch_enter(void);
+
+/**
+ * @brief Leave a read-side critical section.
+ *
+ * Leaving the outermost section also frees this thread's retired
+ * memory whose grace period has elapsed.
+ */
+void epoch_exit(void);
+
+/**
+ * @brief Defer freeing of memory that has been unlinked from shared state.
+ *
+ * @param ptr The object to free.
+ * @param free_fn Called as free_fn(ptr) once every reader that could
+ *        have seen ptr has left its critical section.
+ */
+void epoch_retire(void *ptr, void (*free_fn)(void *));
+
+/**
+ * @brief Block until every object retired so far by this thread has been freed.
+ *
+ * Waits for two epoch advances, so it must not be called from inside a
+ * critical section.
+ */
+void epoch_synchronize(void);
+
+/**
+ * @brief Number of retired objects not yet freed (all threads).
+ */
+size_t epoch_pending(void);
+
+#endif // EPOCH_H
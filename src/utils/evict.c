@@ -0,0 +1,234 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/evict.c
+ * Module                    : Eviction
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of maxmemory enforcement with sampled LRU, LFU, TTL
+ *  and random victim selection.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include "evict.h"
+#include "hashTable.h"
+#include "memAlloc.h"
+#include "epoch.h"
+#include <limits.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+/*
+ * Exact LRU or LFU would need every lookup to reorder a global structure.
+ * Instead each entry carries an access word (see hashTable.h) and a
+ * victim is chosen by sampling: a few random keys are scored by the
+ * policy and merged into a small pool of the best candidates seen so far,
+ * then the best one still present is evicted. Keeping the pool between
+ * evictions makes a handful of samples per victim approximate the true
+ * order closely, and the cost per write stays a fixed number of lookups.
+ *
+ * Evicted entries are retired like a DEL, so their memory only returns
+ * after the grace period; until then their bytes are subtracted from
+ * mem_used() so one write does not evict the same bytes twice.
+ */
+
+typedef struct PoolSlot {
+    unsigned long long score;   //- higher is a better victim -//
+    char *key;
+} PoolSlot;
+
+static pthread_mutex_t evict_lock = PTHREAD_MUTEX_INITIALIZER;
+static EvictConfig config = { 0, EVICT_NOEVICTION, EVICT_DEFAULT_SAMPLES };  // guarded by evict_lock
+static size_t maxmemory;                   // copy of config.maxmemory for the lock-free check
+static PoolSlot pool[EVICT_POOL_SIZE];     // ascending score, guarded by evict_lock
+static int pool_count;
+static EvictStats stats;                   // guarded by evict_lock
+
+static const char *policy_names[EVICT_POLICY_COUNT] = {
+    "noeviction", "allkeys-lru", "allkeys-lfu", "allkeys-random", "volatile-lru", "volatile-ttl",
+};
+
+static long long monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+void evict_default_config(EvictConfig *cfg) {
+    cfg->maxmemory = 0;
+    cfg->policy = EVICT_NOEVICTION;
+    cfg->samples = EVICT_DEFAULT_SAMPLES;
+}
+
+/* ==================== Candidate Pool ==================== */
+
+static void pool_remove(int i) {
+    free(pool[i].key);
+    memmove(&pool[i], &pool[i + 1], (size_t)(pool_count - i - 1) * sizeof(PoolSlot));
+    pool_count--;
+}
+
+static void pool_clear(void) {
+    while (pool_count > 0) pool_remove(pool_count - 1);
+}
+
+static void pool_insert(unsigned long long score, const char *key) {
+    //-- A key sampled again replaces its old score --//
+    for (int i = 0; i < pool_count; i++) {
+        if (strcmp(pool[i].key, key) == 0) {
+            pool_remove(i);
+            break;
+        }
+    }
+    if (pool_count == EVICT_POOL_SIZE) {
+        if (score <= pool[0].score) return;
+        pool_remove(0);
+    }
+    char *copy = strdup(key);
+    if (!copy) return;
+    int pos = pool_count;
+    while (pos > 0 && pool[pos - 1].score > score) {
+        pool[pos] = pool[pos - 1];
+        pos--;
+    }
+    pool[pos] = (PoolSlot){ score, copy };
+    pool_count++;
+}
+
+/* ==================== Sampling ==================== */
+
+typedef struct SampleCtx {
+    evict_policy_t policy;
+    uint32_t clock;
+} SampleCtx;
+
+static void sample_visit(const Entry *entry, void *arg) {
+    SampleCtx *ctx = arg;
+    uint32_t access = __atomic_load_n(&entry->access, __ATOMIC_RELAXED);
+    unsigned long long score;
+
+    switch (ctx->policy) {
+    case EVICT_ALLKEYS_LFU:
+        score = 255 - lfu_decayed(access, ctx->clock);
+        break;
+    case EVICT_ALLKEYS_RANDOM:
+        score = (unsigned long long)rand();
+        break;
+    case EVICT_VOLATILE_TTL:
+        if (!(entry->flags & ENTRY_F_EXPIRE_META)) return;
+        //-- The nearest deadline is the best victim --//
+        score = ULLONG_MAX - (unsigned long long)entry_deadline(entry);
+        break;
+    case EVICT_VOLATILE_LRU:
+        if (!(entry->flags & ENTRY_F_EXPIRE_META)) return;
+        score = lru_idle_seconds(access, ctx->clock);
+        break;
+    default:
+        score = lru_idle_seconds(access, ctx->clock);
+        break;
+    }
+    pool_insert(score, entry->key);
+}
+
+//-- Evict one key; returns the bytes it frees, 0 if no candidate was found. Holds evict_lock. --//
+static size_t evict_one(void) {
+    int volatile_only = config.policy == EVICT_VOLATILE_LRU || config.policy == EVICT_VOLATILE_TTL;
+    SampleCtx ctx = { config.policy, lru_clock() };
+
+    for (int tries = 0; tries < EVICT_SAMPLE_TRIES; tries++) {
+        epoch_enter();
+        hashtable_sample((size_t)config.samples, sample_visit, &ctx);
+        epoch_exit();
+
+        //-- Best first; a candidate deleted since it was sampled is skipped --//
+        while (pool_count > 0) {
+            char *key = pool[pool_count - 1].key;
+            pool[pool_count - 1].key = NULL;
+            pool_count--;
+            size_t bytes = hashtable_evict_key(key, volatile_only);
+            free(key);
+            if (bytes) return bytes;
+        }
+    }
+    return 0;
+}
+
+/* ==================== Public API ==================== */
+
+void evict_configure(const EvictConfig *cfg) {
+    pthread_mutex_lock(&evict_lock);
+    config = *cfg;
+    if (config.samples < 1) config.samples = 1;
+    pool_clear();
+    __atomic_store_n(&maxmemory, cfg->maxmemory, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&evict_lock);
+}
+
+void evict_get_config(EvictConfig *out) {
+    pthread_mutex_lock(&evict_lock);
+    *out = config;
+    pthread_mutex_unlock(&evict_lock);
+}
+
+int evict_parse_policy(const char *s, evict_policy_t *out) {
+    for (int p = 0; p < EVICT_POLICY_COUNT; p++) {
+        if (strcasecmp(s, policy_names[p]) == 0) {
+            *out = (evict_policy_t)p;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+const char *evict_policy_name(evict_policy_t policy) {
+    return policy < EVICT_POLICY_COUNT ? policy_names[policy] : "unknown";
+}
+
+size_t evict_used_memory(void) {
+    size_t used = mem_used();
+    size_t pending = hashtable_evict_pending();
+    return used > pending ? used - pending : 0;
+}
+
+int evict_make_room(void) {
+    size_t limit = __atomic_load_n(&maxmemory, __ATOMIC_RELAXED);
+    if (limit == 0 || evict_used_memory() <= limit) return 0;
+
+    pthread_mutex_lock(&evict_lock);
+    long long start = monotonic_us();
+    unsigned long long keys = 0, bytes = 0;
+    int rc = 0;
+    //-- Another writer may have made room while this one waited for the lock --//
+    while (evict_used_memory() > config.maxmemory) {
+        size_t freed = config.policy == EVICT_NOEVICTION ? 0 : evict_one();
+        if (freed == 0) {
+            rc = -1;
+            break;
+        }
+        keys++;
+        bytes += freed;
+    }
+    stats.evicted_keys += keys;
+    stats.evicted_bytes += bytes;
+    stats.oom_rejections += rc != 0;
+    stats.evict_time_us += (unsigned long long)(monotonic_us() - start);
+    pthread_mutex_unlock(&evict_lock);
+    return rc;
+}
+
+void evict_get_stats(EvictStats *out) {
+    pthread_mutex_lock(&evict_lock);
+    *out = stats;
+    pthread_mutex_unlock(&evict_lock);
+    out->pending_bytes = hashtable_evict_pending();
+}
@@ -0,0 +1,105 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/evict.h
+ * Module                    : Eviction
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for the maxmemory limit and the policies that choose which
+ *  keys to evict when a write would exceed it.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef EVICT_H
+#define EVICT_H
+
+#include <stddef.h>
+
+/* ==================== Tuning ==================== */
+#define EVICT_DEFAULT_SAMPLES 5     //- keys sampled per victim -//
+#define EVICT_POOL_SIZE 16          //- best candidates kept between samples -//
+#define EVICT_SAMPLE_TRIES 8        //- samplings before giving up on finding a candidate -//
+
+typedef enum {
+    EVICT_NOEVICTION,       //- reject writes over the limit -//
+    EVICT_ALLKEYS_LRU,      //- least recently used key -//
+    EVICT_ALLKEYS_LFU,      //- least frequently used key -//
+    EVICT_ALLKEYS_RANDOM,   //- any key -//
+    EVICT_VOLATILE_LRU,     //- least recently used key with a TTL -//
+    EVICT_VOLATILE_TTL,     //- key with a TTL closest to expiring -//
+    EVICT_POLICY_COUNT
+} evict_policy_t;
+
+typedef struct EvictConfig {
+    size_t maxmemory;           //- bytes, 0 = no limit -//
+    evict_policy_t policy;
+    int samples;
+} EvictConfig;
+
+typedef struct EvictStats {
+    unsigned long long evicted_keys;
+    unsigned long long evicted_bytes;
+    unsigned long long oom_rejections;     //- writes refused because nothing could be evicted -//
+    unsigned long long evict_time_us;      //- total time spent choosing and evicting keys -//
+    size_t pending_bytes;                  //- evicted bytes still waiting for their grace period -//
+} EvictStats;
+
+/**
+ * @brief Fill cfg with no limit, noeviction and EVICT_DEFAULT_SAMPLES.
+ */
+void evict_default_config(EvictConfig *cfg);
+
+/**
+ * @brief Replace the limit and policy; empties the candidate pool.
+ */
+void evict_configure(const EvictConfig *cfg);
+
+/**
+ * @brief The configuration in effect.
+ */
+void evict_get_config(EvictConfig *out);
+
+/**
+ * @brief Parse a policy name such as "allkeys-lru".
+ *
+ * @return 0 on success, -1 if s names no policy.
+ */
+int evict_parse_policy(const char *s, evict_policy_t *out);
+
+/**
+ * @brief Name of a policy, as accepted by evict_parse_policy().
+ */
+const char *evict_policy_name(evict_policy_t policy);
+
+/**
+ * @brief Memory counted against maxmemory.
+ *
+ * mem_used() minus the evicted bytes that are only waiting for their
+ * grace period, so one eviction is seen at once and not repeated.
+ */
+size_t evict_used_memory(void);
+
+/**
+ * @brief Evict keys until memory is back under maxmemory.
+ *
+ * Called before every command that can grow the keyspace. Without a
+ * limit, or while under it, this is a couple of loads.
+ *
+ * @return 0 if the write may proceed, -1 if memory is over the limit and
+ *         the policy has nothing (left) to evict.
+ */
+int evict_make_room(void);
+
+/**
+ * @brief Snapshot the eviction statistics.
+ */
+void evict_get_stats(EvictStats *out);
+
+#endif // EVICT_H
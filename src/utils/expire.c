@@ -0,0 +1,153 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/expire.c
+ * Module                    : Active Expiry
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of the adaptive active expiry cycle and the cron
+ *  thread that drives it.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include "expire.h"
+#include "hashTable.h"
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * Keys are reclaimed near their deadline by the per-stripe timing wheels,
+ * which the cron thread advances every EXPIRE_WHEEL_TICK_MS. The sampling
+ * cycle below is a safety net and feeds the stale-key estimate. It walks
+ * the keyspace a sample at a time: a sample in which few keys had expired
+ * means the keyspace is mostly clean and the cycle stops early, a stale
+ * sample makes it continue until the time budget runs out. The share of
+ * stale keys in recent samples is kept as a moving average.
+ */
+
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static ExpireStats stats;                  // guarded by stats_lock, except expired_keys
+static unsigned int expire_cursor;         // next bucket to sample, cycles are serialized
+static pthread_mutex_t cycle_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static pthread_t cron_thread;
+static volatile int cron_running;
+static int cron_hz;
+
+static long long monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+size_t expire_cycle(long long budget_us) {
+    long long start = monotonic_us();
+    size_t sampled = 0, expired = 0;
+    int time_capped = 0;
+
+    pthread_mutex_lock(&cycle_lock);
+    ExpireSample s;
+    do {
+        expire_cursor = hashtable_expire_sample(expire_cursor, EXPIRE_KEYS_PER_LOOP, &s);
+        sampled += s.sampled;
+        expired += s.expired;
+        //-- No TTL keys near the cursor: try again next cycle --//
+        if (s.sampled == 0) break;
+        if (monotonic_us() - start >= budget_us) {
+            time_capped = 1;
+            break;
+        }
+    } while (s.expired * 100 > s.sampled * EXPIRE_ACCEPTABLE_STALE);
+    pthread_mutex_unlock(&cycle_lock);
+
+    long long elapsed = monotonic_us() - start;
+    pthread_mutex_lock(&stats_lock);
+    stats.cycles++;
+    stats.active_expired += expired;
+    stats.cycle_time_us += (unsigned long long)elapsed;
+    stats.time_cap_reached += time_capped;
+    if (sampled > 0) {
+        double current = (double)expired * 100.0 / (double)sampled;
+        stats.stale_perc = current * 0.05 + stats.stale_perc * 0.95;
+    }
+    pthread_mutex_unlock(&stats_lock);
+    return expired;
+}
+
+size_t expire_due(void) {
+    size_t reclaimed = hashtable_expire_due(current_millis());
+    if (reclaimed > 0) {
+        pthread_mutex_lock(&stats_lock);
+        stats.wheel_expired += reclaimed;
+        pthread_mutex_unlock(&stats_lock);
+    }
+    return reclaimed;
+}
+
+static void *cron_main(void *arg) {
+    (void)arg;
+    long long period_us = 1000000 / cron_hz;
+    long long budget_us = period_us * EXPIRE_CYCLE_TIME_PERC / 100;
+    long long tick_us = EXPIRE_WHEEL_TICK_MS * 1000;
+    if (tick_us > period_us) tick_us = period_us;
+    long long rate_start = monotonic_us();
+    long long last_cycle = rate_start;
+    unsigned long long rate_base = hashtable_expired_keys();
+
+    while (__atomic_load_n(&cron_running, __ATOMIC_RELAXED)) {
+        long long started = monotonic_us();
+        expire_due();
+        if (started - last_cycle >= period_us) {
+            expire_cycle(budget_us);
+            last_cycle = started;
+        }
+
+        //-- Refresh the per-second rate about once a second --//
+        long long now = monotonic_us();
+        if (now - rate_start >= 1000000) {
+            unsigned long long total = hashtable_expired_keys();
+            pthread_mutex_lock(&stats_lock);
+            stats.expired_per_sec = (double)(total - rate_base) * 1e6 / (double)(now - rate_start);
+            pthread_mutex_unlock(&stats_lock);
+            rate_base = total;
+            rate_start = now;
+        }
+
+        long long spent = monotonic_us() - started;
+        if (spent < tick_us) usleep((useconds_t)(tick_us - spent));
+    }
+    return NULL;
+}
+
+int expire_start(int hz) {
+    if (hz < 1) hz = 1;
+    if (hz > 500) hz = 500;
+    cron_hz = hz;
+    __atomic_store_n(&cron_running, 1, __ATOMIC_RELAXED);
+    if (pthread_create(&cron_thread, NULL, cron_main, NULL) != 0) {
+        __atomic_store_n(&cron_running, 0, __ATOMIC_RELAXED);
+        return -1;
+    }
+    return 0;
+}
+
+void expire_stop(void) {
+    if (!__atomic_load_n(&cron_running, __ATOMIC_RELAXED)) return;
+    __atomic_store_n(&cron_running, 0, __ATOMIC_RELAXED);
+    pthread_join(cron_thread, NULL);
+}
+
+void expire_get_stats(ExpireStats *out) {
+    pthread_mutex_lock(&stats_lock);
+    *out = stats;
+    pthread_mutex_unlock(&stats_lock);
+    out->expired_keys = hashtable_expired_keys();
+}
@@ -0,0 +1,85 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/expire.h
+ * Module                    : Active Expiry
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for the background expiry cycle that samples keys with a TTL
+ *  and reclaims expired ones, working harder while many of them are
+ *  stale.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef EXPIRE_H
+#define EXPIRE_H
+
+#include <stddef.h>
+
+/* ==================== Tuning ==================== */
+#define EXPIRE_DEFAULT_HZ 10
+#define EXPIRE_KEYS_PER_LOOP 20        //- TTL keys sampled per iteration -//
+#define EXPIRE_ACCEPTABLE_STALE 10     //- % expired in a sample below which the cycle stops -//
+#define EXPIRE_CYCLE_TIME_PERC 25      //- share of each cron period the cycle may use -//
+#define EXPIRE_WHEEL_TICK_MS 10        //- how often the timing wheels are advanced -//
+
+typedef struct ExpireStats {
+    unsigned long long expired_keys;       //- total reclaimed, lazily or actively -//
+    unsigned long long active_expired;     //- reclaimed by the cycle -//
+    unsigned long long wheel_expired;      //- reclaimed at their deadline by the timing wheels -//
+    unsigned long long cycles;
+    unsigned long long cycle_time_us;      //- total time spent in cycles -//
+    unsigned long long time_cap_reached;   //- cycles stopped by their time budget -//
+    double expired_per_sec;                //- rate over the last second -//
+    double stale_perc;                     //- estimated % of TTL keys already expired -//
+} ExpireStats;
+
+/**
+ * @brief Run one adaptive expiry cycle.
+ *
+ * Samples EXPIRE_KEYS_PER_LOOP TTL keys at a time, continuing from where
+ * the previous cycle stopped, and keeps going while more than
+ * EXPIRE_ACCEPTABLE_STALE percent of a sample had expired and the budget
+ * allows.
+ *
+ * @param budget_us Time budget in microseconds.
+ * @return Number of keys reclaimed.
+ */
+size_t expire_cycle(long long budget_us);
+
+/**
+ * @brief Reclaim every key whose deadline has passed (see hashtable_expire_due()).
+ *
+ * @return Number of keys reclaimed.
+ */
+size_t expire_due(void);
+
+/**
+ * @brief Start the background thread.
+ *
+ * The thread advances the timing wheels every EXPIRE_WHEEL_TICK_MS and
+ * runs expire_cycle() hz times a second.
+ *
+ * @param hz Cycles per second (1..500).
+ * @return 0 on success, -1 if the thread could not be started.
+ */
+int expire_start(int hz);
+
+/**
+ * @brief Stop the background thread and wait for it to exit.
+ */
+void expire_stop(void);
+
+/**
+ * @brief Snapshot the expiry statistics.
+ */
+void expire_get_stats(ExpireStats *out);
+
+#endif // EXPIRE_H
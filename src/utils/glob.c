@@ -0,0 +1,104 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/glob.c
+ * Module                    : Glob Matching
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of glob pattern matching.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include "glob.h"
+#include <stddef.h>
+#include <string.h>
+
+/*
+ * Every token other than `*` consumes exactly one character, so it is
+ * enough to remember the most recent `*` and, on a mismatch, let it
+ * swallow one more character. This is linear in practice and never
+ * recurses, unlike a naive backtracking matcher.
+ */
+
+//-- Match one character against the token at p; *next receives the token end --//
+static int match_token(const char *p, char c, const char **next) {
+    if (*p == '?') {
+        *next = p + 1;
+        return 1;
+    }
+    if (*p == '\\' && p[1]) {
+        *next = p + 2;
+        return p[1] == c;
+    }
+    if (*p != '[') {
+        *next = p + 1;
+        return *p == c;
+    }
+
+    p++;
+    int negate = 0;
+    if (*p == '^') {
+        negate = 1;
+        p++;
+    }
+    int matched = 0;
+    while (*p && *p != ']') {
+        if (*p == '\\' && p[1]) {
+            matched |= p[1] == c;
+            p += 2;
+        } else if (p[1] == '-' && p[2] && p[2] != ']') {
+            char lo = p[0], hi = p[2];
+            if (lo > hi) {
+                char t = lo;
+                lo = hi;
+                hi = t;
+            }
+            matched |= c >= lo && c <= hi;
+            p += 3;
+        } else {
+            matched |= *p == c;
+            p++;
+        }
+    }
+    *next = *p ? p + 1 : p;  //- unterminated class runs to the end -//
+    return negate ? !matched : matched;
+}
+
+int glob_match(const char *pattern, const char *str) {
+    const char *p = pattern;
+    const char *s = str;
+    const char *star_p = NULL;
+    const char *star_s = NULL;
+
+    while (*s) {
+        if (*p == '*') {
+            while (*p == '*') p++;
+            if (!*p) return 1;
+            star_p = p;
+            star_s = s;
+            continue;
+        }
+        const char *next;
+        if (*p && match_token(p, *s, &next)) {
+            p = next;
+            s++;
+            continue;
+        }
+        if (!star_p) return 0;
+        p = star_p;
+        s = ++star_s;
+    }
+    while (*p == '*') p++;
+    return *p == '\0';
+}
+
+size_t glob_literal_prefix(const char *pattern) {
+    return strcspn(pattern, "*?[\\");
+}
@@ -0,0 +1,46 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/glob.h
+ * Module                    : Glob Matching
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for Redis-style glob pattern matching used by SCAN MATCH.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef GLOB_H
+#define GLOB_H
+
+#include <stddef.h>
+
+/**
+ * @brief Match str against a glob pattern.
+ *
+ * Supports `*` (any run), `?` (any one char), `[abc]`, `[a-z]`, `[^a]`
+ * and `\x` to escape a special character.
+ *
+ * @param pattern The glob pattern.
+ * @param str The string to test.
+ * @return 1 if str matches the whole pattern, 0 otherwise.
+ */
+int glob_match(const char *pattern, const char *str);
+
+/**
+ * @brief Length of the literal text a pattern starts with.
+ *
+ * Every string the pattern matches starts with these bytes, so a prefix
+ * index can narrow the candidates to them.
+ *
+ * @return Bytes before the first `*`, `?`, `[` or `\`.
+ */
+size_t glob_literal_prefix(const char *pattern);
+
+#endif // GLOB_H
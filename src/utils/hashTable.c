@@ -5,8 +5,8 @@
  * 
  * File                      : src/utils/hashTable.c
  * Module                    : Hash Table
- * Last Updating Author      : m0hamed541
- * Last Update               : 03/08/2026
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
  * Version                   : 1.0.0
  * 
  * Description:
@@ -17,247 +17,1598 @@
  */
 
 #include "hashTable.h"
+#include "art.h"
+#include "epoch.h"
+#include "lazyfree.h"
+#include "memAlloc.h"
+#include "numeric.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <pthread.h>
-#include <sys/time.h>
+#include <math.h>
 
 /*
  * Hash Table Implementation
  * 
- * This hash table uses separate chaining for collision resolution.
- * Each entry contains a key-value pair and a pointer to the next entry.
+ * By default this hash table uses separate chaining for collision
+ * resolution: each entry contains a key-value pair and a pointer to the
+ * next entry. With MEMORA_SWISS_INDEX every bucket instead owns an
+ * open-addressing Swiss table (see swissTable.c). The bucket_* helpers
+ * below are the only code that knows which backend is in use.
+ *
+ * Writers serialize on the key's lock stripe. Readers take no lock: they run
+ * inside an epoch critical section (see epoch.c), links are published
+ * with release stores, and unlinked entries are handed to epoch_retire()
+ * so they stay readable until every reader that could hold them is gone.
  */
 
-unsigned int hash(const char *key) {
-    unsigned int h = 0;
-    while (*key) {
-        h = (h << 5) + *key++;
+uint64_t hash_key(const char *key, size_t len) {
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (unsigned char)key[i];
+        h *= 1099511628211ULL;
     }
-    return h % TABLE_SIZE;
+    //-- fmix64 finalizer (MurmurHash3) --//
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+unsigned int hash(const char *key) {
+    return (unsigned int)(hash_key(key, strlen(key)) % TABLE_SIZE);
 }
 
-pthread_mutex_t bucket_mutex[TABLE_SIZE];  // per bucket lock
+StripeLock key_locks[LOCK_STRIPES];  // writer lock stripes, one per cache line
+static TimerWheel expire_wheels[LOCK_STRIPES];  // TTL deadlines, each guarded by its lock stripe
+
+static inline TimerWheel *key_wheel(uint64_t h) {
+    return &expire_wheels[h & (LOCK_STRIPES - 1)];
+}
 
 void hashtable_lock_init(void) {
-    for (int i = 0; i < TABLE_SIZE; i++) {
-        pthread_mutex_init(&bucket_mutex[i], NULL);
+    long long now = current_millis();
+    for (int i = 0; i < LOCK_STRIPES; i++) {
+        stripe_lock_init(&key_locks[i]);
+        wheel_init(&expire_wheels[i], now);
     }
 }
 
+StripeLock *key_lock(const char *key) {
+    StripeLock *lock = key_stripe(hash_key(key, strlen(key)));
+    stripe_lock_acquire(lock);
+    return lock;
+}
+
+void hashtable_lock_stats(StripeStats *total) {
+    *total = (StripeStats){0};
+    for (int i = 0; i < LOCK_STRIPES; i++) {
+        StripeStats st;
+        stripe_lock_stats(&key_locks[i], &st);
+        total->acquisitions += st.acquisitions;
+        total->contended += st.contended;
+        total->parked += st.parked;
+    }
+}
+
+#ifdef MEMORA_SWISS_INDEX
+SwissTable HASHTABLE[TABLE_SIZE] = {0};
+#else
 Entry *HASHTABLE[TABLE_SIZE] = {0};
+#endif
+
+static unsigned long long stat_expired_keys;  // expired entries reclaimed, lazily or actively
+static int lazy_user_del;                     // DEL frees big values in the background too
+static size_t evict_pending_bytes;            // evicted entries not yet freed
+static int lfu_log_factor = LFU_DEFAULT_LOG_FACTOR;
+static int lfu_decay_time = LFU_DEFAULT_DECAY_TIME;
 
-long long current_millis() {
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    return ((long long)tv.tv_sec) * 1000 + tv.tv_usec / 1000;
+/* ==================== Ordered Key Index ==================== */
+/*
+ * Optional radix tree of key names (art.c) for prefix scans. It is kept
+ * in step by bucket_insert and bucket_unlink, which run under the key's
+ * stripe, and has its own rwlock, always taken after a stripe. It holds
+ * names only: scans look each name up in the table to find the entry.
+ */
+static ArtTree key_index;
+static pthread_rwlock_t key_index_lock = PTHREAD_RWLOCK_INITIALIZER;
+static int key_index_on;
+
+static int index_add(const char *key, size_t len) {
+    if (!__atomic_load_n(&key_index_on, __ATOMIC_RELAXED)) return 0;
+    pthread_rwlock_wrlock(&key_index_lock);
+    int rc = key_index_on ? art_insert(&key_index, key, len) : 0;
+    pthread_rwlock_unlock(&key_index_lock);
+    return rc < 0 ? -1 : 0;
 }
 
-void set_value(const char *key, const char *value, long long px) {
-    unsigned int idx = hash(key);
-    Entry *entry = HASHTABLE[idx];
-    pthread_mutex_lock(&bucket_mutex[idx]);
-    long long expiry = (px > 0) ? current_millis() + px : 0;
+static void index_remove(const char *key, size_t len) {
+    if (!__atomic_load_n(&key_index_on, __ATOMIC_RELAXED)) return;
+    pthread_rwlock_wrlock(&key_index_lock);
+    if (key_index_on) art_delete(&key_index, key, len);
+    pthread_rwlock_unlock(&key_index_lock);
+}
 
-    while (entry) {
-        if (strcmp(entry->key, key) == 0) {
-            //-- Free old value based on type --//
-            if (entry->type == VALUE_STRING) {
-                free(entry->data.string_value);
-            } else if (entry->type == VALUE_LIST) {
-                list_free(entry->data.list_value);
-            }
-            
-            entry->type = VALUE_STRING;
-            entry->data.string_value = strdup(value);
-            entry->expiry = expiry;
-            pthread_mutex_unlock(&bucket_mutex[idx]);
-            return;
+/* ==================== Bucket Helpers ==================== */
+/*
+ * bucket_find may run without the lock inside an epoch; the mutators
+ * require the key's stripe (key_stripe(h)) to be held.
+ */
+
+//-- One flag test for keys without a TTL; the deadline sits right before the header --//
+static inline int entry_expired(const Entry *entry, long long now) {
+    return (entry->flags & ENTRY_F_EXPIRE_META) && entry_deadline(entry) <= now;
+}
+
+static Entry *bucket_find(unsigned int idx, const char *key, size_t len, uint64_t h) {
+#ifdef MEMORA_SWISS_INDEX
+    return swiss_find(&HASHTABLE[idx], key, len, h);
+#else
+    Entry *entry = __atomic_load_n(&HASHTABLE[idx], __ATOMIC_ACQUIRE);
+    for (; entry; entry = __atomic_load_n(&entry->next, __ATOMIC_ACQUIRE)) {
+        if (entry_key_equals(entry, key, len, h)) {
+            return entry;
         }
-        entry = entry->next;
     }
+    return NULL;
+#endif
+}
 
-    //-- New entry --//
-    entry = malloc(sizeof(Entry));
-    entry->key = strdup(key);
-    entry->type = VALUE_STRING;
-    entry->data.string_value = strdup(value);
-    entry->expiry = expiry;
+static int bucket_insert(unsigned int idx, Entry *entry, uint64_t h) {
+    if (index_add(entry->key, entry->key_len) != 0) return -1;
+#ifdef MEMORA_SWISS_INDEX
+    entry->next = NULL;
+    if (swiss_insert(&HASHTABLE[idx], entry, h) != 0) {
+        index_remove(entry->key, entry->key_len);
+        return -1;
+    }
+    return 0;
+#else
+    (void)h;
     entry->next = HASHTABLE[idx];
-    HASHTABLE[idx] = entry;
-    pthread_mutex_unlock(&bucket_mutex[idx]);
+    __atomic_store_n(&HASHTABLE[idx], entry, __ATOMIC_RELEASE);
+    return 0;
+#endif
+}
+
+static void bucket_replace(unsigned int idx, Entry *old, Entry *entry, uint64_t h) {
+#ifdef MEMORA_SWISS_INDEX
+    entry->next = NULL;
+    swiss_replace(&HASHTABLE[idx], old, entry, h);
+#else
+    (void)h;
+    Entry **link = &HASHTABLE[idx];
+    while (*link && *link != old) {
+        link = &(*link)->next;
+    }
+    if (*link) {
+        entry->next = old->next;
+        __atomic_store_n(link, entry, __ATOMIC_RELEASE);
+    }
+#endif
+}
+
+static void bucket_unlink(unsigned int idx, Entry *entry, uint64_t h) {
+    index_remove(entry->key, entry->key_len);
+#ifdef MEMORA_SWISS_INDEX
+    swiss_remove(&HASHTABLE[idx], entry, h);
+#else
+    (void)h;
+    Entry **link = &HASHTABLE[idx];
+    while (*link && *link != entry) {
+        link = &(*link)->next;
+    }
+    if (*link) {
+        //-- entry->next is left intact for readers still standing on entry --//
+        __atomic_store_n(link, entry->next, __ATOMIC_RELEASE);
+    }
+#endif
+}
+
+//-- The entry at a random position of a bucket; safe without the lock inside an epoch --//
+static Entry *bucket_sample(unsigned int idx, uint64_t r) {
+#ifdef MEMORA_SWISS_INDEX
+    return swiss_sample(&HASHTABLE[idx], (size_t)r);
+#else
+    Entry *head = __atomic_load_n(&HASHTABLE[idx], __ATOMIC_ACQUIRE);
+    size_t len = 0;
+    for (Entry *entry = head; entry; entry = __atomic_load_n(&entry->next, __ATOMIC_ACQUIRE)) {
+        len++;
+    }
+    if (len == 0) return NULL;
+    //-- The chain may shrink between the two walks; stop at its end --//
+    Entry *entry = head;
+    for (size_t skip = r % len; skip && entry; skip--) {
+        entry = __atomic_load_n(&entry->next, __ATOMIC_ACQUIRE);
+    }
+    return entry;
+#endif
+}
+
+//-- Visit every entry of a bucket; safe without the lock inside an epoch --//
+static void bucket_for_each(unsigned int idx, void (*fn)(Entry *entry, void *ctx), void *ctx) {
+#ifdef MEMORA_SWISS_INDEX
+    swiss_for_each(&HASHTABLE[idx], fn, ctx);
+#else
+    Entry *entry = __atomic_load_n(&HASHTABLE[idx], __ATOMIC_ACQUIRE);
+    for (; entry; entry = __atomic_load_n(&entry->next, __ATOMIC_ACQUIRE)) {
+        fn(entry, ctx);
+    }
+#endif
+}
+
+static void free_value(Entry *entry) {
+    if (entry->type == VALUE_STRING) {
+        if (entry->encoding == ENCODING_RAW) {
+            mem_free_str(entry->data.string_value);
+        }
+    } else if (entry->type == VALUE_LIST) {
+        list_free(entry->data.list_value);
+    }
+}
+
+/*
+ * Allocate [ ExpireMeta | ] header + key (+ extra inline bytes); the
+ * caller fills in the value. Only entries with a TTL carry the meta.
+ */
+static Entry *alloc_entry(const char *key, size_t len, uint64_t h, size_t extra, long long expiry) {
+    if (len > ENTRY_KEY_MAX) return NULL;
+    size_t meta = expiry > 0 ? sizeof(ExpireMeta) : 0;
+    char *base = mem_alloc(meta + ENTRY_HEADER_SIZE + len + 1 + extra);
+    if (!base) return NULL;
+    Entry *entry = (Entry *)(base + meta);
+    memcpy(entry->key, key, len + 1);
+    entry->hash = h;
+    entry->key_len = (uint16_t)len;
+    entry->flags = 0;
+    entry->access = ((uint32_t)LFU_INIT_VAL << LRU_CLOCK_BITS) | lru_clock();
+    entry->next = NULL;
+    if (meta) {
+        entry->flags |= ENTRY_F_EXPIRE_META;
+        entry_expire_meta(entry)->node.pprev = NULL;
+        entry_expire_meta(entry)->node.deadline = expiry;
+    }
+    return entry;
+}
+
+//-- The size alloc_entry was called with, recomputed from the entry --//
+static size_t entry_alloc_size(const Entry *entry) {
+    size_t size = ENTRY_HEADER_SIZE + entry->key_len + 1;
+    if (entry->flags & ENTRY_F_EXPIRE_META) size += sizeof(ExpireMeta);
+    if (entry->type == VALUE_STRING && entry->encoding == ENCODING_EMBSTR) {
+        size += strlen(entry->data.string_value) + 1;
+    }
+    return size;
+}
+
+static void free_entry_memory(Entry *entry) {
+    if (entry->flags & ENTRY_F_EXPIRE_META) {
+        mem_free(entry_expire_meta(entry), entry_alloc_size(entry));
+    } else {
+        mem_free(entry, entry_alloc_size(entry));
+    }
+}
+
+static Entry *new_int_entry(const char *key, size_t len, uint64_t h, long long v, long long expiry) {
+    Entry *entry = alloc_entry(key, len, h, 0, expiry);
+    if (!entry) return NULL;
+    entry->type = VALUE_STRING;
+    entry->encoding = ENCODING_INT;
+    entry->data.int_value = v;
+    return entry;
+}
+
+static Entry *new_string_entry(const char *key, size_t len, uint64_t h, const char *value, long long expiry) {
+    size_t vlen = strlen(value);
+    long long v;
+    if (string2ll(value, vlen, &v)) {
+        return new_int_entry(key, len, h, v, expiry);
+    }
+    int embed = vlen <= ENTRY_EMBED_MAX;
+
+    Entry *entry = alloc_entry(key, len, h, embed ? vlen + 1 : 0, expiry);
+    if (!entry) return NULL;
+    entry->type = VALUE_STRING;
+
+    if (embed) {
+        entry->encoding = ENCODING_EMBSTR;
+        entry->data.string_value = entry->key + len + 1;
+        memcpy(entry->data.string_value, value, vlen + 1);
+    } else {
+        entry->encoding = ENCODING_RAW;
+        entry->data.string_value = mem_strdup(value);
+        if (!entry->data.string_value) {
+            free_entry_memory(entry);
+            return NULL;
+        }
+    }
+    return entry;
+}
+
+static Entry *new_list_entry(const char *key, size_t len, uint64_t h) {
+    Entry *entry = alloc_entry(key, len, h, 0, 0);
+    if (!entry) return NULL;
+    entry->type = VALUE_LIST;
+    entry->encoding = ENCODING_RAW;
+    entry->data.list_value = list_create();
+    if (!entry->data.list_value) {
+        free_entry_memory(entry);
+        return NULL;
+    }
+    return entry;
+}
+
+static void free_entry(Entry *entry) {
+    free_value(entry);
+    free_entry_memory(entry);
+}
+
+static void free_entry_deferred(void *ptr) {
+    free_entry(ptr);
+}
+
+//-- For entries whose value was handed over to a clone --//
+static void free_entry_shell(void *ptr) {
+    free_entry_memory(ptr);
+}
+
+//-- Allocations free_entry will release beyond the entry itself --//
+static size_t entry_free_effort(const Entry *entry) {
+    if (entry->type == VALUE_LIST) return list_length(entry->data.list_value);
+    return 1;
+}
+
+/*
+ * Free an unlinked entry once no lock-free reader can still reach it.
+ * Values too big to free in one go are handed to the lazyfree thread
+ * instead of whichever client thread ends the grace period.
+ */
+static void retire_entry(Entry *entry) {
+    if (entry_free_effort(entry) > LAZYFREE_THRESHOLD) {
+        lazyfree_retire(entry, free_entry_deferred);
+    } else {
+        epoch_retire(entry, free_entry_deferred);
+    }
+}
+
+/*
+ * An entry with a TTL sits in its stripe's timing wheel exactly while it
+ * is linked into the table; every link and unlink below keeps that true.
+ */
+static void schedule_entry(Entry *entry, uint64_t h) {
+    if (entry->flags & ENTRY_F_EXPIRE_META) {
+        wheel_add(key_wheel(h), &entry_expire_meta(entry)->node, entry_deadline(entry));
+    }
+}
+
+static void unschedule_entry(Entry *entry, uint64_t h) {
+    if (entry->flags & ENTRY_F_EXPIRE_META) {
+        wheel_remove(key_wheel(h), &entry_expire_meta(entry)->node);
+    }
+}
+
+//-- Publish entry for key, replacing (and retiring) any previous one; caller holds the stripe --//
+static int store_entry(unsigned int idx, Entry *entry, uint64_t h) {
+    Entry *old = bucket_find(idx, entry->key, entry->key_len, h);
+    if (old) {
+        bucket_replace(idx, old, entry, h);
+        unschedule_entry(old, h);
+        retire_entry(old);
+    } else if (bucket_insert(idx, entry, h) != 0) {
+        return -1;
+    }
+    schedule_entry(entry, h);
+    return 0;
+}
+
+/*
+ * Copy an entry into a new allocation with a TTL (expiry > 0) or without
+ * one. The value is shared with old, so old must then be retired with
+ * free_entry_shell. Caller holds the stripe.
+ */
+static Entry *clone_entry(const Entry *old, long long expiry) {
+    size_t extra = 0;
+    if (old->type == VALUE_STRING && old->encoding == ENCODING_EMBSTR) {
+        extra = strlen(old->data.string_value) + 1;
+    }
+    Entry *entry = alloc_entry(old->key, old->key_len, old->hash, extra, expiry);
+    if (!entry) return NULL;
+    entry->type = old->type;
+    entry->encoding = old->encoding;
+    entry->access = old->access;
+    entry->data = old->data;
+    if (extra) {
+        entry->data.string_value = entry->key + old->key_len + 1;
+        memcpy(entry->data.string_value, old->data.string_value, extra);
+    }
+    return entry;
+}
+
+static void replace_with_clone(unsigned int idx, Entry *old, Entry *clone, uint64_t h) {
+    bucket_replace(idx, old, clone, h);
+    unschedule_entry(old, h);
+    schedule_entry(clone, h);
+    epoch_retire(old, free_entry_shell);
+}
+
+//-- Unlink an entry and retire it; caller holds the stripe --//
+static void remove_entry(unsigned int idx, Entry *entry, uint64_t h) {
+    bucket_unlink(idx, entry, h);
+    unschedule_entry(entry, h);
+    retire_entry(entry);
+}
+
+//-- Unlink an expired entry and count it; caller holds the stripe --//
+static void reclaim_expired(unsigned int idx, Entry *entry, uint64_t h) {
+    remove_entry(idx, entry, h);
+    __atomic_fetch_add(&stat_expired_keys, 1, __ATOMIC_RELAXED);
+}
+
+/* ==================== Access Tracking ==================== */
+
+void hashtable_set_lfu_params(int log_factor, int decay_time) {
+    __atomic_store_n(&lfu_log_factor, log_factor, __ATOMIC_RELAXED);
+    __atomic_store_n(&lfu_decay_time, decay_time, __ATOMIC_RELAXED);
+}
+
+uint8_t lfu_decayed(uint32_t access, uint32_t clock) {
+    uint8_t counter = access_counter(access);
+    int decay_time = __atomic_load_n(&lfu_decay_time, __ATOMIC_RELAXED);
+    if (decay_time <= 0) return counter;
+    uint32_t periods = lru_idle_seconds(access, clock) / 60 / (uint32_t)decay_time;
+    return periods >= counter ? 0 : (uint8_t)(counter - periods);
+}
+
+//-- xorshift64 per thread: lookups cannot afford rand()'s lock --//
+static inline uint64_t next_random(void) {
+    static __thread uint64_t seed;
+    if (!seed) seed = (uint64_t)(uintptr_t)&seed * 0x9e3779b97f4a7c15ULL | 1;
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return seed;
+}
+
+uint8_t lfu_log_incr(uint8_t counter) {
+    if (counter == 255) return counter;
+    uint64_t base = counter > LFU_INIT_VAL ? counter - LFU_INIT_VAL : 0;
+    uint64_t odds = base * (uint64_t)__atomic_load_n(&lfu_log_factor, __ATOMIC_RELAXED) + 1;
+    //-- p = 1/odds, drawn from 32 random bits without a division --//
+    return (next_random() >> 32) * odds < (1ULL << 32) ? counter + 1 : counter;
+}
+
+/*
+ * Refresh the access word of an entry a reader found. Racing readers may
+ * lose each other's increment, which only makes the counter a little more
+ * approximate; the store is skipped when nothing changed, so a hot key
+ * written by many cores costs one store per second plus the rare bump.
+ */
+static inline void entry_touch(Entry *entry, long long now) {
+    uint32_t access = __atomic_load_n(&entry->access, __ATOMIC_RELAXED);
+    uint32_t clock = lru_clock_at(now);
+    uint8_t counter = lfu_log_incr(lfu_decayed(access, clock));
+    uint32_t next = ((uint32_t)counter << LRU_CLOCK_BITS) | clock;
+    if (next != access) __atomic_store_n(&entry->access, next, __ATOMIC_RELAXED);
+}
+
+/*
+ * Find a live entry without locking (caller is inside an epoch). An
+ * expired entry is reclaimed under the stripe and reported as missing.
+ */
+static Entry *lookup_live(unsigned int idx, const char *key, size_t len, uint64_t h) {
+    Entry *entry = bucket_find(idx, key, len, h);
+    if (!entry) return NULL;
+    //-- One clock read serves both the TTL check and the access word --//
+    long long now = current_millis();
+    if (!entry_expired(entry, now)) {
+        entry_touch(entry, now);
+        return entry;
+    }
+
+    stripe_lock_acquire(key_stripe(h));
+    entry = bucket_find(idx, key, len, h);
+    if (entry && entry_expired(entry, now)) {
+        reclaim_expired(idx, entry, h);
+    }
+    stripe_lock_release(key_stripe(h));
+    return NULL;
+}
+
+static inline long long load_int(const Entry *entry) {
+    return __atomic_load_n(&entry->data.int_value, __ATOMIC_RELAXED);
+}
+
+/* ==================== Public API ==================== */
+
+void set_value(const char *key, const char *value, long long px) {
+    set_value_at(key, value, (px > 0) ? current_millis() + px : 0);
+}
+
+void set_value_at(const char *key, const char *value, long long deadline) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    unsigned int idx = h % TABLE_SIZE;
+
+    //-- Build the entry before locking: only the publish needs the stripe --//
+    Entry *entry = new_string_entry(key, len, h, value, deadline);
+    if (!entry) return;
+    stripe_lock_acquire(key_stripe(h));
+
+    //-- Overwrite: the value may be embedded, so swap in the rebuilt entry --//
+    if (store_entry(idx, entry, h) != 0) {
+        free_entry(entry);
+    }
+    stripe_lock_release(key_stripe(h));
 }
 
 const char *get_value(const char *key) {
-    unsigned int idx = hash(key);
-    pthread_mutex_lock(&bucket_mutex[idx]);
-    Entry *prev = NULL;
-    Entry *entry = HASHTABLE[idx];
+    static __thread char int_buf[LL_STR_SIZE];
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    unsigned int idx = h % TABLE_SIZE;
+    epoch_enter();
+
+    const char *result = NULL;
+    Entry *entry = lookup_live(idx, key, len, h);
+    if (entry && entry->type == VALUE_STRING) {
+        if (entry->encoding != ENCODING_INT) {
+            result = entry->data.string_value;
+        } else {
+            long long v = load_int(entry);
+            result = shared_integer(v, NULL);
+            if (!result) {
+                ll2str(int_buf, v);
+                result = int_buf;
+            }
+        }
+    }
+    epoch_exit();
+    return result;
+}
+
+static void fill_string(const Entry *entry, StringValue *out) {
+    if (entry && entry->type == VALUE_STRING) {
+        if (entry->encoding == ENCODING_INT) {
+            out->ptr = NULL;
+            out->len = 0;
+            out->is_int = 1;
+            out->int_value = load_int(entry);
+        } else {
+            out->ptr = entry->data.string_value;
+            out->len = strlen(out->ptr);
+            out->is_int = 0;
+            out->int_value = 0;
+        }
+    } else {
+        out->ptr = NULL;
+        out->len = 0;
+        out->is_int = 0;
+        out->int_value = 0;
+    }
+}
+
+int get_string(const char *key, StringValue *out) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    unsigned int idx = h % TABLE_SIZE;
+    epoch_enter();
+
+    Entry *entry = lookup_live(idx, key, len, h);
+    int found = entry && entry->type == VALUE_STRING;
+    if (found) {
+        fill_string(entry, out);
+    }
+    epoch_exit();
+    return found;
+}
+
+/* ==================== Multi-Key ==================== */
+
+typedef struct KeyRef {
+    uint64_t hash;
+    size_t len;
+    size_t pos;          //- index in the caller's arrays -//
+    Entry *entry;        //- MSET: the prebuilt entry -//
+} KeyRef;
+
+static inline unsigned int stripe_of(uint64_t h) {
+    return (unsigned int)(h & (LOCK_STRIPES - 1));
+}
+
+//-- Stage 1: the bucket head cell (chain) or table header (Swiss) --//
+static inline void prefetch_bucket(unsigned int idx) {
+    __builtin_prefetch(&HASHTABLE[idx]);
+}
+
+//-- Stage 2: the first entry (chain) or control group (Swiss) --//
+static inline void prefetch_probe(unsigned int idx, uint64_t h) {
+#ifdef MEMORA_SWISS_INDEX
+    swiss_prefetch(&HASHTABLE[idx], h);
+#else
+    (void)h;
+    Entry *head = __atomic_load_n(&HASHTABLE[idx], __ATOMIC_ACQUIRE);
+    if (head) __builtin_prefetch(head);
+#endif
+}
+
+size_t get_strings(const char *const *keys, size_t n, StringValue *out) {
+    uint64_t *hashes = malloc(n * sizeof(uint64_t));
+    size_t *lens = malloc(n * sizeof(size_t));
+    if (!hashes || !lens) {
+        free(hashes);
+        free(lens);
+        //-- Out of memory: fall back to one lookup at a time --//
+        size_t found = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (get_string(keys[i], &out[i])) {
+                found++;
+            } else {
+                fill_string(NULL, &out[i]);
+            }
+        }
+        return found;
+    }
+
+    epoch_enter();
+    for (size_t i = 0; i < n; i++) {
+        lens[i] = strlen(keys[i]);
+        hashes[i] = hash_key(keys[i], lens[i]);
+        prefetch_bucket(hashes[i] % TABLE_SIZE);
+    }
+    for (size_t i = 0; i < n; i++) {
+        prefetch_probe(hashes[i] % TABLE_SIZE, hashes[i]);
+    }
+
+    size_t found = 0;
+    for (size_t i = 0; i < n; i++) {
+        Entry *entry = lookup_live(hashes[i] % TABLE_SIZE, keys[i], lens[i], hashes[i]);
+        fill_string(entry, &out[i]);
+        found += out[i].ptr != NULL || out[i].is_int;
+    }
+    epoch_exit();
+
+    free(hashes);
+    free(lens);
+    return found;
+}
+
+static int compare_by_stripe(const void *a, const void *b) {
+    const KeyRef *x = a, *y = b;
+    unsigned int sx = stripe_of(x->hash), sy = stripe_of(y->hash);
+    if (sx != sy) return sx < sy ? -1 : 1;
+    //-- Keep argument order inside a stripe so later duplicates win --//
+    return x->pos < y->pos ? -1 : x->pos > y->pos;
+}
+
+int set_values(const char *const *keys, const char *const *values, size_t n, int nx) {
+    if (n == 0) return 1;
+    KeyRef *refs = malloc(n * sizeof(KeyRef));
+    if (!refs) return -1;
+
+    //-- Hash and build every entry before taking any lock --//
+    for (size_t i = 0; i < n; i++) {
+        refs[i].len = strlen(keys[i]);
+        refs[i].hash = hash_key(keys[i], refs[i].len);
+        refs[i].pos = i;
+        refs[i].entry = new_string_entry(keys[i], refs[i].len, refs[i].hash, values[i], 0);
+        if (!refs[i].entry) {
+            for (size_t j = 0; j < i; j++) free_entry(refs[j].entry);
+            free(refs);
+            return -1;
+        }
+        prefetch_bucket(refs[i].hash % TABLE_SIZE);
+    }
+    qsort(refs, n, sizeof(KeyRef), compare_by_stripe);
     long long now = current_millis();
 
-    while (entry) {
-        if (strcmp(entry->key, key) == 0) {
-            if (entry->expiry > 0 && entry->expiry <= now) {
-                if (prev)
-                    prev->next = entry->next;
-                else
-                    HASHTABLE[idx] = entry->next;
-
-                free(entry->key);
-                if (entry->type == VALUE_STRING) {
-                    free(entry->data.string_value);
-                } else if (entry->type == VALUE_LIST) {
-                    list_free(entry->data.list_value);
-                }
-                free(entry);
-                pthread_mutex_unlock(&bucket_mutex[idx]);
-                return NULL;
+    //-- Ascending stripe order on every path, so two MSETs cannot deadlock --//
+    for (size_t i = 0; i < n; i++) {
+        if (i == 0 || stripe_of(refs[i].hash) != stripe_of(refs[i - 1].hash)) {
+            stripe_lock_acquire(&key_locks[stripe_of(refs[i].hash)]);
+        }
+    }
+
+    int exists = 0;
+    if (nx) {
+        for (size_t i = 0; i < n && !exists; i++) {
+            Entry *old = bucket_find(refs[i].hash % TABLE_SIZE, keys[refs[i].pos], refs[i].len, refs[i].hash);
+            exists = old && !entry_expired(old, now);
+        }
+    }
+
+    int rc = exists ? 0 : 1;
+    for (size_t i = 0; i < n; i++) {
+        if (!exists && store_entry(refs[i].hash % TABLE_SIZE, refs[i].entry, refs[i].hash) == 0) {
+            refs[i].entry = NULL;
+        }
+    }
+
+    for (size_t i = n; i-- > 0;) {
+        if (i == 0 || stripe_of(refs[i].hash) != stripe_of(refs[i - 1].hash)) {
+            stripe_lock_release(&key_locks[stripe_of(refs[i].hash)]);
+        }
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        if (refs[i].entry) {
+            if (!exists) rc = -1;  //- insert failed: index out of memory -//
+            free_entry(refs[i].entry);
+        }
+    }
+    free(refs);
+    return rc;
+}
+
+incr_status_t incr_by(const char *key, long long delta, long long *result) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    unsigned int idx = h % TABLE_SIZE;
+    incr_status_t status = INCR_OK;
+    long long now = current_millis();
+    stripe_lock_acquire(key_stripe(h));
+
+    long long current = 0;
+    Entry *entry = bucket_find(idx, key, len, h);
+    if (entry && entry_expired(entry, now)) {
+        reclaim_expired(idx, entry, h);
+        entry = NULL;
+    }
+
+    if (entry && entry->type != VALUE_STRING) {
+        status = INCR_WRONGTYPE;
+    } else if (entry && entry->encoding == ENCODING_INT) {
+        current = entry->data.int_value;
+    } else if (entry && !string2ll(entry->data.string_value, strlen(entry->data.string_value), &current)) {
+        status = INCR_NOT_INTEGER;
+    }
+
+    long long next = 0;
+    if (status == INCR_OK && __builtin_add_overflow(current, delta, &next)) {
+        status = INCR_OVERFLOW;
+    }
+
+    if (status == INCR_OK) {
+        if (entry && entry->encoding == ENCODING_INT) {
+            //-- Counters update in place: readers load int_value atomically --//
+            __atomic_store_n(&entry->data.int_value, next, __ATOMIC_RELAXED);
+        } else {
+            Entry *fresh = new_int_entry(key, len, h, next, entry ? entry_deadline(entry) : 0);
+            if (!fresh) {
+                status = INCR_NOMEM;
             } else {
-                if (entry->type == VALUE_STRING) {
-                    const char *result = entry->data.string_value;
-                    pthread_mutex_unlock(&bucket_mutex[idx]);
-                    return result;
+                if (store_entry(idx, fresh, h) != 0) {
+                    free_entry(fresh);
+                    status = INCR_NOMEM;
                 }
-                pthread_mutex_unlock(&bucket_mutex[idx]);
-                return NULL;
             }
         }
-        prev = entry;
-        entry = entry->next;
     }
+    stripe_lock_release(key_stripe(h));
 
-    pthread_mutex_unlock(&bucket_mutex[idx]);
-    return NULL;
+    if (status == INCR_OK) *result = next;
+    return status;
 }
 
-List *get_or_create_list(const char *key) {
-    unsigned int idx = hash(key);
-    pthread_mutex_lock(&bucket_mutex[idx]);
-    Entry *entry = HASHTABLE[idx];
+incr_status_t incr_by_float(const char *key, long double delta, char *out, size_t *out_len) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    unsigned int idx = h % TABLE_SIZE;
+    incr_status_t status = INCR_OK;
     long long now = current_millis();
+    stripe_lock_acquire(key_stripe(h));
 
-    while (entry) {
-        if (strcmp(entry->key, key) == 0) {
-            if (entry->expiry > 0 && entry->expiry <= now) {
-                pthread_mutex_unlock(&bucket_mutex[idx]);
-                return NULL;
-            }
-            if (entry->type == VALUE_LIST) {
-                List *list = entry->data.list_value;
-                pthread_mutex_unlock(&bucket_mutex[idx]);
-                return list;
+    long double current = 0;
+    Entry *entry = bucket_find(idx, key, len, h);
+    if (entry && entry_expired(entry, now)) {
+        reclaim_expired(idx, entry, h);
+        entry = NULL;
+    }
+
+    if (entry && entry->type != VALUE_STRING) {
+        status = INCR_WRONGTYPE;
+    } else if (entry && entry->encoding == ENCODING_INT) {
+        current = (long double)entry->data.int_value;
+    } else if (entry && !string2ld(entry->data.string_value, strlen(entry->data.string_value), &current)) {
+        status = INCR_NOT_FLOAT;
+    }
+
+    if (status == INCR_OK) {
+        long double next = current + delta;
+        if (!isfinite(next)) {
+            status = INCR_OVERFLOW;
+        } else {
+            *out_len = ld2str(out, next);
+            //-- Stored as text; integral results become ENCODING_INT again --//
+            Entry *fresh = new_string_entry(key, len, h, out, entry ? entry_deadline(entry) : 0);
+            if (!fresh) {
+                status = INCR_NOMEM;
             } else {
-                pthread_mutex_unlock(&bucket_mutex[idx]);
-                return NULL;
+                if (store_entry(idx, fresh, h) != 0) {
+                    free_entry(fresh);
+                    status = INCR_NOMEM;
+                }
             }
         }
-        entry = entry->next;
     }
+    stripe_lock_release(key_stripe(h));
+    return status;
+}
+
+//-- Find (or create) the list at key; caller holds the stripe --//
+static List *list_under_stripe(unsigned int idx, const char *key, size_t len, uint64_t h, int create) {
+    long long now = current_millis();
+    Entry *entry = bucket_find(idx, key, len, h);
+    if (entry && entry_expired(entry, now)) {
+        reclaim_expired(idx, entry, h);
+        entry = NULL;
+    }
+    if (entry) {
+        if (entry->type != VALUE_LIST) return NULL;
+        entry_touch(entry, now);
+        return entry->data.list_value;
+    }
+    if (!create) return NULL;
 
     //-- Not found, create new list entry --//
-    Entry *new_entry = malloc(sizeof(Entry));
-    if (!new_entry) {
-        pthread_mutex_unlock(&bucket_mutex[idx]);
+    entry = new_list_entry(key, len, h);
+    if (!entry) return NULL;
+    if (bucket_insert(idx, entry, h) != 0) {
+        free_entry(entry);
         return NULL;
     }
-    new_entry->key = strdup(key);
-    new_entry->type = VALUE_LIST;
-    new_entry->data.list_value = list_create();
-    new_entry->expiry = 0;
-    new_entry->next = HASHTABLE[idx];
-    HASHTABLE[idx] = new_entry;
+    return entry->data.list_value;
+}
+
+List *get_or_create_list(const char *key) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    unsigned int idx = h % TABLE_SIZE;
 
-    List *list = new_entry->data.list_value;
-    pthread_mutex_unlock(&bucket_mutex[idx]);
+    //-- Fast path: the list usually exists already --//
+    epoch_enter();
+    Entry *entry = lookup_live(idx, key, len, h);
+    if (entry) {
+        List *list = entry->type == VALUE_LIST ? entry->data.list_value : NULL;
+        epoch_exit();
+        return list;
+    }
+    epoch_exit();
+
+    //-- Created (or replaced) by another writer in between, or created here --//
+    stripe_lock_acquire(key_stripe(h));
+    List *list = list_under_stripe(idx, key, len, h, 1);
+    stripe_lock_release(key_stripe(h));
     return list;
 }
 
 List *get_list_if_exists(const char *key) {
-    unsigned int idx = hash(key);
-    pthread_mutex_lock(&bucket_mutex[idx]);
-    Entry *entry = HASHTABLE[idx];
-    long long now = current_millis();
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    unsigned int idx = h % TABLE_SIZE;
+    epoch_enter();
 
-    while (entry) {
-        if (strcmp(entry->key, key) == 0) {
-            if (entry->expiry > 0 && entry->expiry <= now) {
-                pthread_mutex_unlock(&bucket_mutex[idx]);
-                return NULL;
-            }
-            if (entry->type == VALUE_LIST) {
-                List *list = entry->data.list_value;
-                pthread_mutex_unlock(&bucket_mutex[idx]);
-                return list;
-            } else {
-                pthread_mutex_unlock(&bucket_mutex[idx]);
-                return NULL;
-            }
-        }
-        entry = entry->next;
+    List *list = NULL;
+    Entry *entry = lookup_live(idx, key, len, h);
+    if (entry && entry->type == VALUE_LIST) {
+        list = entry->data.list_value;
     }
-    pthread_mutex_unlock(&bucket_mutex[idx]);
-    return NULL;
+    epoch_exit();
+    return list;
+}
+
+List *lock_list(const char *key, int create, StripeLock **lock) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    *lock = key_stripe(h);
+    stripe_lock_acquire(*lock);
+    return list_under_stripe((unsigned int)(h % TABLE_SIZE), key, len, h, create);
+}
+
+/*
+ * Unlink a key and retire its entry. With lazy set, big values go to the
+ * lazyfree thread (retire_entry); otherwise the memory is freed by the
+ * thread that ends the grace period, whatever the value's size.
+ */
+static int detach_key(const char *key, int lazy) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    unsigned int idx = h % TABLE_SIZE;
+    stripe_lock_acquire(key_stripe(h));
+
+    Entry *entry = bucket_find(idx, key, len, h);
+    if (!entry) {
+        stripe_lock_release(key_stripe(h));
+        return 0;
+    }
+
+    if (lazy) {
+        remove_entry(idx, entry, h);
+    } else {
+        bucket_unlink(idx, entry, h);
+        unschedule_entry(entry, h);
+        epoch_retire(entry, free_entry_deferred);
+    }
+
+    stripe_lock_release(key_stripe(h));
+    return 1;
 }
 
 /**
  * Delete a key from the hash table, handling both string and list types.
- * Removes the entry from the linked list and frees all associated memory.
+ * Removes the entry from its bucket and retires it; the memory is freed
+ * once concurrent readers have moved on.
  */
 int delete_key(const char *key) {
-    unsigned int idx = hash(key);
-    pthread_mutex_lock(&bucket_mutex[idx]);
-    Entry *prev = NULL;
-    Entry *entry = HASHTABLE[idx];
+    return detach_key(key, __atomic_load_n(&lazy_user_del, __ATOMIC_RELAXED));
+}
 
-    while (entry) {
-        if (strcmp(entry->key, key) == 0) {
-            if (prev)
-                prev->next = entry->next;
-            else
-                HASHTABLE[idx] = entry->next;
-
-            free(entry->key);
-            if (entry->type == VALUE_STRING) {
-                free(entry->data.string_value);
-            } else if (entry->type == VALUE_LIST) {
-                list_free(entry->data.list_value);
-            }
-            free(entry);
-            
-            pthread_mutex_unlock(&bucket_mutex[idx]);
-            return 1;
+int unlink_key(const char *key) {
+    return detach_key(key, 1);
+}
+
+void hashtable_set_lazy_user_del(int enabled) {
+    __atomic_store_n(&lazy_user_del, enabled != 0, __ATOMIC_RELAXED);
+}
+
+const char *get_type(const char *key) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    unsigned int idx = h % TABLE_SIZE;
+    epoch_enter();
+
+    const char *typeStr = "none";
+    Entry *entry = lookup_live(idx, key, len, h);
+    if (entry) {
+        if (entry->type == VALUE_STRING) {
+            typeStr = "string";
+        } else if (entry->type == VALUE_LIST) {
+            typeStr = "list";
         }
-        prev = entry;
-        entry = entry->next;
     }
-    
-    pthread_mutex_unlock(&bucket_mutex[idx]);
-    return 0;
+    epoch_exit();
+    return typeStr;
 }
 
-const char *get_type(const char *key) {
-    unsigned int idx = hash(key);
-    pthread_mutex_lock(&bucket_mutex[idx]);
-    Entry *entry = HASHTABLE[idx];
+int get_key_access(const char *key, uint32_t *idle, uint8_t *freq) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    unsigned int idx = h % TABLE_SIZE;
+    long long now = current_millis();
+    epoch_enter();
+
+    //-- A peek: lookup_live would count it as an access --//
+    Entry *entry = bucket_find(idx, key, len, h);
+    int found = entry && !entry_expired(entry, now);
+    if (found) {
+        uint32_t access = __atomic_load_n(&entry->access, __ATOMIC_RELAXED);
+        *idle = lru_idle_seconds(access, lru_clock_at(now));
+        *freq = lfu_decayed(access, lru_clock_at(now));
+    }
+    epoch_exit();
+    return found;
+}
+
+/* ==================== TTL ==================== */
+
+static int expire_allowed(long long current, long long deadline, expire_cond_t cond) {
+    //-- A key without a TTL counts as never expiring --//
+    switch (cond) {
+    case EXPIRE_NX: return current == 0;
+    case EXPIRE_XX: return current != 0;
+    case EXPIRE_GT: return current != 0 && deadline > current;
+    case EXPIRE_LT: return current == 0 || deadline < current;
+    default:        return 1;
+    }
+}
+
+int set_expiry(const char *key, long long deadline, expire_cond_t cond) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    unsigned int idx = h % TABLE_SIZE;
     long long now = current_millis();
+    int rc = 1;
+    stripe_lock_acquire(key_stripe(h));
+
+    Entry *entry = bucket_find(idx, key, len, h);
+    if (entry && entry_expired(entry, now)) {
+        reclaim_expired(idx, entry, h);
+        entry = NULL;
+    }
+
+    if (!entry || !expire_allowed(entry_deadline(entry), deadline, cond)) {
+        rc = 0;
+    } else if (deadline <= now) {
+        //-- A deadline in the past deletes the key right away --//
+        remove_entry(idx, entry, h);
+    } else if (entry->flags & ENTRY_F_EXPIRE_META) {
+        //-- Already has a TTL: move its wheel node, the entry stays in place --//
+        wheel_update(key_wheel(h), &entry_expire_meta(entry)->node, deadline);
+    } else {
+        Entry *clone = clone_entry(entry, deadline);
+        if (clone) {
+            replace_with_clone(idx, entry, clone, h);
+        } else {
+            rc = -1;
+        }
+    }
+    stripe_lock_release(key_stripe(h));
+    return rc;
+}
+
+long long get_ttl_ms(const char *key) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    unsigned int idx = h % TABLE_SIZE;
+    epoch_enter();
+
+    long long ttl = -2;
+    Entry *entry = lookup_live(idx, key, len, h);
+    if (entry) {
+        long long deadline = entry_deadline(entry);
+        ttl = deadline ? deadline - current_millis() : -1;
+        if (deadline && ttl < 0) ttl = 0;
+    }
+    epoch_exit();
+    return ttl;
+}
+
+int persist_key(const char *key) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    unsigned int idx = h % TABLE_SIZE;
+    long long now = current_millis();
+    int rc = 0;
+    stripe_lock_acquire(key_stripe(h));
+
+    Entry *entry = bucket_find(idx, key, len, h);
+    if (entry && entry_expired(entry, now)) {
+        reclaim_expired(idx, entry, h);
+    } else if (entry && (entry->flags & ENTRY_F_EXPIRE_META)) {
+        //-- Drop the ExpireMeta too, so a persisted key stops paying for it --//
+        Entry *clone = clone_entry(entry, 0);
+        if (clone) {
+            replace_with_clone(idx, entry, clone, h);
+            rc = 1;
+        } else {
+            rc = -1;
+        }
+    }
+    stripe_lock_release(key_stripe(h));
+    return rc;
+}
+
+/* ==================== SCAN ==================== */
+
+static unsigned long reverse_bits(unsigned long v) {
+    unsigned long r = 0;
+    for (size_t i = 0; i < sizeof(v) * 8; i++) {
+        r = (r << 1) | (v & 1);
+        v >>= 1;
+    }
+    return r;
+}
+
+typedef struct ScanState {
+    scan_fn fn;
+    void *ctx;
+    long long now;
+    size_t seen;
+} ScanState;
+
+static void scan_entry(Entry *entry, void *arg) {
+    ScanState *st = arg;
+    st->seen++;
+    if (!entry_expired(entry, st->now)) {
+        st->fn(entry, st->ctx);
+    }
+}
+
+/*
+ * The cursor is the next bucket index with its bits reversed, and it is
+ * advanced by incrementing the reversed value. With a 2^n table this
+ * visits bucket b before all of b's "children" (b + k * 2^n) in any
+ * larger table, so a resize between calls never skips a bucket range.
+ */
+unsigned long hashtable_scan(unsigned long cursor, size_t count, scan_fn fn, void *ctx) {
+    const unsigned long mask = TABLE_SIZE - 1;
+    ScanState st = { fn, ctx, current_millis(), 0 };
+    size_t max_buckets = (count ? count : 1) * 10;
+
+    do {
+        bucket_for_each((unsigned int)(cursor & mask), scan_entry, &st);
+
+        //-- Increment the reversed cursor, ignoring bits above the mask --//
+        cursor |= ~mask;
+        cursor = reverse_bits(cursor);
+        cursor++;
+        cursor = reverse_bits(cursor);
+    } while (cursor && st.seen < count && --max_buckets);
+
+    return cursor;
+}
+
+/* ==================== Ordered Scan ==================== */
+
+typedef struct OrderedScan {
+    scan_fn fn;
+    void *ctx;
+    long long now;
+    size_t count;
+    size_t seen;
+    const char *last;   //- last name visited; lives in the index, copy it before unlocking -//
+    size_t last_len;
+} OrderedScan;
+
+static int ordered_visit(const char *key, size_t len, void *arg) {
+    OrderedScan *st = arg;
+    uint64_t h = hash_key(key, len);
+    Entry *entry = bucket_find((unsigned int)(h % TABLE_SIZE), key, len, h);
+    if (entry && !entry_expired(entry, st->now)) {
+        st->fn(entry, st->ctx);
+    }
+    st->last = key;
+    st->last_len = len;
+    return st->count && ++st->seen >= st->count;
+}
+
+int hashtable_scan_prefix(const char *prefix, const char *after, size_t count,
+                          scan_fn fn, void *ctx, char **next) {
+    OrderedScan st = { fn, ctx, current_millis(), count, 0, NULL, 0 };
+    if (next) *next = NULL;
+    pthread_rwlock_rdlock(&key_index_lock);
+    if (!key_index_on) {
+        pthread_rwlock_unlock(&key_index_lock);
+        return -1;
+    }
+    int rc = 0;
+    if (art_prefix(&key_index, prefix, strlen(prefix), after, after ? strlen(after) : 0, ordered_visit, &st) && next) {
+        *next = malloc(st.last_len + 1);
+        if (*next) {
+            memcpy(*next, st.last, st.last_len + 1);
+        } else {
+            rc = -1;
+        }
+    }
+    pthread_rwlock_unlock(&key_index_lock);
+    return rc;
+}
+
+static void index_visit(Entry *entry, void *arg) {
+    int *rc = arg;
+    if (*rc == 0 && art_insert(&key_index, entry->key, entry->key_len) < 0) *rc = -1;
+}
+
+int hashtable_set_key_index(int enabled) {
+    pthread_rwlock_wrlock(&key_index_lock);
+    int was_on = key_index_on;
+    __atomic_store_n(&key_index_on, enabled != 0, __ATOMIC_RELAXED);
+    if (!enabled) art_clear(&key_index);
+    pthread_rwlock_unlock(&key_index_lock);
+    if (!enabled || was_on) return 0;
+
+    //-- New keys index themselves from here on; add the ones already stored, a stripe at a time --//
+    int rc = 0;
+    for (unsigned int s = 0; s < LOCK_STRIPES && rc == 0; s++) {
+        stripe_lock_acquire(&key_locks[s]);
+        pthread_rwlock_wrlock(&key_index_lock);
+        for (unsigned int idx = s; idx < TABLE_SIZE && key_index_on; idx += LOCK_STRIPES) {
+            bucket_for_each(idx, index_visit, &rc);
+        }
+        pthread_rwlock_unlock(&key_index_lock);
+        stripe_lock_release(&key_locks[s]);
+    }
+    if (rc != 0) hashtable_set_key_index(0);
+    return rc;
+}
+
+int hashtable_key_index_enabled(void) {
+    return __atomic_load_n(&key_index_on, __ATOMIC_RELAXED);
+}
+
+void hashtable_key_index_stats(size_t *keys, size_t *bytes) {
+    pthread_rwlock_rdlock(&key_index_lock);
+    *keys = key_index.size;
+    *bytes = key_index.bytes;
+    pthread_rwlock_unlock(&key_index_lock);
+}
+
+/* ==================== Active Expiry ==================== */
+
+typedef struct ExpireWalk {
+    long long now;
+    ExpireSample *sample;
+} ExpireWalk;
+
+static void expire_visit(Entry *entry, void *arg) {
+    ExpireWalk *w = arg;
+    if (!(entry->flags & ENTRY_F_EXPIRE_META)) return;
+    w->sample->sampled++;
+    if (entry_deadline(entry) > w->now) return;
+
+    uint64_t h = entry->hash;
+    unsigned int idx = h % TABLE_SIZE;
+    stripe_lock_acquire(key_stripe(h));
+    //-- A writer may have replaced or deleted it since the lock-free walk --//
+    if (bucket_find(idx, entry->key, entry->key_len, h) == entry) {
+        reclaim_expired(idx, entry, h);
+        w->sample->expired++;
+    }
+    stripe_lock_release(key_stripe(h));
+}
+
+unsigned int hashtable_expire_sample(unsigned int cursor, size_t want, ExpireSample *out) {
+    ExpireWalk w = { current_millis(), out };
+    size_t max_buckets = (want ? want : 1) * 10;
+    out->sampled = 0;
+    out->expired = 0;
+
+    epoch_enter();
+    do {
+        bucket_for_each(cursor, expire_visit, &w);
+        cursor = (cursor + 1) % TABLE_SIZE;
+    } while (out->sampled < want && --max_buckets);
+    epoch_exit();
+    return cursor;
+}
+
+unsigned long long hashtable_expired_keys(void) {
+    return __atomic_load_n(&stat_expired_keys, __ATOMIC_RELAXED);
+}
+
+typedef struct DueState {
+    size_t reclaimed;
+} DueState;
+
+//-- Wheel callback: the entry's deadline has passed; caller holds the stripe --//
+static void reclaim_due(WheelNode *node, void *arg) {
+    DueState *st = arg;
+    Entry *entry = expire_meta_entry((ExpireMeta *)node);
+    uint64_t h = entry->hash;
+    bucket_unlink(h % TABLE_SIZE, entry, h);
+    retire_entry(entry);
+    __atomic_fetch_add(&stat_expired_keys, 1, __ATOMIC_RELAXED);
+    st->reclaimed++;
+}
+
+size_t hashtable_expire_due(long long now) {
+    DueState st = { 0 };
+    epoch_enter();
+    for (int i = 0; i < LOCK_STRIPES; i++) {
+        //-- Racy peek: an idle wheel is skipped without taking its stripe --//
+        if (__atomic_load_n(&expire_wheels[i].count, __ATOMIC_RELAXED) == 0) continue;
+        stripe_lock_acquire(&key_locks[i]);
+        wheel_advance(&expire_wheels[i], now, reclaim_due, &st);
+        stripe_lock_release(&key_locks[i]);
+    }
+    epoch_exit();
+    return st.reclaimed;
+}
+
+/* ==================== Memory Introspection ==================== */
+
+//-- Bytes the allocation behind a string occupies --//
+static size_t string_memory(const char *s) {
+    return mem_usable_size(s, strlen(s) + 1);
+}
+
+/*
+ * Every allocation a key owns, as mem_used() counts it. Lists are walked
+ * node by node, so the caller holds the stripe unless the entry is
+ * already unlinked.
+ */
+static size_t entry_memory(const Entry *entry) {
+    const void *base = (entry->flags & ENTRY_F_EXPIRE_META) ? (const void *)entry_expire_meta(entry) : entry;
+    size_t bytes = mem_usable_size(base, entry_alloc_size(entry));
+    if (entry->type == VALUE_LIST) {
+        const List *list = entry->data.list_value;
+        bytes += mem_usable_size(list, sizeof(List));
+        for (ListNode *node = list->head; node; node = node->next) {
+            bytes += mem_usable_size(node, sizeof(ListNode)) + string_memory(node->value);
+        }
+    } else if (entry->encoding == ENCODING_RAW) {
+        bytes += string_memory(entry->data.string_value);
+    }
+    return bytes;
+}
+
+size_t get_key_memory(const char *key) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    unsigned int idx = h % TABLE_SIZE;
+    long long now = current_millis();
+    size_t bytes = 0;
+
+    //-- Under the stripe, so no list node is freed while it is counted --//
+    epoch_enter();
+    stripe_lock_acquire(key_stripe(h));
+    Entry *entry = bucket_find(idx, key, len, h);
+    if (entry && !entry_expired(entry, now)) bytes = entry_memory(entry);
+    stripe_lock_release(key_stripe(h));
+    epoch_exit();
+    return bytes;
+}
+
+typedef struct MemoryWalk {
+    KeyspaceMemory *out;
+    long long now;
+} MemoryWalk;
+
+//-- Bucket callback; caller holds the stripe --//
+static void memory_visit(Entry *entry, void *arg) {
+    MemoryWalk *w = arg;
+    if (entry_expired(entry, w->now)) return;
+    TypeMemory *tm = entry->type == VALUE_LIST ? &w->out->lists : &w->out->strings;
+    tm->keys++;
+    tm->bytes += entry_memory(entry);
+    if (entry->flags & ENTRY_F_EXPIRE_META) w->out->expires++;
+}
+
+void hashtable_memory_stats(KeyspaceMemory *out) {
+    memset(out, 0, sizeof(*out));
+    MemoryWalk w = { out, current_millis() };
+    //-- One bucket per critical section: writers and reclamation only wait for one bucket --//
+    for (unsigned int idx = 0; idx < TABLE_SIZE; idx++) {
+        StripeLock *lock = &key_locks[idx % LOCK_STRIPES];
+        epoch_enter();
+        stripe_lock_acquire(lock);
+        bucket_for_each(idx, memory_visit, &w);
+        stripe_lock_release(lock);
+        epoch_exit();
+    }
+}
+
+/* ==================== Eviction ==================== */
+
+//-- Bytes an entry and its value hold, as the allocator accounts them --//
+static void free_evicted(void *ptr) {
+    Entry *entry = ptr;
+    size_t bytes = entry_memory(entry);
+    free_entry(entry);
+    __atomic_fetch_sub(&evict_pending_bytes, bytes, __ATOMIC_RELAXED);
+}
+
+size_t hashtable_sample(size_t want, scan_fn fn, void *ctx) {
+    long long now = current_millis();
+    size_t found = 0;
+    //-- A sparse keyspace hits empty buckets; give up after a bounded number of probes --//
+    for (size_t probes = 0; found < want && probes < want * 64; probes++) {
+        uint64_t r = next_random();
+        Entry *entry = bucket_sample((unsigned int)(r % TABLE_SIZE), r >> 16);
+        if (!entry || entry_expired(entry, now)) continue;
+        fn(entry, ctx);
+        found++;
+    }
+    return found;
+}
+
+size_t hashtable_evict_key(const char *key, int volatile_only) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    unsigned int idx = h % TABLE_SIZE;
+    stripe_lock_acquire(key_stripe(h));
+
+    Entry *entry = bucket_find(idx, key, len, h);
+    if (!entry || (volatile_only && !(entry->flags & ENTRY_F_EXPIRE_META))) {
+        stripe_lock_release(key_stripe(h));
+        return 0;
+    }
+
+    size_t bytes = entry_memory(entry);
+    bucket_unlink(idx, entry, h);
+    unschedule_entry(entry, h);
+    __atomic_fetch_add(&evict_pending_bytes, bytes, __ATOMIC_RELAXED);
+    if (entry_free_effort(entry) > LAZYFREE_THRESHOLD) {
+        lazyfree_retire(entry, free_evicted);
+    } else {
+        epoch_retire(entry, free_evicted);
+    }
+    stripe_lock_release(key_stripe(h));
+    return bytes;
+}
+
+size_t hashtable_evict_pending(void) {
+    return __atomic_load_n(&evict_pending_bytes, __ATOMIC_RELAXED);
+}
+
+/* ==================== Active Defrag ==================== */
+/*
+ * Moving an allocation is an overwrite that keeps the value: copy it
+ * into a denser chunk, swing the one pointer that references it and
+ * retire the old copy. The old copies go straight back to their chunks
+ * (mem_defrag_free) so those can empty out and be released.
+ */
+
+static void defrag_free_shell(void *ptr) {
+    Entry *entry = ptr;
+    size_t meta = (entry->flags & ENTRY_F_EXPIRE_META) ? sizeof(ExpireMeta) : 0;
+    mem_defrag_free((char *)entry - meta, entry_alloc_size(entry));
+}
+
+static void defrag_free_str(void *ptr) {
+    mem_defrag_free(ptr, strlen(ptr) + 1);
+}
+
+static void defrag_free_node(void *ptr) {
+    mem_defrag_free(ptr, sizeof(ListNode));
+}
+
+//-- A copy of s in a denser chunk, or NULL if s stays --//
+static char *defrag_string(char *s, DefragSample *out) {
+    size_t n = strlen(s) + 1;
+    char *copy = mem_defrag_hint(s, n) ? mem_defrag_alloc(n) : NULL;
+    if (!copy) {
+        out->misses++;
+        return NULL;
+    }
+    memcpy(copy, s, n);
+    epoch_retire(s, defrag_free_str);
+    out->hits++;
+    out->bytes_moved += n;
+    return copy;
+}
+
+static void defrag_list(List *list, DefragSample *out) {
+    ListNode **link = &list->head;
+    while (*link) {
+        ListNode *node = *link;
+        char *value = defrag_string(node->value, out);
+        if (value) __atomic_store_n(&node->value, value, __ATOMIC_RELEASE);
+
+        ListNode *copy = mem_defrag_hint(node, sizeof(ListNode)) ? mem_defrag_alloc(sizeof(ListNode)) : NULL;
+        if (copy) {
+            *copy = *node;
+            __atomic_store_n(link, copy, __ATOMIC_RELEASE);
+            if (list->tail == node) list->tail = copy;
+            epoch_retire(node, defrag_free_node);
+            out->hits++;
+            out->bytes_moved += sizeof(ListNode);
+            node = copy;
+        } else {
+            out->misses++;
+        }
+        link = &node->next;
+    }
+}
+
+typedef struct DefragWalk {
+    unsigned int idx;
+    DefragSample *sample;
+} DefragWalk;
+
+//-- Bucket callback; caller holds the stripe --//
+static void defrag_visit(Entry *entry, void *arg) {
+    DefragWalk *w = arg;
+    uint64_t h = entry->hash;
+    size_t size = entry_alloc_size(entry);
+    size_t meta = (entry->flags & ENTRY_F_EXPIRE_META) ? sizeof(ExpireMeta) : 0;
+    char *base = (char *)entry - meta;
+
+    char *copy = mem_defrag_hint(base, size) ? mem_defrag_alloc(size) : NULL;
+    if (copy) {
+        memcpy(copy, base, size);
+        Entry *moved = (Entry *)(copy + meta);
+        if (moved->type == VALUE_STRING && moved->encoding == ENCODING_EMBSTR) {
+            moved->data.string_value = moved->key + moved->key_len + 1;
+        }
+        if (meta) entry_expire_meta(moved)->node.pprev = NULL;
+        bucket_replace(w->idx, entry, moved, h);
+        unschedule_entry(entry, h);
+        schedule_entry(moved, h);
+        epoch_retire(entry, defrag_free_shell);
+        w->sample->hits++;
+        w->sample->bytes_moved += size;
+        entry = moved;
+    } else {
+        w->sample->misses++;
+    }
+
+    if (entry->type == VALUE_LIST) {
+        defrag_list(entry->data.list_value, w->sample);
+    } else if (entry->encoding == ENCODING_RAW) {
+        char *value = defrag_string(entry->data.string_value, w->sample);
+        if (value) __atomic_store_n(&entry->data.string_value, value, __ATOMIC_RELEASE);
+    }
+}
+
+unsigned int hashtable_defrag_bucket(unsigned int idx, DefragSample *out) {
+    DefragWalk w = { idx, out };
+    //-- Bucket idx holds the keys of stripe idx % LOCK_STRIPES --//
+    StripeLock *lock = &key_locks[idx % LOCK_STRIPES];
+    epoch_enter();
+    stripe_lock_acquire(lock);
+    bucket_for_each(idx, defrag_visit, &w);
+    stripe_lock_release(lock);
+    epoch_exit();
+    return (idx + 1) % TABLE_SIZE;
+}
+
+/* ==================== Flush ==================== */
+/*
+ * A flush detaches whole buckets in O(1) per bucket: the chain head (or
+ * the Swiss arrays) is swapped for an empty one under the stripe, and the
+ * detached entries are freed together after the grace period. Readers
+ * still walking a detached bucket see the old entries until they leave
+ * their epoch.
+ */
+
+#ifdef MEMORA_SWISS_INDEX
+static void free_detached_bucket(void *ptr) {
+    SwissArrays *arr = ptr;
+    for (size_t i = 0; i < arr->capacity; i++) {
+        if (arr->ctrl[i] >= 0) free_entry(arr->slots[i]);
+    }
+    swiss_free_arrays(arr);
+}
+#else
+static void free_detached_bucket(void *ptr) {
+    Entry *entry = ptr;
     while (entry) {
-        if (strcmp(entry->key, key) == 0) {
-            if (entry->expiry > 0 && entry->expiry <= now) {
-                pthread_mutex_unlock(&bucket_mutex[idx]);
-                return "none"; 
-            }
-            const char *typeStr = "none";
-            if (entry->type == VALUE_STRING) {
-                typeStr = "string";
-            } else if (entry->type == VALUE_LIST) {
-                typeStr = "list";
+        Entry *next = entry->next;
+        free_entry(entry);
+        entry = next;
+    }
+}
+#endif
+
+//-- Swap a bucket for an empty one; caller holds its stripe --//
+static void *detach_bucket(unsigned int idx) {
+#ifdef MEMORA_SWISS_INDEX
+    return swiss_detach(&HASHTABLE[idx]);
+#else
+    return __atomic_exchange_n(&HASHTABLE[idx], NULL, __ATOMIC_ACQ_REL);
+#endif
+}
+
+static void free_detached_index(void *ptr) {
+    art_clear(ptr);
+    free(ptr);
+}
+
+/*
+ * With the key index on, every stripe is held at once so that the index
+ * can be swapped out in the same step as the buckets; it never names a
+ * key the table has lost, nor misses one added right after the flush.
+ */
+void hashtable_flush(int async) {
+    long long now = current_millis();
+    int whole = hashtable_key_index_enabled();
+    for (unsigned int s = 0; s < LOCK_STRIPES; s++) {
+        stripe_lock_acquire(&key_locks[s]);
+        //-- The buckets this stripe guards: s, s + LOCK_STRIPES, ... --//
+        for (unsigned int idx = s; idx < TABLE_SIZE; idx += LOCK_STRIPES) {
+            void *bucket = detach_bucket(idx);
+            if (!bucket) continue;
+            if (async) {
+                lazyfree_retire(bucket, free_detached_bucket);
+            } else {
+                epoch_retire(bucket, free_detached_bucket);
             }
-            pthread_mutex_unlock(&bucket_mutex[idx]);
-            return typeStr;
         }
-        entry = entry->next;
+        //-- Every scheduled entry was just detached --//
+        wheel_init(&expire_wheels[s], now);
+        if (!whole) stripe_lock_release(&key_locks[s]);
+    }
+    if (!whole) return;
+
+    ArtTree *old = malloc(sizeof(ArtTree));
+    pthread_rwlock_wrlock(&key_index_lock);
+    if (old) {
+        *old = key_index;
+        art_init(&key_index);
+    } else {
+        art_clear(&key_index);
+    }
+    pthread_rwlock_unlock(&key_index_lock);
+    for (unsigned int s = LOCK_STRIPES; s-- > 0;) {
+        stripe_lock_release(&key_locks[s]);
+    }
+    if (!old) return;
+    if (async) {
+        lazyfree_retire(old, free_detached_index);
+    } else {
+        free_detached_index(old);
     }
-    pthread_mutex_unlock(&bucket_mutex[idx]);
-    return "none";
 }
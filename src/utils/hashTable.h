@@ -5,8 +5,8 @@
  *
  * File                      : src/utils/hashTable.h
  * Module                    : Hash Table
- * Last Updating Author      : m0hamed541
- * Last Update               : 03/16/2026
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
  * Version                   : 1.0.0
  *
  * Description:
@@ -19,41 +19,239 @@
 #ifndef HASHTABLE_H
 #define HASHTABLE_H
 
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 #include "list.h"
+#include "swissTable.h"
+#include "stripeLock.h"
+#include "timerWheel.h"
+#include "monoClock.h"
 
 /* ==================== HASHTABLE SIZE ==================== */
 #define TABLE_SIZE 1024
 
+/* ==================== Lock Stripes ==================== */
+/*
+ * Writers lock a stripe chosen from the low bits of the key hash, not a
+ * bucket. Because TABLE_SIZE is a multiple of LOCK_STRIPES every bucket
+ * maps to exactly one stripe, and that stays true if the bucket count
+ * ever changes.
+ */
+#define LOCK_STRIPES 256
+
+#if TABLE_SIZE % LOCK_STRIPES != 0
+#error "TABLE_SIZE must be a multiple of LOCK_STRIPES"
+#endif
+
+/* ==================== Index Backend ==================== */
+/*
+ * Build with `make INDEX=swiss` (-DMEMORA_SWISS_INDEX) to replace the
+ * separate-chaining buckets with one open-addressing Swiss table per
+ * bucket. The locking model is unchanged: the key's lock stripe
+ * serializes writers whichever backend is selected, and readers
+ * traverse either backend lock-free under an epoch (see epoch.h).
+ */
+#ifdef MEMORA_SWISS_INDEX
+#define KEYSPACE_INDEX_NAME "swiss"
+#else
+#define KEYSPACE_INDEX_NAME "chain"
+#endif
+
 /* ==================== Value Types ==================== */
 typedef enum {
     VALUE_STRING,
     VALUE_LIST
 } value_type_t;
 
+/* ==================== String Encodings ==================== */
+typedef enum {
+    ENCODING_RAW,     //- string_value is a separate heap allocation -//
+    ENCODING_EMBSTR,  //- string_value points inside the Entry allocation -//
+    ENCODING_INT      //- canonical decimal integer kept in int_value, no string -//
+} value_encoding_t;
+
+/*
+ * Strings up to ENTRY_EMBED_MAX bytes are stored in the same allocation
+ * as their Entry, right after the key. Override with `make EMBED_MAX=n`
+ * (0 disables embedding).
+ */
+#ifndef ENTRY_EMBED_MAX
+#define ENTRY_EMBED_MAX 64
+#endif
+
+/* ==================== Entry Flags ==================== */
+#define ENTRY_F_EXPIRE_META 0x01   //- allocation starts with an ExpireMeta -//
+
 /* ==================== Key-Value Struct ==================== */
+/*
+ * One allocation per key: the fixed header, then the NUL-terminated key,
+ * then (for ENCODING_EMBSTR) the NUL-terminated value. Entries with a TTL
+ * are preceded by an ExpireMeta holding their timing-wheel node.
+ *
+ *   [ ExpireMeta (TTL only) | header | key \0 | value \0 ]
+ *
+ * The header fits in 32 bytes: key lengths are 16 bits (a request is at
+ * most BUFFER_SIZE bytes anyway) and type, encoding and flags share one
+ * byte, which leaves room for the access word used by eviction.
+ */
+#define ENTRY_KEY_MAX UINT16_MAX
+
 typedef struct Entry {
-    char *key;
-    value_type_t type;
+    struct Entry *next;
+    uint64_t hash;      //- full hash_key() of key, compared before the key bytes -//
     union {
         char *string_value;
         List *list_value;
+        long long int_value;  //- ENCODING_INT; updated in place by INCR, read atomically -//
     } data;
-    long long expiry; //- 0 = no expiry, != 0 = expiry time in ms -//
-    struct Entry *next;
+    uint16_t key_len;       //- strlen(key), at most ENTRY_KEY_MAX -//
+    uint8_t type : 2;       //- value_type_t -//
+    uint8_t encoding : 2;   //- value_encoding_t, strings only -//
+    uint8_t flags : 4;      //- ENTRY_F_* -//
+    uint32_t access;    //- LRU clock of the last access (low 24 bits) and LFU counter (high 8) -//
+    char key[];
 } Entry;
 
+#define ENTRY_HEADER_SIZE offsetof(Entry, key)
+
+/*
+ * The TTL of a key lives in front of its Entry, so only keys with a TTL
+ * pay for it. node.deadline is the monotonic deadline in ms; writers
+ * change it under the key's stripe, lock-free readers load it atomically.
+ */
+typedef struct ExpireMeta {
+    WheelNode node;     //- scheduled in the key's stripe wheel at its deadline -//
+} ExpireMeta;
+
+static inline ExpireMeta *entry_expire_meta(const Entry *entry) {
+    return (ExpireMeta *)((char *)entry - sizeof(ExpireMeta));
+}
+
+/**
+ * @brief The key's monotonic deadline in ms, or 0 if it has no TTL.
+ */
+static inline long long entry_deadline(const Entry *entry) {
+    if (!(entry->flags & ENTRY_F_EXPIRE_META)) return 0;
+    return __atomic_load_n(&entry_expire_meta(entry)->node.deadline, __ATOMIC_RELAXED);
+}
+
+static inline Entry *expire_meta_entry(ExpireMeta *meta) {
+    return (Entry *)((char *)meta + sizeof(ExpireMeta));
+}
+
+/**
+ * @brief Check whether entry holds key.
+ *
+ * The stored hash and length reject almost every mismatch with integer
+ * compares; the key bytes are only read when both agree.
+ */
+static inline int entry_key_equals(const Entry *entry, const char *key, size_t len, uint64_t h) {
+    return entry->hash == h && entry->key_len == len && memcmp(entry->key, key, len) == 0;
+}
+
+/* ==================== Access Tracking ==================== */
+/*
+ * Every lookup refreshes the entry's access word: the LRU clock (seconds,
+ * wrapping after 24 bits, about 194 days) and a Morris-style logarithmic
+ * frequency counter that saturates at 255. The counter starts at
+ * LFU_INIT_VAL so new keys are not evicted before they get a chance to
+ * be read, and loses one per lfu_decay_time minutes without access.
+ */
+#define LRU_CLOCK_BITS 24
+#define LRU_CLOCK_MAX ((1u << LRU_CLOCK_BITS) - 1)
+#define LFU_INIT_VAL 5
+#define LFU_DEFAULT_LOG_FACTOR 10
+#define LFU_DEFAULT_DECAY_TIME 1     //- minutes per counter decrement, 0 = never -//
+
+static inline uint32_t access_clock(uint32_t access) {
+    return access & LRU_CLOCK_MAX;
+}
+
+static inline uint8_t access_counter(uint32_t access) {
+    return (uint8_t)(access >> LRU_CLOCK_BITS);
+}
+
+/**
+ * @brief The LRU clock at monotonic time ms: seconds modulo 2^24.
+ */
+static inline uint32_t lru_clock_at(long long ms) {
+    return (uint32_t)(ms / 1000) & LRU_CLOCK_MAX;
+}
+
+static inline uint32_t lru_clock(void) {
+    return lru_clock_at(mono_clock_ms());
+}
+
+/**
+ * @brief Seconds between an access word and the LRU clock, wrap-aware.
+ */
+static inline uint32_t lru_idle_seconds(uint32_t access, uint32_t clock) {
+    uint32_t then = access_clock(access);
+    return clock >= then ? clock - then : clock + (LRU_CLOCK_MAX + 1 - then);
+}
+
+/**
+ * @brief Set the LFU tuning (MEMORADB_LFU_LOG_FACTOR / MEMORADB_LFU_DECAY_TIME).
+ *
+ * @param log_factor Higher values need more hits to raise the counter.
+ * @param decay_time Minutes of idleness per counter decrement, 0 = never.
+ */
+void hashtable_set_lfu_params(int log_factor, int decay_time);
+
+/**
+ * @brief The LFU counter of an access word after decay up to clock.
+ */
+uint8_t lfu_decayed(uint32_t access, uint32_t clock);
+
+/**
+ * @brief Bump an LFU counter with probability 1 / ((c - LFU_INIT_VAL) * log_factor + 1).
+ */
+uint8_t lfu_log_incr(uint8_t counter);
+
+/**
+ * @brief Read a key's access statistics without counting as an access.
+ *
+ * @param key The key.
+ * @param idle Receives the seconds since the last access.
+ * @param freq Receives the decayed LFU counter.
+ * @return 1 if the key exists, 0 otherwise.
+ */
+int get_key_access(const char *key, uint32_t *idle, uint8_t *freq);
+
 /* ============================================================ */
 /* ==================== The Main HashTable ==================== */
 /* ============================================================ */
 
+#ifdef MEMORA_SWISS_INDEX
+extern SwissTable HASHTABLE[TABLE_SIZE];
+#else
 extern Entry *HASHTABLE[TABLE_SIZE];
-extern pthread_mutex_t bucket_mutex[TABLE_SIZE];
+#endif
+extern StripeLock key_locks[LOCK_STRIPES];
 
 /**
- * @brief Initialize all mutexes for the hash table buckets.
+ * @brief The lock stripe guarding every key with hash h.
+ */
+static inline StripeLock *key_stripe(uint64_t h) {
+    return &key_locks[h & (LOCK_STRIPES - 1)];
+}
+
+/**
+ * @brief Take the stripe of key; release it with stripe_lock_release().
  *
- * This function iterates overy every bycket in the hash table
- * initializes its associated mutex.
+ * List commands hold it while they change a list's nodes, so they do
+ * not race each other or the defragmenter.
+ */
+StripeLock *key_lock(const char *key);
+
+/**
+ * @brief Initialize all lock stripes for the hash table.
+ *
+ * SET, DEL, list creation and lazy expiry take the key's stripe;
+ * lookups (GET, TYPE, list reads) take no lock at all and rely on
+ * epoch reclamation instead.
  * 
  * @note Not thread safe and must be called during single threaded
  * initialization.
@@ -61,11 +259,31 @@ extern pthread_mutex_t bucket_mutex[TABLE_SIZE];
  */
 void hashtable_lock_init(void);
 
+/**
+ * @brief Sum the contention counters of every lock stripe.
+ *
+ * @param total Receives the totals.
+ */
+void hashtable_lock_stats(StripeStats *total);
+
+/**
+ * @brief Compute the full 64-bit hash of a key.
+ *
+ * FNV-1a over the key bytes followed by a 64-bit avalanche step, so both
+ * the low bits (bucket index) and the high bits (Swiss-table tag) are
+ * well mixed.
+ *
+ * @param key The key to hash.
+ * @param len Length of key in bytes.
+ * @return The 64-bit hash.
+ */
+uint64_t hash_key(const char *key, size_t len);
+
 /**
  * @brief Hash function to compute the index for a given key.
  *
- * This function uses a simple hash algorithm to convert a string key
- * into an unsigned integer index suitable for use in the hash table.
+ * This function reduces hash_key() to an unsigned integer index
+ * suitable for use in the hash table.
  *
  * @param key The key to hash.
  * @return The computed hash index.
@@ -81,16 +299,121 @@ unsigned int hash(const char *key);
  */
 void set_value(const char *key, const char *value, long long px);
 
+/**
+ * @brief Set a string value with an absolute deadline.
+ *
+ * @param key The key to set.
+ * @param value The string value to associate with the key.
+ * @param deadline Monotonic deadline in ms (current_millis() based), 0 for no expiry.
+ */
+void set_value_at(const char *key, const char *value, long long deadline);
+
 /**
  * @brief Get a string value from the hash table.
  *
+ * The returned pointer is only guaranteed to stay valid while the caller
+ * is inside an epoch critical section (epoch_enter()/epoch_exit()); a
+ * concurrent SET or DEL retires it instead of freeing it. Integer-encoded
+ * values outside the shared range are rendered into a per-thread buffer
+ * that the next get_value() on the same thread overwrites; prefer
+ * get_string() on hot paths.
+ *
  * @param key The key to retrieve.
  * @return The string value, or NULL if not found or expired.
  */
 const char *get_value(const char *key);
 
+/**
+ * @brief A string value as seen by a reader.
+ *
+ * Integer-encoded values are returned as a number so replies can format
+ * them directly; everything else as bytes.
+ */
+typedef struct StringValue {
+    const char *ptr;     //- NULL when is_int -//
+    size_t len;
+    int is_int;
+    long long int_value;
+} StringValue;
+
+/**
+ * @brief Get a string value without rendering integers.
+ *
+ * ptr stays valid while the caller is inside an epoch critical section.
+ *
+ * @param key The key to retrieve.
+ * @param out Receives the value.
+ * @return 1 if found, 0 if missing, expired or not a string.
+ */
+int get_string(const char *key, StringValue *out);
+
+/* ==================== Multi-Key ==================== */
+
+/**
+ * @brief Look up many string values at once (MGET).
+ *
+ * All keys are hashed first and their buckets prefetched, then probed in
+ * passes so the cache misses of different keys overlap. No lock is taken;
+ * pointers stay valid while the caller is inside an epoch.
+ *
+ * @param keys The keys.
+ * @param n Number of keys.
+ * @param out Receives one value per key; a miss (or a list) has
+ *        ptr == NULL and is_int == 0.
+ * @return Number of keys found.
+ */
+size_t get_strings(const char *const *keys, size_t n, StringValue *out);
+
+/**
+ * @brief Set many string values at once (MSET / MSETNX).
+ *
+ * Entries are built before any lock is taken, then every distinct lock
+ * stripe involved is acquired once, in ascending order, so the writes are
+ * atomic with respect to other writers. Later duplicates win. Any TTL on
+ * the keys is cleared.
+ *
+ * @param keys The keys.
+ * @param values One value per key.
+ * @param n Number of pairs.
+ * @param nx If non-zero, set nothing unless none of the keys exist (MSETNX).
+ * @return 1 if the values were set, 0 if nx and a key existed, -1 on allocation failure.
+ */
+int set_values(const char *const *keys, const char *const *values, size_t n, int nx);
+
+/* ==================== Counters ==================== */
+typedef enum {
+    INCR_OK,
+    INCR_WRONGTYPE,      //- key holds a list -//
+    INCR_NOT_INTEGER,    //- value or increment is not an integer -//
+    INCR_NOT_FLOAT,      //- value or increment is not a finite float -//
+    INCR_OVERFLOW,       //- result would not fit in 64 bits / is not finite -//
+    INCR_NOMEM
+} incr_status_t;
+
+/**
+ * @brief Atomically add delta to the integer at key (INCR/DECR/INCRBY/DECRBY).
+ *
+ * A missing key counts as 0. The TTL is kept.
+ *
+ * @param key The key.
+ * @param delta Amount to add.
+ * @param result Receives the new value on INCR_OK.
+ */
+incr_status_t incr_by(const char *key, long long delta, long long *result);
+
+/**
+ * @brief Atomically add delta to the number at key (INCRBYFLOAT).
+ *
+ * @param key The key.
+ * @param delta Amount to add.
+ * @param out Receives the new value as text, at least LD_STR_SIZE bytes.
+ * @param out_len Receives its length.
+ */
+incr_status_t incr_by_float(const char *key, long double delta, char *out, size_t *out_len);
+
 /**
  * Get an existing list or create a new one
+ * The list stays valid while the caller is inside an epoch.
  * @param key The key to lookup or create
  * @return Pointer to the list, NULL on error
  */
@@ -98,11 +421,24 @@ List *get_or_create_list(const char *key);
 
 /**
  * Get the list at key if it exists and is a list.
+ * The list stays valid while the caller is inside an epoch.
  * @param key The key to lookup
  * @return Pointer to the list, or NULL if not found or not a list
  */
 List *get_list_if_exists(const char *key);
 
+/**
+ * Take the stripe of key, then find (or create) its list under it.
+ * Until the caller releases the stripe the list cannot be deleted,
+ * replaced or expired, so list commands use this rather than looking
+ * the list up first and locking after.
+ * @param key The key to lookup
+ * @param create Nonzero to create an empty list if key is missing
+ * @param lock Receives the stripe; it is held on return, even when NULL is returned
+ * @return Pointer to the list, or NULL if missing (and create is 0), not a list, or out of memory
+ */
+List *lock_list(const char *key, int create, StripeLock **lock);
+
 /**
  * Delete a key from the hash table, removing both string and list types.
  * Properly frees memory for both string values and list structures.
@@ -112,10 +448,42 @@ List *get_list_if_exists(const char *key);
 int delete_key(const char *key);
 
 /**
- * Get current time in milliseconds since epoch
+ * @brief Remove a key, freeing a large value in the background.
+ *
+ * The key disappears immediately; a value costing more than
+ * LAZYFREE_THRESHOLD allocations to free is released by the lazyfree
+ * thread instead of the caller.
+ *
+ * @param key The key to unlink.
+ * @return 1 if the key was removed, 0 if not found.
+ */
+int unlink_key(const char *key);
+
+/**
+ * @brief Make delete_key() behave like unlink_key() (MEMORADB_LAZYFREE_DEL).
+ */
+void hashtable_set_lazy_user_del(int enabled);
+
+/**
+ * @brief Remove every key.
+ *
+ * Each bucket is detached in O(1) under its stripe. With async set the
+ * detached entries are freed by the lazyfree thread; otherwise by the
+ * thread that ends the grace period.
+ *
+ * @param async Nonzero for FLUSHALL ASYNC.
+ */
+void hashtable_flush(int async);
+
+/**
+ * Keyspace clock: monotonic milliseconds, read from the cached server
+ * clock (see monoClock.h). Only differences between two readings are
+ * meaningful; use wall_to_mono_ms() for client-supplied timestamps.
  * @return Current time in milliseconds
  */
-long long current_millis(void);
+static inline long long current_millis(void) {
+    return mono_clock_ms();
+}
 
 /**
  * @brief Get the type of the value at key.
@@ -125,4 +493,245 @@ long long current_millis(void);
  */
 const char *get_type(const char *key);
 
+/* ==================== TTL ==================== */
+typedef enum {
+    EXPIRE_ALWAYS,
+    EXPIRE_NX,       //- only if the key has no TTL -//
+    EXPIRE_XX,       //- only if the key has a TTL -//
+    EXPIRE_GT,       //- only if later than the current TTL -//
+    EXPIRE_LT        //- only if earlier than the current TTL (none counts as infinite) -//
+} expire_cond_t;
+
+/**
+ * @brief Set or change the TTL of any key (EXPIRE family).
+ *
+ * Changing an existing TTL moves the key's timing-wheel node in place;
+ * adding the first TTL rebuilds the entry with an ExpireMeta. A deadline
+ * at or before now deletes the key.
+ *
+ * @param key The key.
+ * @param deadline Monotonic deadline in ms.
+ * @param cond Condition on the current TTL.
+ * @return 1 if the TTL was set (or the key deleted), 0 if the key is
+ *         missing or cond failed, -1 on allocation failure.
+ */
+int set_expiry(const char *key, long long deadline, expire_cond_t cond);
+
+/**
+ * @brief Remaining time to live of a key in ms (PTTL).
+ *
+ * @return The TTL, -1 if the key has no TTL, -2 if it does not exist.
+ */
+long long get_ttl_ms(const char *key);
+
+/**
+ * @brief Remove the TTL of a key (PERSIST).
+ *
+ * @return 1 if a TTL was removed, 0 if the key is missing or has none,
+ *         -1 on allocation failure.
+ */
+int persist_key(const char *key);
+
+/**
+ * @brief Callback for hashtable_scan().
+ *
+ * @param entry A live (non-expired) entry; valid until the caller's epoch ends.
+ * @param ctx The ctx passed to hashtable_scan().
+ */
+typedef void (*scan_fn)(const Entry *entry, void *ctx);
+
+/**
+ * @brief Visit a slice of the keyspace, SCAN style.
+ *
+ * Buckets are visited in reverse-binary order of their index, so every
+ * key present for the whole iteration is returned at least once even if
+ * the bucket count doubles or halves between calls. Each call visits
+ * buckets until about count entries were seen, or 10 * count buckets.
+ *
+ * @note Must be called inside an epoch critical section.
+ *
+ * @param cursor 0 to start, then the value returned by the previous call.
+ * @param count Work hint: entries to examine before returning.
+ * @param fn Called for every live entry visited.
+ * @param ctx Passed through to fn.
+ * @return The next cursor, or 0 once the whole keyspace was visited.
+ */
+unsigned long hashtable_scan(unsigned long cursor, size_t count, scan_fn fn, void *ctx);
+
+/* ==================== Ordered Key Index ==================== */
+
+/**
+ * @brief Turn the ordered key index on or off (MEMORADB_ORDERED_INDEX).
+ *
+ * The index is a radix tree of every key name, kept in step with the
+ * table, so prefix scans cost the keys they match rather than the size
+ * of the keyspace. Turning it on indexes the keys already stored, one
+ * stripe at a time; turning it off frees it.
+ *
+ * @return 0 on success, -1 if out of memory (the index is left off).
+ */
+int hashtable_set_key_index(int enabled);
+
+/**
+ * @brief Whether the ordered key index is on.
+ */
+int hashtable_key_index_enabled(void);
+
+/**
+ * @brief Names held by the key index and the memory they take.
+ */
+void hashtable_key_index_stats(size_t *keys, size_t *bytes);
+
+/**
+ * @brief Visit the keys starting with prefix in byte order, through the key index.
+ *
+ * Each indexed name is looked up in the table; fn sees the live ones.
+ * The cost is the depth of the index plus the names visited.
+ *
+ * @note Must be called inside an epoch critical section.
+ *
+ * @param prefix Key prefix; "" for every key.
+ * @param after Resume strictly after this key, or NULL to start at the prefix.
+ * @param count Stop after this many names (0 = no limit).
+ * @param fn Called for every live entry visited.
+ * @param ctx Passed through to fn.
+ * @param next Set to a malloc'd copy of the last name visited when the
+ *             walk stopped at count, NULL once every match was visited.
+ *             May be NULL.
+ * @return 0 on success, -1 if the index is off or out of memory.
+ */
+int hashtable_scan_prefix(const char *prefix, const char *after, size_t count,
+                          scan_fn fn, void *ctx, char **next);
+
+/* ==================== Active Expiry ==================== */
+
+typedef struct ExpireSample {
+    size_t sampled;   //- entries with a TTL that were examined -//
+    size_t expired;   //- of those, reclaimed because their TTL had passed -//
+} ExpireSample;
+
+/**
+ * @brief Examine entries with a TTL starting at a bucket and reclaim expired ones.
+ *
+ * Walks whole buckets lock-free from cursor until want TTL entries were
+ * seen or 10 * want buckets were visited; each expired entry is unlinked
+ * under its stripe. Used by the active expiry cycle (see expire.h).
+ *
+ * @param cursor Bucket to start at (0 on the first call).
+ * @param want Number of TTL entries to sample.
+ * @param out Receives the counts.
+ * @return The bucket to continue from.
+ */
+unsigned int hashtable_expire_sample(unsigned int cursor, size_t want, ExpireSample *out);
+
+/**
+ * @brief Reclaim every entry whose TTL deadline is at or before now.
+ *
+ * Advances the timing wheel of each lock stripe under that stripe, so
+ * the cost is proportional to the ticks elapsed and the keys that came
+ * due, not to the number of keys with a TTL.
+ *
+ * @param now Current time in ms (current_millis()).
+ * @return Number of entries reclaimed.
+ */
+size_t hashtable_expire_due(long long now);
+
+/**
+ * @brief Total expired entries reclaimed so far, by lookups or the active cycle.
+ */
+unsigned long long hashtable_expired_keys(void);
+
+/* ==================== Memory Introspection ==================== */
+
+typedef struct TypeMemory {
+    size_t keys;
+    size_t bytes;         //- entries, values and list nodes, as mem_used() counts them -//
+} TypeMemory;
+
+typedef struct KeyspaceMemory {
+    TypeMemory strings;
+    TypeMemory lists;
+    size_t expires;       //- keys with a TTL; their ExpireMeta is in the bytes above -//
+} KeyspaceMemory;
+
+/**
+ * @brief Bytes a key occupies (MEMORY USAGE).
+ *
+ * The sum of every allocation the key owns: the entry with its embedded
+ * key, value and ExpireMeta, a raw string value, or a list's header,
+ * nodes and element strings. Each is counted at the size the allocator
+ * really hands out, so the result adds up with used_memory. A list is
+ * walked under its stripe, in O(length).
+ *
+ * @return Bytes, 0 if the key does not exist.
+ */
+size_t get_key_memory(const char *key);
+
+/**
+ * @brief Count keys and bytes per type over the whole keyspace (MEMORY STATS).
+ *
+ * Walks one bucket at a time under its stripe, so writers only ever wait
+ * for a single bucket. The totals are a consistent view of each bucket,
+ * not of the whole keyspace.
+ */
+void hashtable_memory_stats(KeyspaceMemory *out);
+
+/* ==================== Eviction ==================== */
+
+/**
+ * @brief Visit up to want live entries picked at random.
+ *
+ * Each sample is a random bucket and a random position in it, so it costs
+ * about one lookup whatever the size of the keyspace.
+ *
+ * @note Must be called inside an epoch critical section.
+ *
+ * @param want Number of entries to visit.
+ * @param fn Called for every sampled entry (the same one may come twice).
+ * @param ctx Passed through to fn.
+ * @return Number of entries visited; fewer than want if the keyspace is sparse.
+ */
+size_t hashtable_sample(size_t want, scan_fn fn, void *ctx);
+
+/**
+ * @brief Evict a key chosen by the eviction policy (see evict.h).
+ *
+ * The key is unlinked under its stripe and retired like a DEL; its bytes
+ * count as pending until the grace period ends and they are freed, so
+ * hashtable_evict_pending() lets the caller see the effect right away.
+ *
+ * @param key The victim.
+ * @param volatile_only Only evict it if it has a TTL.
+ * @return Bytes the key will free, 0 if it is gone (or has no TTL).
+ */
+size_t hashtable_evict_key(const char *key, int volatile_only);
+
+/**
+ * @brief Bytes of evicted keys that are still waiting for their grace period.
+ */
+size_t hashtable_evict_pending(void);
+
+/* ==================== Active Defrag ==================== */
+
+typedef struct DefragSample {
+    size_t hits;          //- allocations moved to a denser chunk -//
+    size_t misses;        //- allocations examined and left in place -//
+    size_t bytes_moved;
+} DefragSample;
+
+/**
+ * @brief Move the sparse-chunk allocations of one bucket (see defrag.h).
+ *
+ * Under the bucket's stripe, every entry, raw string value, list node
+ * and list element the allocator flags with mem_defrag_hint() is copied
+ * into a denser chunk and the old copy retired; lock-free readers keep
+ * seeing it until they leave their epoch. List headers are not moved:
+ * commands keep List pointers across the stripe.
+ *
+ * @param idx Bucket to work on.
+ * @param out Counts are added here.
+ * @return The next bucket, 0 after the last one.
+ */
+unsigned int hashtable_defrag_bucket(unsigned int idx, DefragSample *out);
+
 #endif // HASHTABLE_H
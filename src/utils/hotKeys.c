@@ -0,0 +1,299 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/hotKeys.c
+ * Module                    : Hot Keys
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of hot-key detection with per-thread sampled
+ *  Space-Saving sketches.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include "hotKeys.h"
+#include "hashTable.h"
+#include "monoClock.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Space-Saving keeps a fixed set of counters. A key already counted is
+ * incremented; a new key takes over the smallest counter and inherits
+ * its count as an error bound. Any key with more than 1/SKETCH_SIZE of
+ * the recorded accesses is guaranteed to hold a counter, which is all a
+ * hot-key report needs.
+ *
+ * Each thread records into its own sketch, so the hot path never shares
+ * a cache line with another core; readers lock each sketch in turn and
+ * merge them. A sketch keeps two generations of HOTKEYS_WINDOW_MS each,
+ * so rates describe recent traffic and a key that cooled down drops out
+ * within two windows. Like the memAlloc counter blocks, sketches are
+ * never freed: a thread that exits releases its sketch to the next one.
+ *
+ * Counters match on hash, length and the stored key bytes. Only the
+ * first HOTKEYS_KEY_MAX bytes are kept, so two longer keys of the same
+ * length that share that prefix and collide on the hash still count as
+ * one.
+ */
+
+typedef struct Counter {
+    uint64_t hash;
+    size_t len;
+    unsigned long long count;
+    unsigned long long error;
+    char key[HOTKEYS_KEY_MAX + 1];
+} Counter;
+
+typedef struct Generation {
+    Counter slots[HOTKEYS_SKETCH_SIZE];
+    int used;
+    long long start;             //- ms; 0 = holds nothing -//
+} Generation;
+
+typedef struct Sketch {
+    struct Sketch *next;
+    int owned;                   //- claimed by a live thread -//
+    pthread_mutex_t lock;        //- owner records, readers merge -//
+    Generation gen[2];
+    int cur;
+    unsigned long long sampled;
+} Sketch;
+
+static int sample_rate = HOTKEYS_DEFAULT_SAMPLE_RATE;
+static Sketch *sketches;                    // push-only list
+static __thread Sketch *my_sketch;
+static __thread int countdown;
+static pthread_key_t exit_key;
+static pthread_once_t exit_once = PTHREAD_ONCE_INIT;
+
+static void thread_exit(void *arg) {
+    Sketch *s = arg;
+    my_sketch = NULL;
+    __atomic_store_n(&s->owned, 0, __ATOMIC_RELEASE);
+}
+
+static void make_exit_key(void) {
+    pthread_key_create(&exit_key, thread_exit);
+}
+
+//-- Adopt a released sketch, or add a new one --//
+static Sketch *claim_sketch(void) {
+    pthread_once(&exit_once, make_exit_key);
+    Sketch *s = __atomic_load_n(&sketches, __ATOMIC_ACQUIRE);
+    for (; s; s = s->next) {
+        int expected = 0;
+        if (__atomic_compare_exchange_n(&s->owned, &expected, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            break;
+        }
+    }
+    if (!s) {
+        s = calloc(1, sizeof(Sketch));
+        if (!s) return NULL;
+        s->owned = 1;
+        pthread_mutex_init(&s->lock, NULL);
+        s->gen[0].start = mono_clock_ms();
+        s->next = __atomic_load_n(&sketches, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&sketches, &s->next, s, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+        }
+    }
+    pthread_setspecific(exit_key, s);
+    my_sketch = s;
+    return s;
+}
+
+static uint64_t seed_sequence;
+
+//-- xorshift per thread, for the sampling countdown --//
+static uint32_t next_random(void) {
+    static __thread uint32_t seed;
+    if (!seed) {
+        //-- Short-lived threads reuse the same TLS address; mix in a global sequence --//
+        uint64_t x = (uint64_t)(uintptr_t)&seed
+                   ^ __atomic_add_fetch(&seed_sequence, 0x9E3779B97F4A7C15ULL, __ATOMIC_RELAXED);
+        x ^= x >> 31;
+        x *= 0xBF58476D1CE4E5B9ULL;
+        x ^= x >> 29;
+        seed = (uint32_t)x | 1;
+    }
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+/* ==================== Sketch ==================== */
+
+//-- Start a new generation once the current one is a window old; holds s->lock --//
+static void rotate(Sketch *s, long long now) {
+    Generation *cur = &s->gen[s->cur];
+    if (cur->start && now - cur->start < HOTKEYS_WINDOW_MS) return;
+    Generation *prev = &s->gen[!s->cur];
+    //-- A current generation two windows old is no longer recent either --//
+    int keep = cur->start && now - cur->start < 2 * HOTKEYS_WINDOW_MS;
+    prev->used = 0;
+    prev->start = 0;
+    if (keep) s->cur = !s->cur;
+    else cur->used = 0;
+    cur = &s->gen[s->cur];
+    cur->used = 0;
+    cur->start = now;
+}
+
+static void sketch_add(Generation *g, const char *key, size_t len, uint64_t h) {
+    size_t stored = len < HOTKEYS_KEY_MAX ? len : HOTKEYS_KEY_MAX;
+    Counter *min = NULL;
+    for (int i = 0; i < g->used; i++) {
+        Counter *c = &g->slots[i];
+        //-- The hash alone would let two colliding keys share one count --//
+        if (c->hash == h && c->len == len && memcmp(c->key, key, stored) == 0) {
+            c->count++;
+            return;
+        }
+        if (!min || c->count < min->count) min = c;
+    }
+    Counter *c;
+    if (g->used < HOTKEYS_SKETCH_SIZE) {
+        c = &g->slots[g->used++];
+        c->count = 1;
+        c->error = 0;
+    } else {
+        //-- Take over the smallest counter; its count bounds the error --//
+        c = min;
+        c->error = c->count;
+        c->count++;
+    }
+    c->hash = h;
+    c->len = len;
+    memcpy(c->key, key, stored);
+    c->key[stored] = '\0';
+}
+
+/* ==================== Public API ==================== */
+
+void hotkeys_set_sample_rate(int rate) {
+    __atomic_store_n(&sample_rate, rate < 0 ? 0 : rate, __ATOMIC_RELAXED);
+}
+
+void hotkeys_record(const char *key, size_t len) {
+    int rate = __atomic_load_n(&sample_rate, __ATOMIC_RELAXED);
+    if (rate <= 0) return;
+    uint32_t span = (uint32_t)(2 * rate - 1);
+    if (countdown == 0) {
+        //-- A new thread joins mid-gap: the shorter of two gaps has the remainder's odds, about 1/rate for the first access --//
+        uint32_t a = next_random() % span, b = next_random() % span;
+        countdown = 1 + (int)(a < b ? a : b);
+    }
+    //-- A countdown drawn under a larger rate ends early --//
+    if (--countdown > 0 && countdown < 2 * rate) return;
+    //-- A random gap averaging rate, so a periodic access pattern cannot alias with it --//
+    countdown = 1 + (int)(next_random() % span);
+
+    Sketch *s = my_sketch ? my_sketch : claim_sketch();
+    if (!s) return;
+    uint64_t h = hash_key(key, len);
+    long long now = mono_clock_ms();
+    pthread_mutex_lock(&s->lock);
+    rotate(s, now);
+    sketch_add(&s->gen[s->cur], key, len, h);
+    s->sampled++;
+    pthread_mutex_unlock(&s->lock);
+}
+
+static int by_key(const void *a, const void *b) {
+    const HotKey *x = a, *y = b;
+    if (x->hash != y->hash) return x->hash < y->hash ? -1 : 1;
+    if (x->len != y->len) return x->len < y->len ? -1 : 1;
+    return memcmp(x->key, y->key, x->len < HOTKEYS_KEY_MAX ? x->len : HOTKEYS_KEY_MAX);
+}
+
+static int by_rate(const void *a, const void *b) {
+    const HotKey *x = a, *y = b;
+    return x->ops_per_sec < y->ops_per_sec ? 1 : x->ops_per_sec > y->ops_per_sec ? -1 : 0;
+}
+
+size_t hotkeys_top(HotKey *out, size_t n) {
+    size_t cap = 0;
+    for (Sketch *s = __atomic_load_n(&sketches, __ATOMIC_ACQUIRE); s; s = s->next) cap += 2 * HOTKEYS_SKETCH_SIZE;
+    if (cap == 0 || n == 0) return 0;
+    HotKey *all = malloc(cap * sizeof(HotKey));
+    if (!all) return 0;
+
+    int rate = __atomic_load_n(&sample_rate, __ATOMIC_RELAXED);
+    long long now = mono_clock_ms();
+    size_t count = 0;
+    for (Sketch *s = __atomic_load_n(&sketches, __ATOMIC_ACQUIRE); s && count < cap; s = s->next) {
+        pthread_mutex_lock(&s->lock);
+        rotate(s, now);
+        Generation *prev = &s->gen[!s->cur];
+        long long since = prev->start ? prev->start : s->gen[s->cur].start;
+        //-- Under a second of history would turn a handful of samples into a large rate --//
+        double seconds = (now - since < 1000 ? 1000 : now - since) / 1000.0;
+        for (int g = 0; g < 2; g++) {
+            Generation *gen = &s->gen[g];
+            for (int i = 0; i < gen->used && count < cap; i++) {
+                const Counter *c = &gen->slots[i];
+                HotKey *hk = &all[count++];
+                memcpy(hk->key, c->key, sizeof(hk->key));
+                hk->len = c->len;
+                hk->hash = c->hash;
+                hk->count = c->count;
+                hk->error = c->error;
+                //-- Only the guaranteed part: a cold key that took over a counter inherited its count --//
+                hk->ops_per_sec = (double)(c->count - c->error) * (rate > 0 ? rate : 1) / seconds;
+            }
+        }
+        pthread_mutex_unlock(&s->lock);
+    }
+
+    //-- The same key may be counted by several threads and both generations --//
+    qsort(all, count, sizeof(HotKey), by_key);
+    size_t merged = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (merged && by_key(&all[merged - 1], &all[i]) == 0) {
+            all[merged - 1].count += all[i].count;
+            all[merged - 1].error += all[i].error;
+            all[merged - 1].ops_per_sec += all[i].ops_per_sec;
+        } else {
+            all[merged++] = all[i];
+        }
+    }
+    qsort(all, merged, sizeof(HotKey), by_rate);
+    //-- Keys whose whole count is inherited error are not known to be hot at all --//
+    while (merged > 0 && all[merged - 1].ops_per_sec <= 0) merged--;
+
+    if (n > merged) n = merged;
+    memcpy(out, all, n * sizeof(HotKey));
+    free(all);
+    return n;
+}
+
+void hotkeys_reset(void) {
+    long long now = mono_clock_ms();
+    for (Sketch *s = __atomic_load_n(&sketches, __ATOMIC_ACQUIRE); s; s = s->next) {
+        pthread_mutex_lock(&s->lock);
+        s->gen[0].used = s->gen[1].used = 0;
+        s->gen[!s->cur].start = 0;
+        s->gen[s->cur].start = now;
+        pthread_mutex_unlock(&s->lock);
+    }
+}
+
+void hotkeys_stats(HotKeysStats *out) {
+    out->sample_rate = __atomic_load_n(&sample_rate, __ATOMIC_RELAXED);
+    out->sampled = 0;
+    out->sketches = 0;
+    for (Sketch *s = __atomic_load_n(&sketches, __ATOMIC_ACQUIRE); s; s = s->next) {
+        pthread_mutex_lock(&s->lock);
+        out->sampled += s->sampled;
+        pthread_mutex_unlock(&s->lock);
+        out->sketches++;
+    }
+}
@@ -0,0 +1,80 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/hotKeys.h
+ * Module                    : Hot Keys
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for hot-key detection: a sampled Space-Saving sketch of the
+ *  most accessed keys with their estimated ops/sec.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef HOTKEYS_H
+#define HOTKEYS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* ==================== Tuning ==================== */
+#define HOTKEYS_DEFAULT_SAMPLE_RATE 16    //- one access in this many is recorded -//
+#define HOTKEYS_SKETCH_SIZE 64            //- counters per thread -//
+#define HOTKEYS_WINDOW_MS 10000           //- rates cover the last one to two windows -//
+#define HOTKEYS_KEY_MAX 64                //- longer keys are reported truncated -//
+#define HOTKEYS_DEFAULT_TOP 10
+
+typedef struct HotKey {
+    char key[HOTKEYS_KEY_MAX + 1];
+    size_t len;                 //- full key length; > HOTKEYS_KEY_MAX if truncated -//
+    uint64_t hash;
+    unsigned long long count;   //- sampled accesses, an overestimate by at most error -//
+    unsigned long long error;
+    double ops_per_sec;         //- estimated accesses per second, from count - error -//
+} HotKey;
+
+typedef struct HotKeysStats {
+    int sample_rate;            //- 0 = disabled -//
+    unsigned long long sampled; //- accesses recorded since start -//
+    size_t sketches;            //- threads that recorded an access -//
+} HotKeysStats;
+
+/**
+ * @brief Set the sampling rate: record one access in rate; 0 disables.
+ */
+void hotkeys_set_sample_rate(int rate);
+
+/**
+ * @brief Count an access to key.
+ *
+ * Most calls only decrement a thread-local countdown. A sampled access
+ * goes into the calling thread's own sketch under a lock nobody else
+ * takes except a reader merging the sketches.
+ */
+void hotkeys_record(const char *key, size_t len);
+
+/**
+ * @brief The hottest keys across all threads, hottest first.
+ *
+ * @param out Receives up to n keys.
+ * @return Number of keys written.
+ */
+size_t hotkeys_top(HotKey *out, size_t n);
+
+/**
+ * @brief Forget every count and start new windows.
+ */
+void hotkeys_reset(void);
+
+/**
+ * @brief Snapshot the sampler's counters.
+ */
+void hotkeys_stats(HotKeysStats *out);
+
+#endif // HOTKEYS_H
@@ -0,0 +1,130 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/hugePages.c
+ * Module                    : Huge Page Mappings
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of HUGE_PAGE_SIZE-aligned mappings with explicit or
+ *  transparent huge pages and their fallbacks.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#define _GNU_SOURCE
+#include "hugePages.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/mman.h>
+
+/*
+ * A 64 KiB slab chunk spans 16 TLB entries with 4 KB pages; a 2 MB page
+ * covers a whole slab region with one. Explicit huge pages come from the
+ * pool the administrator reserved (vm.nr_hugepages) and are never split
+ * or swapped, but the pool may be empty; THP needs no reservation but
+ * the kernel may back a region with small pages until khugepaged
+ * collapses it. Explicit mode therefore tries MAP_HUGETLB first and
+ * falls back to an advised regular mapping.
+ */
+
+static hugepages_mode_t current_mode = HUGEPAGES_OFF;
+static int mode_locked;                    // set once the mode was used
+static size_t mapped_bytes;
+static size_t explicit_bytes;
+static unsigned long long fallback_count;
+
+int hugepages_set_mode(hugepages_mode_t mode) {
+    if (__atomic_load_n(&mode_locked, __ATOMIC_ACQUIRE)) return -1;
+    current_mode = mode;
+    return 0;
+}
+
+hugepages_mode_t hugepages_mode(void) {
+    __atomic_store_n(&mode_locked, 1, __ATOMIC_RELEASE);
+    return current_mode;
+}
+
+static const char *mode_names[] = { "off", "thp", "explicit" };
+
+int hugepages_parse(const char *s, hugepages_mode_t *out) {
+    for (int m = HUGEPAGES_OFF; m <= HUGEPAGES_EXPLICIT; m++) {
+        if (strcasecmp(s, mode_names[m]) == 0) {
+            *out = (hugepages_mode_t)m;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+const char *hugepages_mode_name(hugepages_mode_t mode) {
+    return mode_names[mode];
+}
+
+//-- Over-map by one huge page, then trim both ends to the aligned range --//
+static void *map_aligned(size_t len) {
+    size_t span = len + HUGE_PAGE_SIZE;
+    char *raw = mmap(NULL, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) return NULL;
+    char *ptr = (char *)(((uintptr_t)raw + HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1));
+    if (ptr > raw) munmap(raw, (size_t)(ptr - raw));
+    char *tail = ptr + len;
+    if (tail < raw + span) munmap(tail, (size_t)(raw + span - tail));
+    return ptr;
+}
+
+void *huge_map(size_t len) {
+    hugepages_mode_t mode = hugepages_mode();
+    void *ptr = NULL;
+    if (mode == HUGEPAGES_EXPLICIT) {
+        ptr = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED) {
+            __atomic_fetch_add(&explicit_bytes, len, __ATOMIC_RELAXED);
+            __atomic_fetch_add(&mapped_bytes, len, __ATOMIC_RELAXED);
+            return ptr;
+        }
+        __atomic_fetch_add(&fallback_count, 1, __ATOMIC_RELAXED);
+    }
+
+    ptr = map_aligned(len);
+    if (!ptr) return NULL;
+    if (mode != HUGEPAGES_OFF && madvise(ptr, len, MADV_HUGEPAGE) != 0) {
+        __atomic_fetch_add(&fallback_count, 1, __ATOMIC_RELAXED);
+    }
+    __atomic_fetch_add(&mapped_bytes, len, __ATOMIC_RELAXED);
+    return ptr;
+}
+
+void huge_unmap(void *ptr, size_t len) {
+    if (!ptr) return;
+    munmap(ptr, len);
+    __atomic_fetch_sub(&mapped_bytes, len, __ATOMIC_RELAXED);
+}
+
+//-- AnonHugePages of the whole process, from smaps_rollup --//
+static size_t read_thp_resident(void) {
+    FILE *f = fopen("/proc/self/smaps_rollup", "r");
+    if (!f) return 0;
+    char line[128];
+    size_t kb = 0;
+    while (fgets(line, sizeof(line), f)) {
+        if (sscanf(line, "AnonHugePages: %zu kB", &kb) == 1) break;
+    }
+    fclose(f);
+    return kb * 1024;
+}
+
+void hugepages_stats(HugePagesStats *out) {
+    out->mode = current_mode;
+    out->mapped = __atomic_load_n(&mapped_bytes, __ATOMIC_RELAXED);
+    out->explicit_total = __atomic_load_n(&explicit_bytes, __ATOMIC_RELAXED);
+    out->fallbacks = __atomic_load_n(&fallback_count, __ATOMIC_RELAXED);
+    out->thp_resident = read_thp_resident();
+}
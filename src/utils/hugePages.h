@@ -0,0 +1,87 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/hugePages.h
+ * Module                    : Huge Page Mappings
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for the page mappings behind the slab regions and large
+ *  storage allocations, optionally backed by 2 MB huge pages.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef HUGEPAGES_H
+#define HUGEPAGES_H
+
+#include <stddef.h>
+
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+typedef enum {
+    HUGEPAGES_OFF,        //- regular 4 KB pages -//
+    HUGEPAGES_THP,        //- madvise(MADV_HUGEPAGE): transparent huge pages where the kernel allows -//
+    HUGEPAGES_EXPLICIT    //- MAP_HUGETLB from the reserved pool, THP when the pool is empty -//
+} hugepages_mode_t;
+
+typedef struct HugePagesStats {
+    hugepages_mode_t mode;
+    size_t mapped;             //- bytes currently mapped through huge_map() -//
+    size_t explicit_total;     //- bytes ever mapped from the MAP_HUGETLB pool -//
+    unsigned long long fallbacks;  //- MAP_HUGETLB or madvise requests the kernel refused -//
+    size_t thp_resident;       //- AnonHugePages of the process, 0 if unknown -//
+} HugePagesStats;
+
+/**
+ * @brief Choose how storage memory is mapped.
+ *
+ * Only takes effect before the mode is first used (by huge_map() or
+ * hugepages_mode()); later calls are ignored so that every mapping is
+ * released the way it was made.
+ *
+ * @return 0 if the mode was applied, -1 if it is already fixed.
+ */
+int hugepages_set_mode(hugepages_mode_t mode);
+
+/**
+ * @brief The mode in effect; fixes it from now on.
+ */
+hugepages_mode_t hugepages_mode(void);
+
+/**
+ * @brief Parse "off", "thp" or "explicit".
+ *
+ * @return 0 on success, -1 if s names no mode.
+ */
+int hugepages_parse(const char *s, hugepages_mode_t *out);
+
+/**
+ * @brief Name of a mode, as accepted by hugepages_parse().
+ */
+const char *hugepages_mode_name(hugepages_mode_t mode);
+
+/**
+ * @brief Map len bytes aligned to HUGE_PAGE_SIZE.
+ *
+ * @param len A multiple of HUGE_PAGE_SIZE.
+ * @return The zeroed mapping, or NULL when out of memory.
+ */
+void *huge_map(size_t len);
+
+/**
+ * @brief Unmap a mapping from huge_map().
+ */
+void huge_unmap(void *ptr, size_t len);
+
+/**
+ * @brief Snapshot the mapping counters.
+ */
+void hugepages_stats(HugePagesStats *out);
+
+#endif // HUGEPAGES_H
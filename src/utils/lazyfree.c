@@ -0,0 +1,142 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/lazyfree.c
+ * Module                    : Lazy Free
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of the lazyfree job queue and its worker thread.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include "lazyfree.h"
+#include "epoch.h"
+#include <pthread.h>
+#include <stdlib.h>
+
+/*
+ * Jobs are queued as soon as the object is unlinked. The worker takes the
+ * whole queue, waits out one grace period with epoch_synchronize() so
+ * that no reader can still be standing on any object in the batch, and
+ * then frees it without holding any lock the keyspace uses. Without a
+ * worker the job goes through the ordinary epoch reclaimer instead.
+ */
+
+typedef struct LazyJob {
+    struct LazyJob *next;
+    void *ptr;
+    void (*free_fn)(void *);
+} LazyJob;
+
+static pthread_mutex_t queue_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t queue_cond = PTHREAD_COND_INITIALIZER;
+static LazyJob *queue_head, *queue_tail;     // FIFO, guarded by queue_lock
+static int worker_running;                   // guarded by queue_lock
+static pthread_t worker_thread;
+
+static size_t pending;                       // handed over, not yet freed
+static unsigned long long freed;
+
+static void run_job(void *arg) {
+    LazyJob *job = arg;
+    job->free_fn(job->ptr);
+    free(job);
+    __atomic_fetch_sub(&pending, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&freed, 1, __ATOMIC_RELAXED);
+}
+
+void lazyfree_retire(void *ptr, void (*free_fn)(void *)) {
+    LazyJob *job = malloc(sizeof(LazyJob));
+    if (!job) {
+        //-- No memory for the job: free it the ordinary way --//
+        epoch_retire(ptr, free_fn);
+        return;
+    }
+    job->next = NULL;
+    job->ptr = ptr;
+    job->free_fn = free_fn;
+    __atomic_fetch_add(&pending, 1, __ATOMIC_RELAXED);
+
+    pthread_mutex_lock(&queue_lock);
+    if (!worker_running) {
+        pthread_mutex_unlock(&queue_lock);
+        epoch_retire(job, run_job);
+        return;
+    }
+    if (queue_tail) {
+        queue_tail->next = job;
+    } else {
+        queue_head = job;
+    }
+    queue_tail = job;
+    pthread_cond_signal(&queue_cond);
+    pthread_mutex_unlock(&queue_lock);
+}
+
+static void *worker_main(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&queue_lock);
+    for (;;) {
+        while (!queue_head && worker_running) {
+            pthread_cond_wait(&queue_cond, &queue_lock);
+        }
+        if (!queue_head) break;
+
+        //-- Take the whole batch so producers never wait behind a free --//
+        LazyJob *batch = queue_head;
+        queue_head = queue_tail = NULL;
+        pthread_mutex_unlock(&queue_lock);
+
+        //-- Every job was unlinked before this point; wait for its readers --//
+        epoch_synchronize();
+        while (batch) {
+            LazyJob *next = batch->next;
+            run_job(batch);
+            batch = next;
+        }
+        pthread_mutex_lock(&queue_lock);
+    }
+    pthread_mutex_unlock(&queue_lock);
+    return NULL;
+}
+
+int lazyfree_start(void) {
+    pthread_mutex_lock(&queue_lock);
+    worker_running = 1;
+    pthread_mutex_unlock(&queue_lock);
+    if (pthread_create(&worker_thread, NULL, worker_main, NULL) != 0) {
+        pthread_mutex_lock(&queue_lock);
+        worker_running = 0;
+        pthread_mutex_unlock(&queue_lock);
+        return -1;
+    }
+    return 0;
+}
+
+void lazyfree_stop(void) {
+    pthread_mutex_lock(&queue_lock);
+    if (!worker_running) {
+        pthread_mutex_unlock(&queue_lock);
+        return;
+    }
+    worker_running = 0;
+    pthread_cond_signal(&queue_cond);
+    pthread_mutex_unlock(&queue_lock);
+    //-- The worker drains the queue before it exits --//
+    pthread_join(worker_thread, NULL);
+}
+
+size_t lazyfree_pending(void) {
+    return __atomic_load_n(&pending, __ATOMIC_RELAXED);
+}
+
+unsigned long long lazyfree_freed(void) {
+    return __atomic_load_n(&freed, __ATOMIC_RELAXED);
+}
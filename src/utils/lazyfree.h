@@ -0,0 +1,67 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/lazyfree.h
+ * Module                    : Lazy Free
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for the background free thread that releases large values
+ *  detached from the keyspace (UNLINK, FLUSHALL ASYNC, overwrites and
+ *  expiry of big lists).
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef LAZYFREE_H
+#define LAZYFREE_H
+
+#include <stddef.h>
+
+/*
+ * Values whose free costs more than LAZYFREE_THRESHOLD allocations (list
+ * elements) are released by the background thread; smaller ones are
+ * cheaper to free in place than to queue.
+ */
+#define LAZYFREE_THRESHOLD 64
+
+/**
+ * @brief Free ptr on the background thread once no reader can reach it.
+ *
+ * Like epoch_retire(), but the object is freed by the lazyfree thread
+ * after the grace period rather than by a client thread leaving its
+ * epoch. Without a running thread it falls back to epoch_retire().
+ *
+ * @param ptr The unlinked object.
+ * @param free_fn Releases it.
+ */
+void lazyfree_retire(void *ptr, void (*free_fn)(void *));
+
+/**
+ * @brief Start the background free thread.
+ *
+ * @return 0 on success, -1 if the thread could not be started.
+ */
+int lazyfree_start(void);
+
+/**
+ * @brief Stop the thread after freeing everything already queued.
+ */
+void lazyfree_stop(void);
+
+/**
+ * @brief Objects handed to lazyfree_retire() and not freed yet.
+ */
+size_t lazyfree_pending(void);
+
+/**
+ * @brief Objects freed by the lazyfree path so far.
+ */
+unsigned long long lazyfree_freed(void);
+
+#endif // LAZYFREE_H
@@ -0,0 +1,408 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/lfMap.c
+ * Module                    : Lock-Free Map
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of the experimental lock-free map (split-ordered
+ *  lists with epoch-based reclamation).
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include "lfMap.h"
+#include "hashTable.h"
+#include "epoch.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Split-Ordered Lists (Shalev & Shavit)
+ *
+ * Every node lives in one lock-free sorted linked list (Harris/Michael),
+ * ordered by the bit-reversed hash. Bucket b points at a permanent dummy
+ * node whose reversed key is b, so the nodes of bucket b sit between its
+ * dummy and the next one. Doubling the bucket count never moves a node:
+ * the new bucket's dummy is simply spliced into the middle of its
+ * parent's run the first time it is used.
+ *
+ * A node is removed by setting the low bit of its next pointer (logical
+ * delete) and then swinging its predecessor past it; whoever wins that
+ * CAS retires the node.
+ *
+ * Values hang off the node through a single atomic pointer, so SET and
+ * DEL linearize on one CAS. A key's node moves through three states:
+ *
+ *   value -> NULL   (DEL; a later SET can revive it)
+ *   NULL  -> DEAD   (DEL trying to unlink; final, the node gets marked)
+ *
+ * A SET that meets a DEAD node marks it itself and inserts a fresh one.
+ */
+
+#define LF_MARK ((uintptr_t)1)
+#define LF_DEAD ((LfValue *)(uintptr_t)-1)
+
+typedef struct LfValue {
+    long long expiry;        //- 0 = no expiry -//
+    char data[];
+} LfValue;
+
+struct LfNode {
+    uintptr_t next;          //- LfNode * | LF_MARK -//
+    uint64_t so_key;         //- bit-reversed hash; low bit 1 = regular, 0 = dummy -//
+    LfValue *value;          //- NULL, LF_DEAD or the current value -//
+    uint32_t key_len;
+    char key[];
+};
+
+/* ==================== Helpers ==================== */
+
+static uint64_t reverse_bits(uint64_t x) {
+    x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+    x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+    x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    return __builtin_bswap64(x);
+}
+
+static inline uint64_t regular_key(uint64_t h) {
+    return reverse_bits(h | (1ULL << 63));
+}
+
+static inline uint64_t dummy_key(size_t bucket) {
+    return reverse_bits((uint64_t)bucket);
+}
+
+static inline LfNode *node_ptr(uintptr_t link) {
+    return (LfNode *)(link & ~LF_MARK);
+}
+
+static inline int is_marked(uintptr_t link) {
+    return (link & LF_MARK) != 0;
+}
+
+static inline uintptr_t load_link(const uintptr_t *link) {
+    return __atomic_load_n(link, __ATOMIC_ACQUIRE);
+}
+
+static inline int cas_link(uintptr_t *link, uintptr_t expected, uintptr_t desired) {
+    return __atomic_compare_exchange_n(link, &expected, desired, 0,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static inline int cas_value(LfNode *node, LfValue *expected, LfValue *desired) {
+    return __atomic_compare_exchange_n(&node->value, &expected, desired, 0,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static inline int value_live(const LfValue *v, long long now) {
+    return v && v != LF_DEAD && (v->expiry == 0 || v->expiry > now);
+}
+
+//-- Order by reversed hash, then (for hash collisions) by key bytes --//
+static int node_compare(const LfNode *node, uint64_t so_key, const char *key, size_t len) {
+    if (node->so_key != so_key) {
+        return node->so_key < so_key ? -1 : 1;
+    }
+    if (!key) return 0;  //- dummies are unique per so_key -//
+    if (node->key_len != len) {
+        return node->key_len < len ? -1 : 1;
+    }
+    return memcmp(node->key, key, len);
+}
+
+static LfNode *new_node(uint64_t so_key, const char *key, size_t len) {
+    LfNode *node = malloc(sizeof(LfNode) + len + 1);
+    if (!node) return NULL;
+    node->next = 0;
+    node->so_key = so_key;
+    node->value = NULL;
+    node->key_len = (uint32_t)len;
+    if (key) {
+        memcpy(node->key, key, len);
+    }
+    node->key[len] = '\0';
+    return node;
+}
+
+static LfValue *new_value(const char *value, long long px) {
+    size_t vlen = strlen(value);
+    LfValue *v = malloc(sizeof(LfValue) + vlen + 1);
+    if (!v) return NULL;
+    v->expiry = px > 0 ? current_millis() + px : 0;
+    memcpy(v->data, value, vlen + 1);
+    return v;
+}
+
+//-- Logically delete a node; idempotent --//
+static void mark_node(LfNode *node) {
+    uintptr_t next = load_link(&node->next);
+    while (!is_marked(next)) {
+        if (cas_link(&node->next, next, next | LF_MARK)) return;
+        next = load_link(&node->next);
+    }
+}
+
+/* ==================== Ordered List ==================== */
+
+/*
+ * Find the first node >= (so_key, key) after head, unlinking any marked
+ * nodes on the way. On return *pred_out is unmarked and pointed at
+ * *curr_out when it was read. Caller is inside an epoch.
+ */
+static int list_find(LfMap *map, LfNode *head, uint64_t so_key, const char *key, size_t len,
+                     LfNode **pred_out, LfNode **curr_out) {
+retry:
+    ;
+    LfNode *pred = head;
+    LfNode *curr = node_ptr(load_link(&pred->next));
+    while (curr) {
+        uintptr_t succ = load_link(&curr->next);
+        if (is_marked(succ)) {
+            if (!cas_link(&pred->next, (uintptr_t)curr, (uintptr_t)node_ptr(succ))) {
+                goto retry;
+            }
+            __atomic_fetch_sub(&map->node_count, 1, __ATOMIC_RELAXED);
+            epoch_retire(curr, free);
+            curr = node_ptr(succ);
+            continue;
+        }
+        int cmp = node_compare(curr, so_key, key, len);
+        if (cmp >= 0) {
+            *pred_out = pred;
+            *curr_out = curr;
+            return cmp == 0;
+        }
+        pred = curr;
+        curr = node_ptr(succ);
+    }
+    *pred_out = pred;
+    *curr_out = NULL;
+    return 0;
+}
+
+/* ==================== Buckets ==================== */
+
+static LfNode **bucket_slot(LfMap *map, size_t bucket) {
+    LfNode ***segp = &map->segments[bucket / LFMAP_SEGMENT_SIZE];
+    LfNode **seg = __atomic_load_n(segp, __ATOMIC_ACQUIRE);
+    if (!seg) {
+        LfNode **fresh = calloc(LFMAP_SEGMENT_SIZE, sizeof(LfNode *));
+        if (!fresh) return NULL;
+        LfNode **expected = NULL;
+        if (__atomic_compare_exchange_n(segp, &expected, fresh, 0,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            seg = fresh;
+        } else {
+            free(fresh);
+            seg = expected;
+        }
+    }
+    return &seg[bucket % LFMAP_SEGMENT_SIZE];
+}
+
+//-- Bucket b's parent is b with its highest set bit cleared --//
+static size_t parent_bucket(size_t bucket) {
+    return bucket & ~((size_t)1 << (63 - __builtin_clzll((unsigned long long)bucket)));
+}
+
+static LfNode *get_bucket(LfMap *map, size_t bucket) {
+    LfNode **slot = bucket_slot(map, bucket);
+    if (!slot) return NULL;
+    LfNode *dummy = __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+    if (dummy) return dummy;
+
+    LfNode *parent = get_bucket(map, parent_bucket(bucket));
+    if (!parent) return NULL;
+
+    uint64_t so_key = dummy_key(bucket);
+    LfNode *node = new_node(so_key, NULL, 0);
+    if (!node) return NULL;
+
+    LfNode *pred, *curr;
+    for (;;) {
+        if (list_find(map, parent, so_key, NULL, 0, &pred, &curr)) {
+            free(node);  //- another thread spliced it in first -//
+            node = curr;
+            break;
+        }
+        node->next = (uintptr_t)curr;
+        if (cas_link(&pred->next, (uintptr_t)curr, (uintptr_t)node)) {
+            break;
+        }
+    }
+    __atomic_store_n(slot, node, __ATOMIC_RELEASE);
+    return node;
+}
+
+static LfNode *bucket_for(LfMap *map, uint64_t h) {
+    size_t count = __atomic_load_n(&map->bucket_count, __ATOMIC_ACQUIRE);
+    return get_bucket(map, h & (count - 1));
+}
+
+static void maybe_grow(LfMap *map) {
+    size_t count = __atomic_load_n(&map->bucket_count, __ATOMIC_RELAXED);
+    size_t nodes = __atomic_load_n(&map->node_count, __ATOMIC_RELAXED);
+    if (nodes > count * LFMAP_LOAD_FACTOR && count < LFMAP_MAX_BUCKETS) {
+        __atomic_compare_exchange_n(&map->bucket_count, &count, count * 2, 0,
+                                    __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+    }
+}
+
+/*
+ * Take v out of node (v -> NULL), then try to unlink the node
+ * (NULL -> DEAD). Returns 1 if this call removed v.
+ */
+static int remove_value(LfMap *map, LfNode *node, LfValue *v) {
+    if (!cas_value(node, v, NULL)) {
+        return 0;
+    }
+    __atomic_fetch_sub(&map->live_count, 1, __ATOMIC_RELAXED);
+    epoch_retire(v, free);
+    if (cas_value(node, NULL, LF_DEAD)) {
+        mark_node(node);
+    }
+    return 1;
+}
+
+/* ==================== Public API ==================== */
+
+LfMap *lfmap_create(void) {
+    LfMap *map = calloc(1, sizeof(LfMap));
+    if (!map) return NULL;
+    map->bucket_count = 2;
+
+    LfNode **slot = bucket_slot(map, 0);
+    LfNode *root = slot ? new_node(dummy_key(0), NULL, 0) : NULL;
+    if (!root) {
+        free(map->segments[0]);
+        free(map);
+        return NULL;
+    }
+    *slot = root;
+    return map;
+}
+
+void lfmap_free(LfMap *map) {
+    if (!map) return;
+    LfNode *node = map->segments[0][0];
+    while (node) {
+        LfNode *next = node_ptr(node->next);
+        if (node->value != LF_DEAD) {
+            free(node->value);
+        }
+        free(node);
+        node = next;
+    }
+    for (size_t i = 0; i < LFMAP_MAX_BUCKETS / LFMAP_SEGMENT_SIZE; i++) {
+        free(map->segments[i]);
+    }
+    free(map);
+}
+
+int lfmap_set(LfMap *map, const char *key, const char *value, long long px) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    uint64_t so_key = regular_key(h);
+
+    LfValue *v = new_value(value, px);
+    if (!v) return -1;
+
+    epoch_enter();
+    LfNode *node = NULL;
+    int rc = -1;
+    for (;;) {
+        LfNode *head = bucket_for(map, h);
+        if (!head) break;
+
+        LfNode *pred, *curr;
+        if (list_find(map, head, so_key, key, len, &pred, &curr)) {
+            LfValue *old = __atomic_load_n(&curr->value, __ATOMIC_ACQUIRE);
+            if (old == LF_DEAD) {
+                //-- Being unlinked: finish the job and insert a fresh node --//
+                mark_node(curr);
+                continue;
+            }
+            if (!cas_value(curr, old, v)) {
+                continue;
+            }
+            if (old) {
+                epoch_retire(old, free);
+            } else {
+                __atomic_fetch_add(&map->live_count, 1, __ATOMIC_RELAXED);
+            }
+            rc = 0;
+            break;
+        }
+
+        if (!node && !(node = new_node(so_key, key, len))) break;
+        node->value = v;
+        node->next = (uintptr_t)curr;
+        if (cas_link(&pred->next, (uintptr_t)curr, (uintptr_t)node)) {
+            node = NULL;
+            __atomic_fetch_add(&map->node_count, 1, __ATOMIC_RELAXED);
+            __atomic_fetch_add(&map->live_count, 1, __ATOMIC_RELAXED);
+            maybe_grow(map);
+            rc = 0;
+            break;
+        }
+    }
+    epoch_exit();
+
+    free(node);  //- built but never published -//
+    if (rc != 0) free(v);
+    return rc;
+}
+
+const char *lfmap_get(LfMap *map, const char *key) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    const char *result = NULL;
+
+    epoch_enter();
+    LfNode *head = bucket_for(map, h);
+    LfNode *pred, *curr;
+    if (head && list_find(map, head, regular_key(h), key, len, &pred, &curr)) {
+        LfValue *v = __atomic_load_n(&curr->value, __ATOMIC_ACQUIRE);
+        if (value_live(v, current_millis())) {
+            result = v->data;
+        } else if (v && v != LF_DEAD) {
+            remove_value(map, curr, v);  //- lazily drop the expired value -//
+        }
+    }
+    epoch_exit();
+    return result;
+}
+
+int lfmap_delete(LfMap *map, const char *key) {
+    size_t len = strlen(key);
+    uint64_t h = hash_key(key, len);
+    int removed = 0;
+
+    epoch_enter();
+    LfNode *head = bucket_for(map, h);
+    LfNode *pred, *curr;
+    if (head && list_find(map, head, regular_key(h), key, len, &pred, &curr)) {
+        for (;;) {
+            LfValue *v = __atomic_load_n(&curr->value, __ATOMIC_ACQUIRE);
+            if (!v || v == LF_DEAD) break;
+            int live = value_live(v, current_millis());
+            if (remove_value(map, curr, v)) {
+                removed = live;
+                break;
+            }
+        }
+    }
+    epoch_exit();
+    return removed;
+}
+
+size_t lfmap_size(LfMap *map) {
+    return __atomic_load_n(&map->live_count, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,93 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/lfMap.h
+ * Module                    : Lock-Free Map
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for an experimental lock-free string map (split-ordered
+ *  lists). It mirrors the set_value/get_value/delete_key API of the
+ *  keyspace so the two can be compared under contention; no operation
+ *  ever waits on another thread.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef LFMAP_H
+#define LFMAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* ==================== Sizing ==================== */
+#define LFMAP_SEGMENT_SIZE 1024          //- buckets per lazily allocated segment -//
+#define LFMAP_MAX_BUCKETS  (1u << 24)
+#define LFMAP_LOAD_FACTOR  2             //- nodes per bucket before doubling -//
+
+typedef struct LfNode LfNode;
+
+typedef struct LfMap {
+    LfNode **segments[LFMAP_MAX_BUCKETS / LFMAP_SEGMENT_SIZE];
+    size_t bucket_count;     //- power of two, only ever doubles -//
+    size_t node_count;       //- regular nodes in the list, drives growth -//
+    size_t live_count;       //- keys currently holding a value -//
+} LfMap;
+
+/**
+ * @brief Create an empty map.
+ *
+ * @return The new map, or NULL on allocation failure.
+ */
+LfMap *lfmap_create(void);
+
+/**
+ * @brief Free the map and every value in it.
+ *
+ * @note No other thread may be using the map.
+ */
+void lfmap_free(LfMap *map);
+
+/**
+ * @brief Set key to a copy of value.
+ *
+ * @param map The map.
+ * @param key The key to set.
+ * @param value The string value.
+ * @param px Expiry time in milliseconds (0 for no expiry).
+ * @return 0 on success, -1 on allocation failure.
+ */
+int lfmap_set(LfMap *map, const char *key, const char *value, long long px);
+
+/**
+ * @brief Get the value at key.
+ *
+ * Like get_value(), the returned pointer is only guaranteed to stay
+ * valid while the caller is inside an epoch critical section.
+ *
+ * @param map The map.
+ * @param key The key to retrieve.
+ * @return The value, or NULL if not found or expired.
+ */
+const char *lfmap_get(LfMap *map, const char *key);
+
+/**
+ * @brief Delete key.
+ *
+ * @param map The map.
+ * @param key The key to delete.
+ * @return 1 if this call removed the key, 0 if it was not present.
+ */
+int lfmap_delete(LfMap *map, const char *key);
+
+/**
+ * @brief Number of keys currently holding a value (approximate under concurrency).
+ */
+size_t lfmap_size(LfMap *map);
+
+#endif // LFMAP_H
@@ -5,8 +5,8 @@
  * 
  * File                      : src/utils/list.c
  * Module                    : Linked List
- * Last Updating Author      : kei077
- * Last Update               : 08/06/2025
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
  * Version                   : 1.0.0
  * 
  * Description:
@@ -17,10 +17,11 @@
  */
 
 #include "list.h"
+#include "memAlloc.h"
 #include <string.h>
 
 List *list_create(void) {
-    List *list = malloc(sizeof(List));
+    List *list = mem_alloc(sizeof(List));
     if (!list) return NULL;
     
     list->head = NULL;
@@ -33,12 +34,12 @@ List *list_create(void) {
 size_t list_rpush(List *list, const char *value) {
     if (!list || !value) return 0;
     
-    ListNode *node = malloc(sizeof(ListNode));
+    ListNode *node = mem_alloc(sizeof(ListNode));
     if (!node) return list->length;
     
-    node->value = strdup(value);
+    node->value = mem_strdup(value);
     if (!node->value) {
-        free(node);
+        mem_free(node, sizeof(ListNode));
         return list->length;
     }
     
@@ -58,12 +59,12 @@ size_t list_rpush(List *list, const char *value) {
 size_t list_lpush(List *list, const char *value) {
     if (!list || !value) return 0;
     
-    ListNode *node = malloc(sizeof(ListNode));
+    ListNode *node = mem_alloc(sizeof(ListNode));
     if (!node) return list->length;
     
-    node->value = strdup(value);
+    node->value = mem_strdup(value);
     if (!node->value) {
-        free(node);
+        mem_free(node, sizeof(ListNode));
         return list->length;
     }
     
@@ -84,7 +85,7 @@ size_t list_length(const List *list) {
     return list ? list->length : 0;
 }
 
-char **list_range(List *list, int start, int end, int *length) {
+char **list_range(List *list, int start, int end, int *length, Arena *arena) {
     if (!list || !length) {
         *length = 0;
         return NULL;
@@ -102,31 +103,22 @@ char **list_range(List *list, int start, int end, int *length) {
         return NULL;
     }
 
-    *length = end - start + 1;
-    char **result = malloc(sizeof(char*) * (*length));
-    if (!result) {
-        *length = 0;
-        return NULL;
-    }
+    int count = end - start + 1;
+    char **result = arena_alloc(arena, sizeof(char*) * count);
+    if (!result) return NULL;
 
     ListNode *current = list->head;
     for (int i = 0; i < start; i++) {
         current = current->next;
     }
 
-    for (int i = 0; i < *length; i++) {
-        result[i] = strdup(current->value);
-        if (!result[i]) {
-            for (int j = 0; j < i; j++) {
-                free(result[j]);
-            }
-            free(result);
-            *length = 0;
-            return NULL;
-        }
+    for (int i = 0; i < count; i++) {
+        result[i] = arena_strndup(arena, current->value, strlen(current->value));
+        if (!result[i]) return NULL;
         current = current->next;
     }
 
+    *length = count;
     return result;
 }
 
@@ -136,8 +128,9 @@ char* lpop_element(List *list) {
         return NULL;
     }
 
+    //-- The node's string is handed to the caller as is --//
     ListNode *node = list->head;
-    char *value = strdup(node->value);
+    char *value = node->value;
     
     list->head = node->next;
     list->length--;
@@ -146,25 +139,32 @@ char* lpop_element(List *list) {
         list->tail = NULL;
     }
     
-    free(node);
+    mem_free(node, sizeof(ListNode));
     return value;
 }
 
-char **lpop_multiple(List *list, int length, int *actual_length) {
+char **lpop_multiple(List *list, int length, int *actual_length, Arena *arena) {
     if (!list || length <= 0 || list->length == 0) {
         *actual_length = 0;
         return NULL;
     }
 
     int num = (length > list->length) ? list->length : length;
-    char **results = malloc(sizeof(char*) * num);
+    char **results = arena_alloc(arena, sizeof(char*) * num);
     if (!results) {
         *actual_length = 0;
         return NULL;
     }
 
+    //-- Copies go to the arena so the storage strings can be released right away --//
     for (int i = 0; i < num; i++) {
-        results[i] = lpop_element(list);  
+        char *value = lpop_element(list);
+        results[i] = arena_strndup(arena, value, strlen(value));
+        mem_free_str(value);
+        if (!results[i]) {
+            *actual_length = i;
+            return results;
+        }
     }
 
     *actual_length = num;
@@ -177,10 +177,10 @@ void list_free(List *list) {
     ListNode *current = list->head;
     while (current) {
         ListNode *next = current->next;
-        free(current->value);
-        free(current);
+        mem_free_str(current->value);
+        mem_free(current, sizeof(ListNode));
         current = next;
     }
     
-    free(list);
+    mem_free(list, sizeof(List));
 }
@@ -5,8 +5,8 @@
  * 
  * File                      : src/utils/list.h
  * Module                    : Linked List
- * Last Updating Author      : kei077
- * Last Update               : 08/06/2025
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
  * Version                   : 1.0.0
  * 
  * Description:
@@ -20,6 +20,7 @@
 #define LIST_H
 
 #include <stdlib.h>
+#include "arena.h"
 
 /* ==================== List Node Structure ==================== */
 typedef struct ListNode {
@@ -80,16 +81,17 @@ void list_free(List *list);
  * @param start Starting index (can be negative)
  * @param end Ending index (can be negative)
  * @param count Pointer to store the number of elements returned
- * @return Array of strings that must be freed by caller, NULL on error
+ * @param arena Scratch arena the array and the copied elements live in
+ * @return Array of strings valid until the arena is reset, NULL on error
  */
-char **list_range(List *list, int start, int end, int *count);
+char **list_range(List *list, int start, int end, int *count, Arena *arena);
 
 /**
  * Remove and return the first element (head) of the list.
  * 
  * @param list The list to remove the element from.
- * @return A newly allocated string containing the value, or NULL if the list is empty.
- *         Caller is responsible for freeing the returned string.
+ * @return The popped value, or NULL if the list is empty.
+ *         Caller releases it with mem_free_str().
  */
 char* lpop_element(List *list);
 
@@ -99,10 +101,10 @@ char* lpop_element(List *list);
  * @param list The list to pop from.
  * @param length The number of elements to attempt to pop.
  * @param actual_length Pointer to an integer where the number of actually popped elements will be stored.
- * @return Array of strings (heap-allocated) popped from the list, or NULL on error.
- *         Caller is responsible for freeing each string and the array itself.
+ * @param arena Scratch arena the array and the popped values are copied into.
+ * @return Array of strings valid until the arena is reset, or NULL on error.
  */
-char **lpop_multiple(List *list, int length, int *actual_length);
+char **lpop_multiple(List *list, int length, int *actual_length, Arena *arena);
 
 
 #endif // LIST_H
@@ -0,0 +1,282 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/memAlloc.c
+ * Module                    : Storage Allocator
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of the storage allocation layer and its per-thread
+ *  byte accounting.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#define _GNU_SOURCE
+#include "memAlloc.h"
+#include "slab.h"
+#include "hugePages.h"
+#include <malloc.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+ * Accounting is exact and costs no shared writes: every thread owns a
+ * counter block that only it updates, and readers sum all blocks. Blocks
+ * are never freed. When a thread exits its block is released and the
+ * next new thread adopts it, totals included, so the sum stays correct
+ * whichever thread frees what.
+ */
+
+typedef struct MemCounters {
+    struct MemCounters *next;
+    int owned;                         //- claimed by a live thread -//
+    long long used;                    //- written by the owner only -//
+    long long requested;
+    long long allocations;
+} MemCounters;
+
+static MemCounters shared_counters = { .owned = 1 };    // fallback when a block cannot be allocated
+static MemCounters *counter_blocks = &shared_counters;  // push-only list
+static __thread MemCounters *my_counters;
+static pthread_key_t exit_key;
+static pthread_once_t exit_once = PTHREAD_ONCE_INIT;
+
+static void thread_exit(void *arg) {
+    MemCounters *c = arg;
+    my_counters = NULL;
+    __atomic_store_n(&c->owned, 0, __ATOMIC_RELEASE);
+}
+
+static void make_exit_key(void) {
+    pthread_key_create(&exit_key, thread_exit);
+}
+
+//-- Adopt a released block, or add a new one; re-armed if a later destructor frees memory --//
+static MemCounters *claim_counters(void) {
+    pthread_once(&exit_once, make_exit_key);
+    MemCounters *c = __atomic_load_n(&counter_blocks, __ATOMIC_ACQUIRE);
+    for (; c; c = c->next) {
+        int expected = 0;
+        if (__atomic_compare_exchange_n(&c->owned, &expected, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            break;
+        }
+    }
+    if (!c) {
+        c = calloc(1, sizeof(MemCounters));
+        if (!c) return &shared_counters;     //- racy between threads, but still summed -//
+        c->owned = 1;
+        c->next = __atomic_load_n(&counter_blocks, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&counter_blocks, &c->next, c, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+        }
+    }
+    pthread_setspecific(exit_key, c);
+    my_counters = c;
+    return c;
+}
+
+static inline void account(long long used, long long requested, long long allocations) {
+    MemCounters *c = my_counters ? my_counters : claim_counters();
+    __atomic_store_n(&c->used, c->used + used, __ATOMIC_RELAXED);
+    __atomic_store_n(&c->requested, c->requested + requested, __ATOMIC_RELAXED);
+    __atomic_store_n(&c->allocations, c->allocations + allocations, __ATOMIC_RELAXED);
+}
+
+#ifdef MEMORA_ALLOC_LIBC
+
+void *mem_alloc(size_t size) {
+    void *ptr = malloc(size);
+    if (ptr) account((long long)malloc_usable_size(ptr), (long long)size, 1);
+    return ptr;
+}
+
+void mem_free(void *ptr, size_t size) {
+    if (!ptr) return;
+    account(-(long long)malloc_usable_size(ptr), -(long long)size, -1);
+    free(ptr);
+}
+
+size_t mem_alloc_size(size_t size) {
+    return size;
+}
+
+size_t mem_usable_size(const void *ptr, size_t size) {
+    (void)size;
+    return malloc_usable_size((void *)ptr);
+}
+
+int mem_defrag_hint(const void *ptr, size_t size) {
+    (void)ptr;
+    (void)size;
+    return 0;
+}
+
+void *mem_defrag_alloc(size_t size) {
+    return mem_alloc(size);
+}
+
+void mem_defrag_free(void *ptr, size_t size) {
+    mem_free(ptr, size);
+}
+
+void mem_defrag_prepare(void) {
+}
+
+size_t mem_defrag_release(void) {
+    return 0;
+}
+
+#else
+
+/*
+ * With huge pages on, allocations of a huge page or more (large Swiss
+ * slot arrays) get mappings of their own; the choice depends only on
+ * the size and the fixed mode, so mem_free() makes the same one.
+ */
+static inline size_t huge_span(size_t size) {
+    if (size < HUGE_PAGE_SIZE || hugepages_mode() == HUGEPAGES_OFF) return 0;
+    return (size + HUGE_PAGE_SIZE - 1) & ~(size_t)(HUGE_PAGE_SIZE - 1);
+}
+
+void *mem_alloc(size_t size) {
+    int cls = slab_class_for(size);
+    void *ptr;
+    size_t real;
+    if (cls >= 0) {
+        ptr = slab_alloc(cls);
+        real = slab_class_size(cls);
+    } else if ((real = huge_span(size)) != 0) {
+        ptr = huge_map(real);
+    } else {
+        //-- Above the largest class: straight to the system, still 16-byte aligned --//
+        if (posix_memalign(&ptr, 16, size) != 0) ptr = NULL;
+        real = ptr ? malloc_usable_size(ptr) : 0;
+    }
+    if (ptr) account((long long)real, (long long)size, 1);
+    return ptr;
+}
+
+void mem_free(void *ptr, size_t size) {
+    if (!ptr) return;
+    int cls = slab_class_for(size);
+    size_t span;
+    if (cls >= 0) {
+        account(-(long long)slab_class_size(cls), -(long long)size, -1);
+        slab_free(cls, ptr);
+    } else if ((span = huge_span(size)) != 0) {
+        account(-(long long)span, -(long long)size, -1);
+        huge_unmap(ptr, span);
+    } else {
+        account(-(long long)malloc_usable_size(ptr), -(long long)size, -1);
+        free(ptr);
+    }
+}
+
+size_t mem_alloc_size(size_t size) {
+    int cls = slab_class_for(size);
+    if (cls >= 0) return slab_class_size(cls);
+    size_t span = huge_span(size);
+    return span ? span : size;
+}
+
+size_t mem_usable_size(const void *ptr, size_t size) {
+    int cls = slab_class_for(size);
+    if (cls >= 0) return slab_class_size(cls);
+    size_t span = huge_span(size);
+    return span ? span : malloc_usable_size((void *)ptr);
+}
+
+int mem_defrag_hint(const void *ptr, size_t size) {
+    int cls = slab_class_for(size);
+    return cls >= 0 && slab_should_move(cls, ptr);
+}
+
+void *mem_defrag_alloc(size_t size) {
+    int cls = slab_class_for(size);
+    if (cls < 0) return mem_alloc(size);
+    void *ptr = slab_alloc_direct(cls);
+    if (ptr) account((long long)slab_class_size(cls), (long long)size, 1);
+    return ptr;
+}
+
+void mem_defrag_free(void *ptr, size_t size) {
+    if (!ptr) return;
+    int cls = slab_class_for(size);
+    if (cls < 0) {
+        mem_free(ptr, size);
+        return;
+    }
+    account(-(long long)slab_class_size(cls), -(long long)size, -1);
+    slab_free_direct(cls, ptr);
+}
+
+void mem_defrag_prepare(void) {
+    for (int cls = 0; cls < SLAB_CLASS_COUNT; cls++) slab_plan_defrag(cls);
+}
+
+size_t mem_defrag_release(void) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t chunks = 0;
+    for (int cls = 0; cls < SLAB_CLASS_COUNT; cls++) chunks += slab_release_empty(cls);
+    //-- Each released chunk keeps its header page --//
+    return chunks * (SLAB_CHUNK_SIZE - page);
+}
+
+#endif // MEMORA_ALLOC_LIBC
+
+char *mem_strdup(const char *s) {
+    size_t n = strlen(s) + 1;
+    char *copy = mem_alloc(n);
+    if (copy) memcpy(copy, s, n);
+    return copy;
+}
+
+void mem_free_str(char *s) {
+    if (s) mem_free(s, strlen(s) + 1);
+}
+
+size_t mem_used(void) {
+    long long used = 0;
+    for (MemCounters *c = __atomic_load_n(&counter_blocks, __ATOMIC_ACQUIRE); c; c = c->next) {
+        used += __atomic_load_n(&c->used, __ATOMIC_RELAXED);
+    }
+    return used > 0 ? (size_t)used : 0;
+}
+
+//-- Resident pages from /proc, 0 where it is not available --//
+static size_t read_rss(void) {
+    FILE *f = fopen("/proc/self/statm", "r");
+    if (!f) return 0;
+    unsigned long size, resident;
+    int n = fscanf(f, "%lu %lu", &size, &resident);
+    fclose(f);
+    return n == 2 ? resident * (size_t)sysconf(_SC_PAGESIZE) : 0;
+}
+
+void mem_stats(MemStats *out) {
+    long long used = 0, requested = 0, allocations = 0;
+    for (MemCounters *c = __atomic_load_n(&counter_blocks, __ATOMIC_ACQUIRE); c; c = c->next) {
+        used += __atomic_load_n(&c->used, __ATOMIC_RELAXED);
+        requested += __atomic_load_n(&c->requested, __ATOMIC_RELAXED);
+        allocations += __atomic_load_n(&c->allocations, __ATOMIC_RELAXED);
+    }
+    out->used = used > 0 ? (size_t)used : 0;
+    out->requested = requested > 0 ? (size_t)requested : 0;
+    out->allocations = allocations > 0 ? (size_t)allocations : 0;
+    out->slab_reserved = slab_reserved_bytes();
+    out->slab_used = 0;
+    for (int cls = 0; cls < SLAB_CLASS_COUNT; cls++) {
+        SlabStats ss;
+        slab_stats(cls, &ss);
+        out->slab_used += ss.objects_in_use * ss.object_size;
+    }
+    out->rss = read_rss();
+}
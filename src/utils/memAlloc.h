@@ -0,0 +1,125 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/memAlloc.h
+ * Module                    : Storage Allocator
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for the single allocation layer used by everything the
+ *  keyspace stores: entries, value strings, lists and index arrays.
+ *  Requests up to SLAB_MAX_SIZE go to the size-class pools (slab.h),
+ *  larger ones to the system allocator, and every byte is accounted.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef MEMALLOC_H
+#define MEMALLOC_H
+
+#include <stddef.h>
+
+#ifdef MEMORA_ALLOC_LIBC
+#define MEM_ALLOCATOR_NAME "libc"
+#else
+#define MEM_ALLOCATOR_NAME "slab"
+#endif
+
+typedef struct MemStats {
+    size_t used;             //- bytes handed out, rounded up to what each allocation really occupies -//
+    size_t requested;        //- bytes callers asked for -//
+    size_t allocations;      //- live allocations -//
+    size_t slab_reserved;    //- bytes in slab chunks, used or cached -//
+    size_t slab_used;        //- of those, bytes in objects handed out -//
+    size_t rss;              //- resident set size of the process, 0 if unknown -//
+} MemStats;
+
+/**
+ * @brief Allocate storage memory (16-byte aligned).
+ *
+ * Sized like C++ sized delete: the caller passes the same size back to
+ * mem_free(), which keeps the pools free of per-object headers.
+ *
+ * @param size Bytes wanted (> 0).
+ * @return The memory, or NULL when out of memory.
+ */
+void *mem_alloc(size_t size);
+
+/**
+ * @brief Release memory from mem_alloc().
+ *
+ * @param ptr The allocation (NULL is ignored).
+ * @param size The size it was allocated with.
+ */
+void mem_free(void *ptr, size_t size);
+
+/**
+ * @brief Duplicate a string into storage memory.
+ */
+char *mem_strdup(const char *s);
+
+/**
+ * @brief Release a string from mem_strdup().
+ */
+void mem_free_str(char *s);
+
+/**
+ * @brief Bytes an allocation of size really occupies (its size class).
+ */
+size_t mem_alloc_size(size_t size);
+
+/**
+ * @brief Bytes the live allocation ptr of size occupies, exactly as mem_used() counts it.
+ */
+size_t mem_usable_size(const void *ptr, size_t size);
+
+/**
+ * @brief Bytes currently allocated through this layer (exact).
+ */
+size_t mem_used(void);
+
+/**
+ * @brief Snapshot of the allocator's accounting.
+ */
+void mem_stats(MemStats *out);
+
+/* ==================== Defragmentation ==================== */
+/*
+ * Used by the active defragmenter (defrag.h) to move live allocations
+ * out of sparse slab chunks. With ALLOCATOR=libc nothing is ever worth
+ * moving and nothing is released.
+ */
+
+/**
+ * @brief Whether an allocation of size at ptr should be moved.
+ */
+int mem_defrag_hint(const void *ptr, size_t size);
+
+/**
+ * @brief Allocate the new home of a moved allocation, densest chunk first.
+ */
+void *mem_defrag_alloc(size_t size);
+
+/**
+ * @brief Free a moved-from allocation straight back to its chunk.
+ */
+void mem_defrag_free(void *ptr, size_t size);
+
+/**
+ * @brief Start a defrag pass: pick the chunks to empty in every class.
+ */
+void mem_defrag_prepare(void);
+
+/**
+ * @brief Give the pages of empty slab chunks back to the OS.
+ *
+ * @return Resident bytes released.
+ */
+size_t mem_defrag_release(void);
+
+#endif // MEMALLOC_H
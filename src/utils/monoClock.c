@@ -0,0 +1,96 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/monoClock.c
+ * Module                    : Server Clock
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of the cached monotonic server clock.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include "monoClock.h"
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * Every lookup needs the time to check TTLs. Reading a cached value is a
+ * plain load from a line that changes once per millisecond, instead of a
+ * clock call per lookup. The ticker only writes the line, so readers on
+ * other cores keep a shared copy between ticks.
+ */
+
+long long mono_clock_cached;
+
+static pthread_t ticker_thread;
+static volatile int ticker_running;
+static int read_clock_id = -1;     // chosen on first direct read
+
+static long long read_ms(clockid_t id) {
+    struct timespec ts;
+    clock_gettime(id, &ts);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+long long mono_clock_read(void) {
+    int id = __atomic_load_n(&read_clock_id, __ATOMIC_RELAXED);
+    if (id < 0) {
+        //-- Coarse reads skip the TSC but tick only every jiffy on some kernels --//
+        id = CLOCK_MONOTONIC;
+#ifdef CLOCK_MONOTONIC_COARSE
+        struct timespec res;
+        if (clock_getres(CLOCK_MONOTONIC_COARSE, &res) == 0 && res.tv_sec == 0 && res.tv_nsec <= 1000000) {
+            id = CLOCK_MONOTONIC_COARSE;
+        }
+#endif
+        __atomic_store_n(&read_clock_id, id, __ATOMIC_RELAXED);
+    }
+    return read_ms((clockid_t)id);
+}
+
+long long wall_clock_ms(void) {
+    return read_ms(CLOCK_REALTIME);
+}
+
+long long wall_to_mono_ms(long long wall_ms) {
+    return wall_ms - wall_clock_ms() + mono_clock_ms();
+}
+
+long long mono_to_wall_ms(long long mono_ms) {
+    return mono_ms - mono_clock_ms() + wall_clock_ms();
+}
+
+static void *ticker_main(void *arg) {
+    (void)arg;
+    while (__atomic_load_n(&ticker_running, __ATOMIC_RELAXED)) {
+        __atomic_store_n(&mono_clock_cached, read_ms(CLOCK_MONOTONIC), __ATOMIC_RELAXED);
+        usleep(MONO_CLOCK_TICK_US);
+    }
+    return NULL;
+}
+
+int mono_clock_start(void) {
+    __atomic_store_n(&mono_clock_cached, read_ms(CLOCK_MONOTONIC), __ATOMIC_RELAXED);
+    __atomic_store_n(&ticker_running, 1, __ATOMIC_RELAXED);
+    if (pthread_create(&ticker_thread, NULL, ticker_main, NULL) != 0) {
+        __atomic_store_n(&ticker_running, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&mono_clock_cached, 0, __ATOMIC_RELAXED);
+        return -1;
+    }
+    return 0;
+}
+
+void mono_clock_stop(void) {
+    if (!__atomic_load_n(&ticker_running, __ATOMIC_RELAXED)) return;
+    __atomic_store_n(&ticker_running, 0, __ATOMIC_RELAXED);
+    pthread_join(ticker_thread, NULL);
+    __atomic_store_n(&mono_clock_cached, 0, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,81 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/monoClock.h
+ * Module                    : Server Clock
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for the server clock: monotonic milliseconds kept in a cached
+ *  atomic by a ticker thread, plus conversions from wall-clock time.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef MONOCLOCK_H
+#define MONOCLOCK_H
+
+#define MONO_CLOCK_TICK_US 1000    //- ticker refresh period -//
+
+/*
+ * TTL deadlines and timeouts are measured on CLOCK_MONOTONIC, so NTP
+ * steps or a changed system time never expire keys early or keep them
+ * forever. Wall-clock time is only used to convert absolute timestamps
+ * given by clients (PEXPIREAT and friends).
+ */
+
+//- cached monotonic ms, 0 while no ticker runs -//
+extern long long mono_clock_cached;
+
+/**
+ * @brief Read the monotonic clock directly, in ms.
+ *
+ * Uses CLOCK_MONOTONIC_COARSE when its resolution is 1 ms or better,
+ * CLOCK_MONOTONIC otherwise.
+ */
+long long mono_clock_read(void);
+
+/**
+ * @brief Current monotonic time in ms.
+ *
+ * One relaxed load while the ticker runs; a direct read otherwise (tests,
+ * benchmarks).
+ */
+static inline long long mono_clock_ms(void) {
+    long long t = __atomic_load_n(&mono_clock_cached, __ATOMIC_RELAXED);
+    return t ? t : mono_clock_read();
+}
+
+/**
+ * @brief Current wall-clock time in ms since the Unix epoch.
+ */
+long long wall_clock_ms(void);
+
+/**
+ * @brief Convert a wall-clock timestamp (ms since the Unix epoch) to the monotonic clock.
+ */
+long long wall_to_mono_ms(long long wall_ms);
+
+/**
+ * @brief Convert a monotonic timestamp to wall-clock ms since the Unix epoch.
+ */
+long long mono_to_wall_ms(long long mono_ms);
+
+/**
+ * @brief Start the ticker thread that refreshes mono_clock_cached.
+ *
+ * @return 0 on success, -1 if the thread could not be started.
+ */
+int mono_clock_start(void);
+
+/**
+ * @brief Stop the ticker; mono_clock_ms() falls back to direct reads.
+ */
+void mono_clock_stop(void);
+
+#endif // MONOCLOCK_H
@@ -0,0 +1,156 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/numeric.c
+ * Module                    : Numeric Conversions
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of the numeric conversion helpers.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include "numeric.h"
+#include <errno.h>
+#include <limits.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ==================== Integers ==================== */
+
+int string2ll(const char *s, size_t len, long long *out) {
+    if (len == 0 || len >= LL_STR_SIZE) return 0;
+
+    size_t i = 0;
+    int negative = 0;
+    if (s[0] == '-') {
+        negative = 1;
+        if (++i == len) return 0;
+    }
+    if (s[i] == '0') {
+        //-- Only "0" itself may start with a zero ("-0" is not canonical) --//
+        if (len == 1) {
+            *out = 0;
+            return 1;
+        }
+        return 0;
+    }
+
+    unsigned long long v = 0;
+    for (; i < len; i++) {
+        if (s[i] < '0' || s[i] > '9') return 0;
+        unsigned long long d = (unsigned long long)(s[i] - '0');
+        if (v > (ULLONG_MAX - d) / 10) return 0;
+        v = v * 10 + d;
+    }
+
+    if (negative) {
+        if (v > (unsigned long long)LLONG_MAX + 1) return 0;
+        *out = (long long)(0 - v);
+    } else {
+        if (v > (unsigned long long)LLONG_MAX) return 0;
+        *out = (long long)v;
+    }
+    return 1;
+}
+
+static const char digit_pairs[201] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+size_t ll2str(char *buf, long long v) {
+    unsigned long long u = v < 0 ? 0 - (unsigned long long)v : (unsigned long long)v;
+
+    //-- Emit two digits per division, right to left --//
+    char tmp[LL_STR_SIZE];
+    size_t pos = sizeof(tmp);
+    while (u >= 100) {
+        unsigned int pair = (unsigned int)(u % 100) * 2;
+        u /= 100;
+        tmp[--pos] = digit_pairs[pair + 1];
+        tmp[--pos] = digit_pairs[pair];
+    }
+    if (u >= 10) {
+        unsigned int pair = (unsigned int)u * 2;
+        tmp[--pos] = digit_pairs[pair + 1];
+        tmp[--pos] = digit_pairs[pair];
+    } else {
+        tmp[--pos] = (char)('0' + u);
+    }
+    if (v < 0) tmp[--pos] = '-';
+
+    size_t n = sizeof(tmp) - pos;
+    memcpy(buf, tmp + pos, n);
+    buf[n] = '\0';
+    return n;
+}
+
+/* ==================== Floats ==================== */
+
+int string2ld(const char *s, size_t len, long double *out) {
+    if (len == 0 || len >= LD_STR_SIZE) return 0;
+
+    char buf[LD_STR_SIZE];
+    memcpy(buf, s, len);
+    buf[len] = '\0';
+    if (buf[0] == ' ' || buf[0] == '\t') return 0;
+
+    errno = 0;
+    char *end = NULL;
+    long double v = strtold(buf, &end);
+    if (*end != '\0' || errno == ERANGE || isnan(v) || isinf(v)) return 0;
+    *out = v;
+    return 1;
+}
+
+size_t ld2str(char *buf, long double v) {
+    int n = snprintf(buf, LD_STR_SIZE, "%.17Lf", v);
+    if (n <= 0 || n >= LD_STR_SIZE) {
+        n = snprintf(buf, LD_STR_SIZE, "%.17Lg", v);
+        return n > 0 ? (size_t)n : 0;
+    }
+    //-- Drop trailing zeros (and a trailing '.') from the fixed notation --//
+    if (strchr(buf, '.')) {
+        while (n > 0 && buf[n - 1] == '0') n--;
+        if (n > 0 && buf[n - 1] == '.') n--;
+        buf[n] = '\0';
+    }
+    if (strcmp(buf, "-0") == 0) {
+        buf[0] = '0';
+        buf[1] = '\0';
+        n = 1;
+    }
+    return (size_t)n;
+}
+
+/* ==================== Shared Integers ==================== */
+
+static char shared_digits[SHARED_INTEGERS][5];  //- "9999" plus NUL -//
+static unsigned char shared_lengths[SHARED_INTEGERS];
+static pthread_once_t shared_once = PTHREAD_ONCE_INIT;
+
+static void build_shared_integers(void) {
+    for (int i = 0; i < SHARED_INTEGERS; i++) {
+        shared_lengths[i] = (unsigned char)ll2str(shared_digits[i], i);
+    }
+}
+
+const char *shared_integer(long long v, size_t *len) {
+    if (v < 0 || v >= SHARED_INTEGERS) return NULL;
+    pthread_once(&shared_once, build_shared_integers);
+    if (len) *len = shared_lengths[v];
+    return shared_digits[v];
+}
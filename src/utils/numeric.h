@@ -0,0 +1,82 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/numeric.h
+ * Module                    : Numeric Conversions
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for strict string <-> integer/float conversions and the
+ *  shared table of pre-rendered small integers.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef NUMERIC_H
+#define NUMERIC_H
+
+#include <stddef.h>
+
+/* ==================== Shared Integers ==================== */
+/*
+ * Integers in [0, SHARED_INTEGERS) are rendered once into a static
+ * table; replies and lookups for them never format anything.
+ */
+#define SHARED_INTEGERS 10000
+
+#define LL_STR_SIZE 21   //- "-9223372036854775808" plus NUL -//
+#define LD_STR_SIZE 64
+
+/**
+ * @brief Parse a whole string as a signed 64-bit integer.
+ *
+ * Strict: no sign-only strings, no leading '+', whitespace or zeros
+ * ("0" itself is fine), and no overflow, so that ll2str() of the result
+ * gives back exactly the same bytes.
+ *
+ * @param s The string.
+ * @param len Its length.
+ * @param out Receives the value on success.
+ * @return 1 on success, 0 if s is not a canonical integer.
+ */
+int string2ll(const char *s, size_t len, long long *out);
+
+/**
+ * @brief Format v in decimal.
+ *
+ * @param buf Destination, at least LL_STR_SIZE bytes.
+ * @param v The value.
+ * @return Number of characters written (excluding the NUL).
+ */
+size_t ll2str(char *buf, long long v);
+
+/**
+ * @brief Parse a whole string as a finite long double.
+ *
+ * @return 1 on success, 0 on junk, empty input, NaN or infinity.
+ */
+int string2ld(const char *s, size_t len, long double *out);
+
+/**
+ * @brief Format v with up to 17 significant digits and no trailing zeros.
+ *
+ * @param buf Destination, at least LD_STR_SIZE bytes.
+ * @return Number of characters written (excluding the NUL).
+ */
+size_t ld2str(char *buf, long double v);
+
+/**
+ * @brief The shared rendering of a small integer.
+ *
+ * @param v The value.
+ * @param len Receives the string length (may be NULL).
+ * @return A static string, or NULL if v is outside [0, SHARED_INTEGERS).
+ */
+const char *shared_integer(long long v, size_t *len);
+
+#endif // NUMERIC_H
@@ -0,0 +1,455 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/slab.c
+ * Module                    : Slab Allocator
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of the size-class slab pools and their thread caches.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#define _GNU_SOURCE
+#include "slab.h"
+#include "hugePages.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/*
+ * Each size class owns a pool of chunks behind one mutex. A chunk keeps
+ * its own free list in a header on its first line, so the pool knows how
+ * full every chunk is; the pool links the chunks that have free objects
+ * and carves the uncarved tail of its newest chunk. Threads never take
+ * the mutex per object. Their cache holds up to 2 * SLAB_BATCH free
+ * objects, is refilled SLAB_BATCH at a time and spills SLAB_BATCH back
+ * when full, so steady-state alloc and free are a pointer pop and push.
+ *
+ * Classes step by 16 bytes up to 64 and then by halves of a power of two
+ * (96, 128, 192, ...), so internal waste stays under a third. Chunks are
+ * SLAB_CHUNK_SIZE-aligned slices of SLAB_REGION_SIZE mappings, so an
+ * object's chunk is found by masking its address. Chunks are only given
+ * back by slab_release_empty(), which returns the pages of chunks with
+ * no live object to the OS and keeps the address range for reuse.
+ */
+
+#define SLAB_LINE 64
+
+typedef struct FreeObj {
+    struct FreeObj *next;
+} FreeObj;
+
+typedef struct SlabChunk {
+    struct SlabChunk *next;            //- partial list, or the released list -//
+    struct SlabChunk *prev;
+    FreeObj *free;                     //- objects returned to this chunk -//
+    unsigned int carved;               //- objects carved out of it so far -//
+    unsigned int nfree;                //- length of free; nonzero exactly while on the partial list -//
+    unsigned int evacuate;             //- marked by slab_plan_defrag(): move its objects out -//
+} SlabChunk;
+
+_Static_assert(sizeof(SlabChunk) <= SLAB_LINE, "chunk header must fit the first line");
+
+typedef struct SlabPool {
+    pthread_mutex_t lock;
+    SlabChunk *partial;                //- chunks with free objects -//
+    SlabChunk *carving;                //- chunk the carve range belongs to -//
+    char *carve_pos;                   //- uncarved tail of the newest chunk -//
+    char *carve_end;
+    size_t chunks;
+    size_t objects_total;
+    size_t carved;                     //- objects carved from the pool's chunks -//
+    size_t pooled;                     //- of those, on chunk free lists -//
+    unsigned long long allocs;         //- published by thread caches -//
+    unsigned long long frees;
+    size_t size;
+} SlabPool;
+
+typedef struct SlabCache {
+    FreeObj *head;
+    size_t count;
+    unsigned long pending_allocs;      //- not yet added to the pool's counters -//
+    unsigned long pending_frees;
+} SlabCache;
+
+#define POOL(bytes) { .lock = PTHREAD_MUTEX_INITIALIZER, .size = (bytes) }
+
+static SlabPool pools[SLAB_CLASS_COUNT] = {
+    POOL(16), POOL(32), POOL(48), POOL(64), POOL(96), POOL(128), POOL(192),
+    POOL(256), POOL(384), POOL(512), POOL(768), POOL(1024), POOL(1536), POOL(2048),
+};
+
+/* ==================== Chunk Source ==================== */
+/*
+ * Chunks of every class come from one source: the chunks released by
+ * slab_release_empty() first, then the rest of the current region, then
+ * a new region. Regions are never unmapped. They are one huge page
+ * each, so with MEMORADB_HUGEPAGES set a region costs a single TLB
+ * entry (see hugePages.h).
+ */
+
+static pthread_mutex_t source_lock = PTHREAD_MUTEX_INITIALIZER;
+static SlabChunk *released_chunks;     // pages returned to the OS, header page kept
+static char *region_pos;
+static char *region_end;
+static unsigned long long released_total;
+
+static SlabChunk *chunk_acquire(void) {
+    pthread_mutex_lock(&source_lock);
+    SlabChunk *chunk = released_chunks;
+    if (chunk) {
+        released_chunks = chunk->next;
+    } else {
+        if (region_pos == region_end) {
+            region_pos = huge_map(SLAB_REGION_SIZE);
+            region_end = region_pos ? region_pos + SLAB_REGION_SIZE : NULL;
+        }
+        if (region_pos) {
+            chunk = (SlabChunk *)region_pos;
+            region_pos += SLAB_CHUNK_SIZE;
+        }
+    }
+    pthread_mutex_unlock(&source_lock);
+    return chunk;
+}
+
+static void chunk_release(SlabChunk *chunk) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    madvise((char *)chunk + page, SLAB_CHUNK_SIZE - page, MADV_DONTNEED);
+    pthread_mutex_lock(&source_lock);
+    chunk->next = released_chunks;
+    released_chunks = chunk;
+    released_total++;
+    pthread_mutex_unlock(&source_lock);
+}
+
+static inline SlabChunk *chunk_of(const void *ptr) {
+    return (SlabChunk *)((uintptr_t)ptr & ~(uintptr_t)(SLAB_CHUNK_SIZE - 1));
+}
+
+static inline size_t chunk_capacity(const SlabPool *pool) {
+    return (SLAB_CHUNK_SIZE - SLAB_LINE) / pool->size;
+}
+
+int slab_class_for(size_t size) {
+    if (size == 0 || size > SLAB_MAX_SIZE) return -1;
+    if (size <= 64) return (int)((size + 15) / 16) - 1;
+    int cls = 4;
+    while (pools[cls].size < size) cls++;
+    return cls;
+}
+
+size_t slab_class_size(int cls) {
+    return pools[cls].size;
+}
+
+static void publish(SlabPool *pool, SlabCache *cache) {
+    if (cache->pending_allocs) {
+        __atomic_fetch_add(&pool->allocs, cache->pending_allocs, __ATOMIC_RELAXED);
+        cache->pending_allocs = 0;
+    }
+    if (cache->pending_frees) {
+        __atomic_fetch_add(&pool->frees, cache->pending_frees, __ATOMIC_RELAXED);
+        cache->pending_frees = 0;
+    }
+}
+
+static __thread SlabCache caches[SLAB_CLASS_COUNT];
+static __thread int cache_registered;
+static pthread_key_t exit_key;
+static pthread_once_t exit_once = PTHREAD_ONCE_INIT;
+
+static void thread_exit(void *arg) {
+    (void)arg;
+    cache_registered = 0;
+    slab_thread_flush();
+}
+
+static void make_exit_key(void) {
+    pthread_key_create(&exit_key, thread_exit);
+}
+
+/*
+ * The key's destructor hands the cache back when the thread exits. Other
+ * destructors (the epoch reclaimer's) may free objects after it ran, so
+ * every use re-arms it; pthreads then calls it again.
+ */
+static inline void register_cache(void) {
+    if (cache_registered) return;
+    pthread_once(&exit_once, make_exit_key);
+    pthread_setspecific(exit_key, (void *)1);
+    cache_registered = 1;
+}
+
+/* ==================== Pool Internals ==================== */
+/* Everything here runs with pool->lock held. */
+
+static void partial_push(SlabPool *pool, SlabChunk *chunk) {
+    chunk->prev = NULL;
+    chunk->next = pool->partial;
+    if (pool->partial) pool->partial->prev = chunk;
+    pool->partial = chunk;
+}
+
+static void partial_unlink(SlabPool *pool, SlabChunk *chunk) {
+    if (chunk->prev) {
+        chunk->prev->next = chunk->next;
+    } else {
+        pool->partial = chunk->next;
+    }
+    if (chunk->next) chunk->next->prev = chunk->prev;
+}
+
+static int carve_chunk(SlabPool *pool) {
+    SlabChunk *chunk = chunk_acquire();
+    if (!chunk) return -1;
+    memset(chunk, 0, sizeof(*chunk));
+    pool->carving = chunk;
+    pool->carve_pos = (char *)chunk + SLAB_LINE;
+    pool->carve_end = pool->carve_pos + chunk_capacity(pool) * pool->size;
+    pool->chunks++;
+    pool->objects_total += chunk_capacity(pool);
+    return 0;
+}
+
+//-- One object: from the first partial chunk, else fresh chunk space --//
+static FreeObj *take_object(SlabPool *pool) {
+    SlabChunk *chunk = pool->partial;
+    if (chunk) {
+        FreeObj *obj = chunk->free;
+        chunk->free = obj->next;
+        if (--chunk->nfree == 0) partial_unlink(pool, chunk);
+        pool->pooled--;
+        return obj;
+    }
+    if (pool->carve_pos == pool->carve_end && carve_chunk(pool) != 0) return NULL;
+    FreeObj *obj = (FreeObj *)pool->carve_pos;
+    pool->carve_pos += pool->size;
+    pool->carving->carved++;
+    pool->carved++;
+    return obj;
+}
+
+static void return_object(SlabPool *pool, FreeObj *obj) {
+    SlabChunk *chunk = chunk_of(obj);
+    obj->next = chunk->free;
+    chunk->free = obj;
+    if (chunk->nfree++ == 0) partial_push(pool, chunk);
+    pool->pooled++;
+}
+
+//-- Move up to SLAB_BATCH objects into the cache --//
+static void refill(SlabPool *pool, SlabCache *cache) {
+    pthread_mutex_lock(&pool->lock);
+    size_t moved = 0;
+    while (moved < SLAB_BATCH) {
+        FreeObj *obj = take_object(pool);
+        if (!obj) break;
+        obj->next = cache->head;
+        cache->head = obj;
+        moved++;
+    }
+    pthread_mutex_unlock(&pool->lock);
+    cache->count += moved;
+    publish(pool, cache);
+}
+
+//-- Hand n cached objects back to their chunks --//
+static void spill(SlabPool *pool, SlabCache *cache, size_t n) {
+    if (n == 0) return;
+    cache->count -= n;
+    pthread_mutex_lock(&pool->lock);
+    for (size_t i = 0; i < n; i++) {
+        FreeObj *obj = cache->head;
+        cache->head = obj->next;
+        return_object(pool, obj);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    publish(pool, cache);
+}
+
+void *slab_alloc(int cls) {
+    SlabPool *pool = &pools[cls];
+    SlabCache *cache = &caches[cls];
+    register_cache();
+    if (!cache->head) {
+        refill(pool, cache);
+        if (!cache->head) return NULL;
+    }
+    FreeObj *obj = cache->head;
+    cache->head = obj->next;
+    cache->count--;
+    if (++cache->pending_allocs >= SLAB_BATCH) publish(pool, cache);
+    return obj;
+}
+
+void slab_free(int cls, void *ptr) {
+    if (!ptr) return;
+    SlabPool *pool = &pools[cls];
+    SlabCache *cache = &caches[cls];
+    register_cache();
+    FreeObj *obj = ptr;
+    obj->next = cache->head;
+    cache->head = obj;
+    cache->count++;
+    cache->pending_frees++;
+    if (cache->count > 2 * SLAB_BATCH) {
+        spill(pool, cache, SLAB_BATCH);
+    } else if (cache->pending_frees >= SLAB_BATCH) {
+        publish(pool, cache);
+    }
+}
+
+void slab_thread_flush(void) {
+    for (int cls = 0; cls < SLAB_CLASS_COUNT; cls++) {
+        SlabPool *pool = &pools[cls];
+        SlabCache *cache = &caches[cls];
+        spill(pool, cache, cache->count);
+        publish(pool, cache);
+    }
+}
+
+void slab_thread_publish(void) {
+    for (int cls = 0; cls < SLAB_CLASS_COUNT; cls++) {
+        publish(&pools[cls], &caches[cls]);
+    }
+}
+/* ==================== Defragmentation ==================== */
+
+void *slab_alloc_direct(int cls) {
+    SlabPool *pool = &pools[cls];
+    pthread_mutex_lock(&pool->lock);
+    FreeObj *obj = take_object(pool);
+    pthread_mutex_unlock(&pool->lock);
+    if (obj) __atomic_fetch_add(&pool->allocs, 1, __ATOMIC_RELAXED);
+    return obj;
+}
+
+void slab_free_direct(int cls, void *ptr) {
+    if (!ptr) return;
+    SlabPool *pool = &pools[cls];
+    pthread_mutex_lock(&pool->lock);
+    return_object(pool, ptr);
+    pthread_mutex_unlock(&pool->lock);
+    __atomic_fetch_add(&pool->frees, 1, __ATOMIC_RELAXED);
+}
+
+int slab_should_move(int cls, const void *ptr) {
+    SlabPool *pool = &pools[cls];
+    SlabChunk *chunk = chunk_of(ptr);
+    pthread_mutex_lock(&pool->lock);
+    //-- Never leave the chunk that allocations are served from next --//
+    int move = chunk->evacuate && chunk != pool->partial && chunk != pool->carving;
+    pthread_mutex_unlock(&pool->lock);
+    return move;
+}
+
+static int fuller_first(const void *a, const void *b) {
+    const SlabChunk *x = *(SlabChunk *const *)a;
+    const SlabChunk *y = *(SlabChunk *const *)b;
+    unsigned int lx = x->carved - x->nfree;
+    unsigned int ly = y->carved - y->nfree;
+    return (lx < ly) - (lx > ly);
+}
+
+/*
+ * Every live object of the class would fit in ceil(live / capacity)
+ * chunks. Full chunks and the fullest partial ones make up that many;
+ * the rest are marked for evacuation. Objects sitting in thread caches
+ * count as live, so the plan errs towards keeping chunks.
+ */
+void slab_plan_defrag(int cls) {
+    SlabPool *pool = &pools[cls];
+    pthread_mutex_lock(&pool->lock);
+    size_t n = 0;
+    for (SlabChunk *c = pool->partial; c; c = c->next) n++;
+    SlabChunk **order = n > 1 ? malloc(n * sizeof(*order)) : NULL;
+    if (order) {
+        n = 0;
+        for (SlabChunk *c = pool->partial; c; c = c->next) order[n++] = c;
+        qsort(order, n, sizeof(*order), fuller_first);
+
+        size_t capacity = chunk_capacity(pool);
+        size_t needed = (pool->carved - pool->pooled + capacity - 1) / capacity;
+        size_t full = pool->chunks - n;
+        size_t keep = needed > full ? needed - full : 0;
+        pool->partial = NULL;
+        for (size_t i = n; i-- > 0;) {
+            order[i]->evacuate = i >= keep;
+            partial_push(pool, order[i]);
+        }
+        free(order);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+size_t slab_release_empty(int cls) {
+    SlabPool *pool = &pools[cls];
+    SlabChunk *empty = NULL;
+    size_t released = 0;
+    pthread_mutex_lock(&pool->lock);
+    SlabChunk *chunk = pool->partial;
+    while (chunk) {
+        SlabChunk *next = chunk->next;
+        if (chunk->nfree == chunk->carved && chunk != pool->carving) {
+            partial_unlink(pool, chunk);
+            pool->pooled -= chunk->nfree;
+            pool->carved -= chunk->carved;
+            pool->chunks--;
+            pool->objects_total -= chunk_capacity(pool);
+            chunk->next = empty;
+            empty = chunk;
+            released++;
+        }
+        chunk = next;
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    //-- madvise outside the pool lock --//
+    while (empty) {
+        SlabChunk *next = empty->next;
+        chunk_release(empty);
+        empty = next;
+    }
+    return released;
+}
+
+unsigned long long slab_released_chunks(void) {
+    pthread_mutex_lock(&source_lock);
+    unsigned long long total = released_total;
+    pthread_mutex_unlock(&source_lock);
+    return total;
+}
+
+void slab_stats(int cls, SlabStats *out) {
+    SlabPool *pool = &pools[cls];
+    pthread_mutex_lock(&pool->lock);
+    out->chunks = pool->chunks;
+    out->objects_total = pool->objects_total;
+    pthread_mutex_unlock(&pool->lock);
+    out->object_size = pool->size;
+    out->allocs = __atomic_load_n(&pool->allocs, __ATOMIC_RELAXED);
+    out->frees = __atomic_load_n(&pool->frees, __ATOMIC_RELAXED);
+    //-- Counters are published per thread, so frees can briefly run ahead --//
+    out->objects_in_use = out->allocs > out->frees ? (size_t)(out->allocs - out->frees) : 0;
+}
+
+size_t slab_reserved_bytes(void) {
+    size_t chunks = 0;
+    for (int cls = 0; cls < SLAB_CLASS_COUNT; cls++) {
+        pthread_mutex_lock(&pools[cls].lock);
+        chunks += pools[cls].chunks;
+        pthread_mutex_unlock(&pools[cls].lock);
+    }
+    return chunks * SLAB_CHUNK_SIZE;
+}
@@ -0,0 +1,148 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/slab.h
+ * Module                    : Slab Allocator
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for the size-class object pools behind the storage allocator
+ *  (memAlloc.h). Each thread allocates from its own cache and only
+ *  touches the shared pool to move objects in batches.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef SLAB_H
+#define SLAB_H
+
+#include <stddef.h>
+
+#define SLAB_CHUNK_SIZE  (64 * 1024)   //- bytes carved into objects at a time, aligned to their size -//
+#define SLAB_REGION_SIZE (2 * 1024 * 1024)  //- chunks are cut from mappings this big -//
+#define SLAB_BATCH       64            //- objects moved between a thread cache and its pool -//
+#define SLAB_MAX_SIZE    2048          //- larger requests bypass the pools -//
+#define SLAB_CLASS_COUNT 14
+
+typedef struct SlabStats {
+    size_t object_size;                //- bytes per object in this class -//
+    size_t chunks;                     //- SLAB_CHUNK_SIZE chunks reserved -//
+    size_t objects_total;              //- objects carved out of those chunks -//
+    size_t objects_in_use;             //- handed out and not freed -//
+    unsigned long long allocs;
+    unsigned long long frees;
+} SlabStats;
+
+/**
+ * @brief Smallest class whose objects hold size bytes.
+ *
+ * Classes are 16, 32, 48, 64, 96, 128, ... 2048 bytes; every object is
+ * 16-byte aligned and those of 16, 32 and 64 bytes never straddle a
+ * cache line.
+ *
+ * @return The class, or -1 if size is 0 or above SLAB_MAX_SIZE.
+ */
+int slab_class_for(size_t size);
+
+/**
+ * @brief Object size of a class.
+ */
+size_t slab_class_size(int cls);
+
+/**
+ * @brief Allocate one object of the class.
+ *
+ * Served from the calling thread's cache; refilled from the pool's
+ * chunks, or a new chunk, SLAB_BATCH objects at a time.
+ *
+ * @return The object, or NULL when out of memory.
+ */
+void *slab_alloc(int cls);
+
+/**
+ * @brief Return an object to the calling thread's cache.
+ *
+ * Any thread may free any object; a cache that grows past two batches
+ * hands one back to the pool.
+ */
+void slab_free(int cls, void *ptr);
+
+/**
+ * @brief Hand the calling thread's cached objects back and publish its counters.
+ *
+ * Runs automatically when a thread exits.
+ */
+void slab_thread_flush(void);
+
+/**
+ * @brief Add the calling thread's pending alloc/free counts to the pool totals.
+ *
+ * Cheap enough to call once per command; does nothing when idle.
+ */
+void slab_thread_publish(void);
+
+/**
+ * @brief Snapshot a class's usage.
+ *
+ * Each thread publishes its counters every SLAB_BATCH operations and on
+ * slab_thread_publish(), so allocs, frees and objects_in_use may lag.
+ */
+void slab_stats(int cls, SlabStats *out);
+
+/**
+ * @brief Bytes reserved in chunks across all classes.
+ *
+ * Chunks released by slab_release_empty() are not counted.
+ */
+size_t slab_reserved_bytes(void);
+
+/* ==================== Defragmentation ==================== */
+
+/**
+ * @brief Allocate one object straight from the pool, bypassing the thread cache.
+ *
+ * Served from the first chunk with free objects, which is the fullest
+ * one after slab_plan_defrag(), so moved objects pack densely.
+ */
+void *slab_alloc_direct(int cls);
+
+/**
+ * @brief Return an object straight to its chunk, bypassing the thread cache.
+ */
+void slab_free_direct(int cls, void *ptr);
+
+/**
+ * @brief Whether the object sits in a chunk marked for evacuation.
+ */
+int slab_should_move(int cls, const void *ptr);
+
+/**
+ * @brief Plan a defrag pass over a class.
+ *
+ * Orders the chunks with free objects fullest first, so direct
+ * allocations fill them, and marks the emptiest ones (those not needed
+ * to hold the class's live objects) for evacuation.
+ */
+void slab_plan_defrag(int cls);
+
+/**
+ * @brief Return the pages of chunks with no live object to the OS.
+ *
+ * Objects still sitting in thread caches keep their chunk alive. The
+ * address range is kept and reused before any new mapping.
+ *
+ * @return Number of chunks released.
+ */
+size_t slab_release_empty(int cls);
+
+/**
+ * @brief Chunks released over the life of the process.
+ */
+unsigned long long slab_released_chunks(void);
+
+#endif // SLAB_H
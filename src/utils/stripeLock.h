@@ -0,0 +1,70 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/stripeLock.h
+ * Module                    : Lock Striping
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for cache-line-padded lock stripes. Each stripe spins briefly
+ *  before parking and counts how often it was contended.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef STRIPELOCK_H
+#define STRIPELOCK_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define STRIPE_CACHE_LINE 64
+#define STRIPE_SPIN_LIMIT 128    //- trylock attempts before blocking -//
+
+/* ==================== Stripe Struct ==================== */
+/*
+ * One stripe per cache line so that threads locking unrelated stripes
+ * never bounce each other's lines.
+ */
+typedef struct StripeLock {
+    pthread_mutex_t mutex;
+    uint64_t acquisitions;   //- total lock calls -//
+    uint64_t contended;      //- first trylock failed -//
+    uint64_t parked;         //- spinning gave up and the thread blocked -//
+} __attribute__((aligned(STRIPE_CACHE_LINE))) StripeLock;
+
+typedef struct StripeStats {
+    uint64_t acquisitions;
+    uint64_t contended;
+    uint64_t parked;
+} StripeStats;
+
+/**
+ * @brief Initialize a stripe and zero its counters.
+ */
+void stripe_lock_init(StripeLock *lock);
+
+/**
+ * @brief Acquire the stripe, spinning up to STRIPE_SPIN_LIMIT times before parking.
+ */
+void stripe_lock_acquire(StripeLock *lock);
+
+/**
+ * @brief Release the stripe.
+ */
+static inline void stripe_lock_release(StripeLock *lock) {
+    pthread_mutex_unlock(&lock->mutex);
+}
+
+/**
+ * @brief Snapshot a stripe's counters (may be slightly stale).
+ */
+void stripe_lock_stats(const StripeLock *lock, StripeStats *out);
+
+#endif // STRIPELOCK_H
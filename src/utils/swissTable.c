@@ -0,0 +1,296 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/swissTable.c
+ * Module                    : Swiss Table
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of the open-addressing (Swiss-table style) keyspace
+ *  index used when MemoraDB is built with INDEX=swiss.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include "swissTable.h"
+#include "hashTable.h"
+#include "epoch.h"
+#include "memAlloc.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/*
+ * Swiss Table Implementation
+ *
+ * The 64-bit key hash is split in two: H1 (the bits above the outer
+ * bucket index) picks the starting group and H2 (the top 7 bits) is
+ * stored in the slot's control byte. A lookup
+ * compares H2 against a whole 16-byte group of control bytes at once and
+ * only dereferences the Entry pointers whose tag matched, so a miss
+ * usually costs one cache line of metadata and zero key comparisons.
+ *
+ * Groups are probed with triangular steps, which visits every group
+ * exactly once for power-of-two group counts. A probe ends at the first
+ * group that still has an EMPTY byte.
+ *
+ * Writers hold the bucket lock. Readers may run concurrently: a slot
+ * pointer is published before its control byte and cleared after it, so
+ * a reader that matches a tag sees either a valid Entry or NULL.
+ */
+
+#define H1(h) ((size_t)((h) >> SWISS_H1_SHIFT))
+#define H2(h) ((int8_t)((h) >> 57))
+
+_Static_assert(TABLE_SIZE <= (1u << SWISS_H1_SHIFT), "H1 must not reuse the bucket index bits");
+
+#define SWISS_MIN_CAPACITY SWISS_GROUP_WIDTH
+
+/* ==================== Group Matching ==================== */
+
+static inline uint32_t group_match(const int8_t *group, int8_t tag) {
+#ifdef __SSE2__
+    __m128i ctrl = _mm_load_si128((const __m128i *)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(tag)));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < SWISS_GROUP_WIDTH; i++) {
+        if (group[i] == tag) mask |= 1u << i;
+    }
+    return mask;
+#endif
+}
+
+//-- EMPTY and DELETED are the only negative control bytes --//
+static inline uint32_t group_match_free(const int8_t *group) {
+#ifdef __SSE2__
+    return (uint32_t)_mm_movemask_epi8(_mm_load_si128((const __m128i *)group));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < SWISS_GROUP_WIDTH; i++) {
+        if (group[i] < 0) mask |= 1u << i;
+    }
+    return mask;
+#endif
+}
+
+static inline size_t group_count(const SwissArrays *arr) {
+    return arr->capacity / SWISS_GROUP_WIDTH;
+}
+
+static inline SwissArrays *load_arrays(const SwissTable *t) {
+    return __atomic_load_n(&t->arr, __ATOMIC_ACQUIRE);
+}
+
+static inline struct Entry *load_slot(const SwissArrays *arr, size_t i) {
+    return __atomic_load_n(&arr->slots[i], __ATOMIC_ACQUIRE);
+}
+
+/* ==================== Allocation ==================== */
+
+static inline size_t arrays_bytes(size_t capacity) {
+    return sizeof(SwissArrays) + capacity + capacity * sizeof(struct Entry *);
+}
+
+static SwissArrays *alloc_arrays(size_t capacity) {
+    //-- mem_alloc is 16-byte aligned and the header is 16 bytes, so ctrl[] is too --//
+    SwissArrays *arr = mem_alloc(arrays_bytes(capacity));
+    if (!arr) return NULL;
+    arr->capacity = capacity;
+    arr->slots = (struct Entry **)(arr->ctrl + capacity);
+    memset(arr->ctrl, (unsigned char)SWISS_CTRL_EMPTY, capacity);
+    memset(arr->slots, 0, capacity * sizeof(struct Entry *));
+    return arr;
+}
+
+//-- Place an entry in the first free slot of its probe sequence (no growth check) --//
+static void place(SwissTable *t, SwissArrays *arr, struct Entry *entry, uint64_t h) {
+    size_t mask = group_count(arr) - 1;
+    size_t g = H1(h) & mask;
+
+    for (size_t step = 1; ; step++) {
+        int8_t *group = arr->ctrl + g * SWISS_GROUP_WIDTH;
+        uint32_t free_mask = group_match_free(group);
+        if (free_mask) {
+            size_t i = g * SWISS_GROUP_WIDTH + (size_t)__builtin_ctz(free_mask);
+            if (arr->ctrl[i] == SWISS_CTRL_DELETED) t->tombstones--;
+            __atomic_store_n(&arr->slots[i], entry, __ATOMIC_RELEASE);
+            __atomic_store_n(&arr->ctrl[i], H2(h), __ATOMIC_RELEASE);
+            t->size++;
+            return;
+        }
+        g = (g + step) & mask;
+    }
+}
+
+static int resize(SwissTable *t, size_t capacity) {
+    SwissArrays *old = t->arr;
+    SwissArrays *arr = alloc_arrays(capacity);
+    if (!arr) return -1;
+
+    t->size = 0;
+    t->tombstones = 0;
+    for (size_t i = 0; old && i < old->capacity; i++) {
+        if (old->ctrl[i] >= 0) {
+            struct Entry *e = old->slots[i];
+            place(t, arr, e, e->hash);
+        }
+    }
+
+    //-- Readers still probing the old arrays keep a consistent snapshot --//
+    __atomic_store_n(&t->arr, arr, __ATOMIC_RELEASE);
+    epoch_retire(old, swiss_free_arrays);
+    return 0;
+}
+
+//-- Slot index holding exactly this entry pointer, or SIZE_MAX --//
+static size_t find_slot(const SwissArrays *arr, const struct Entry *entry, uint64_t h) {
+    if (!arr) return SIZE_MAX;
+
+    size_t mask = group_count(arr) - 1;
+    size_t g = H1(h) & mask;
+    int8_t tag = H2(h);
+
+    for (size_t step = 1; step <= mask + 1; step++) {
+        const int8_t *group = arr->ctrl + g * SWISS_GROUP_WIDTH;
+        uint32_t hits = group_match(group, tag);
+        while (hits) {
+            size_t i = g * SWISS_GROUP_WIDTH + (size_t)__builtin_ctz(hits);
+            if (arr->slots[i] == entry) {
+                return i;
+            }
+            hits &= hits - 1;
+        }
+        if (group_match(group, SWISS_CTRL_EMPTY)) {
+            return SIZE_MAX;
+        }
+        g = (g + step) & mask;
+    }
+    return SIZE_MAX;
+}
+
+/* ==================== Public API ==================== */
+
+struct Entry *swiss_find(const SwissTable *t, const char *key, size_t len, uint64_t h) {
+    const SwissArrays *arr = load_arrays(t);
+    if (!arr) return NULL;
+
+    size_t mask = group_count(arr) - 1;
+    size_t g = H1(h) & mask;
+    int8_t tag = H2(h);
+
+    for (size_t step = 1; step <= mask + 1; step++) {
+        const int8_t *group = arr->ctrl + g * SWISS_GROUP_WIDTH;
+        uint32_t hits = group_match(group, tag);
+        while (hits) {
+            size_t i = g * SWISS_GROUP_WIDTH + (size_t)__builtin_ctz(hits);
+            struct Entry *e = load_slot(arr, i);
+            if (e && entry_key_equals(e, key, len, h)) {
+                return e;
+            }
+            hits &= hits - 1;
+        }
+        if (group_match(group, SWISS_CTRL_EMPTY)) {
+            return NULL;
+        }
+        g = (g + step) & mask;
+    }
+    return NULL;
+}
+
+int swiss_insert(SwissTable *t, struct Entry *entry, uint64_t h) {
+    size_t capacity = swiss_capacity(t);
+    if (capacity == 0) {
+        if (resize(t, SWISS_MIN_CAPACITY) != 0) return -1;
+    } else if ((t->size + t->tombstones + 1) * 8 > capacity * 7) {
+        //-- Mostly tombstones: rehash in place instead of doubling --//
+        if ((t->size + 1) * 8 > capacity * 4) capacity *= 2;
+        if (resize(t, capacity) != 0) return -1;
+    }
+
+    place(t, t->arr, entry, h);
+    return 0;
+}
+
+int swiss_remove(SwissTable *t, const struct Entry *entry, uint64_t h) {
+    SwissArrays *arr = t->arr;
+    size_t i = find_slot(arr, entry, h);
+    if (i == SIZE_MAX) return 0;
+
+    /*-- If this group still has an EMPTY byte no probe sequence
+         ever continued past it, so the slot can go back to EMPTY --*/
+    const int8_t *group = arr->ctrl + (i & ~(size_t)(SWISS_GROUP_WIDTH - 1));
+    if (group_match(group, SWISS_CTRL_EMPTY)) {
+        __atomic_store_n(&arr->ctrl[i], SWISS_CTRL_EMPTY, __ATOMIC_RELEASE);
+    } else {
+        __atomic_store_n(&arr->ctrl[i], SWISS_CTRL_DELETED, __ATOMIC_RELEASE);
+        t->tombstones++;
+    }
+    __atomic_store_n(&arr->slots[i], NULL, __ATOMIC_RELEASE);
+    t->size--;
+    return 1;
+}
+
+int swiss_replace(SwissTable *t, const struct Entry *old, struct Entry *entry, uint64_t h) {
+    SwissArrays *arr = t->arr;
+    size_t i = find_slot(arr, old, h);
+    if (i == SIZE_MAX) return 0;
+    __atomic_store_n(&arr->slots[i], entry, __ATOMIC_RELEASE);
+    return 1;
+}
+
+void swiss_prefetch(const SwissTable *t, uint64_t h) {
+    const SwissArrays *arr = load_arrays(t);
+    if (!arr) return;
+    size_t g = H1(h) & (group_count(arr) - 1);
+    __builtin_prefetch(arr->ctrl + g * SWISS_GROUP_WIDTH);
+    __builtin_prefetch(&arr->slots[g * SWISS_GROUP_WIDTH]);
+}
+
+void swiss_for_each(const SwissTable *t, void (*fn)(struct Entry *entry, void *ctx), void *ctx) {
+    const SwissArrays *arr = load_arrays(t);
+    if (!arr) return;
+    for (size_t i = 0; i < arr->capacity; i++) {
+        struct Entry *e = load_slot(arr, i);
+        if (e) fn(e, ctx);
+    }
+}
+
+struct Entry *swiss_sample(const SwissTable *t, size_t start) {
+    const SwissArrays *arr = load_arrays(t);
+    if (!arr) return NULL;
+    for (size_t n = 0; n < arr->capacity; n++) {
+        struct Entry *e = load_slot(arr, (start + n) & (arr->capacity - 1));
+        if (e) return e;
+    }
+    return NULL;
+}
+
+void swiss_free_arrays(void *ptr) {
+    SwissArrays *arr = ptr;
+    if (arr) mem_free(arr, arrays_bytes(arr->capacity));
+}
+
+SwissArrays *swiss_detach(SwissTable *t) {
+    SwissArrays *arr = t->arr;
+    __atomic_store_n(&t->arr, NULL, __ATOMIC_RELEASE);
+    t->size = 0;
+    t->tombstones = 0;
+    return arr;
+}
+
+void swiss_free(SwissTable *t) {
+    SwissArrays *arr = t->arr;
+    __atomic_store_n(&t->arr, NULL, __ATOMIC_RELEASE);
+    epoch_retire(arr, swiss_free_arrays);
+    t->size = 0;
+    t->tombstones = 0;
+}
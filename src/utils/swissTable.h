@@ -0,0 +1,174 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/swissTable.h
+ * Module                    : Swiss Table
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for the open-addressing (Swiss-table style) keyspace index.
+ *  Slots hold Entry pointers; a parallel array of one-byte control
+ *  tags is probed 16 slots at a time (SSE2 when available).
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef SWISSTABLE_H
+#define SWISSTABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct Entry;
+
+/* ==================== Hash Split ==================== */
+/*
+ * The outer table picks a bucket from the low bits of the hash, so all
+ * keys of one bucket share them; the starting group is taken from the
+ * bits above (H1), and the control byte from the top 7 bits (H2).
+ */
+#define SWISS_H1_SHIFT 10        //- log2 of the largest TABLE_SIZE the bits below cover -//
+
+/* ==================== Control Bytes ==================== */
+#define SWISS_GROUP_WIDTH 16
+#define SWISS_CTRL_EMPTY   ((int8_t)-128)  //- 0b10000000 -//
+#define SWISS_CTRL_DELETED ((int8_t)-2)    //- 0b11111110 -//
+
+/* ==================== Swiss Table Struct ==================== */
+/*
+ * Control bytes and slots live in one allocation that is replaced as a
+ * whole on growth, so a lock-free reader always sees a capacity, ctrl
+ * and slots that belong together. Replaced arrays are retired through
+ * the epoch reclaimer rather than freed.
+ */
+typedef struct SwissArrays {
+    size_t capacity;         //- power of two >= SWISS_GROUP_WIDTH -//
+    struct Entry **slots;    //- capacity entry pointers, after ctrl -//
+    int8_t ctrl[];           //- capacity control bytes (16-byte aligned), >= 0 means full -//
+} SwissArrays;
+
+typedef struct SwissTable {
+    SwissArrays *arr;        //- NULL until the first insert -//
+    size_t size;             //- live entries -//
+    size_t tombstones;       //- DELETED control bytes -//
+} SwissTable;
+
+/**
+ * @brief Look up a key.
+ *
+ * Safe without the bucket lock when called inside an epoch critical
+ * section (see epoch.h).
+ *
+ * @param t The table to search.
+ * @param key The key to find.
+ * @param len Length of key in bytes.
+ * @param h The full 64-bit hash of key (see hash_key()).
+ * @return The matching entry, or NULL if not present.
+ */
+struct Entry *swiss_find(const SwissTable *t, const char *key, size_t len, uint64_t h);
+
+/**
+ * @brief Insert an entry whose key is known not to be present.
+ *
+ * Grows (or rehashes in place to purge tombstones) when the load
+ * factor would exceed 7/8. Rehashing reuses entry->hash, so keys are
+ * never hashed again.
+ *
+ * @param t The table to insert into.
+ * @param entry The entry to link.
+ * @param h The full 64-bit hash of entry->key.
+ * @return 0 on success, -1 on allocation failure.
+ */
+int swiss_insert(SwissTable *t, struct Entry *entry, uint64_t h);
+
+/**
+ * @brief Remove an entry from the table (pointer identity).
+ *
+ * @param t The table to remove from.
+ * @param entry The entry to unlink.
+ * @param h The full 64-bit hash of entry->key.
+ * @return 1 if the entry was removed, 0 if it was not found.
+ */
+int swiss_remove(SwissTable *t, const struct Entry *entry, uint64_t h);
+
+/**
+ * @brief Swap the entry stored in a slot for another with the same key.
+ *
+ * @param t The table to update.
+ * @param old The entry currently linked.
+ * @param entry The entry taking its slot.
+ * @param h The full 64-bit hash shared by both entries.
+ * @return 1 if old was found and replaced, 0 otherwise.
+ */
+int swiss_replace(SwissTable *t, const struct Entry *old, struct Entry *entry, uint64_t h);
+
+/**
+ * @brief Prefetch the control group a lookup of h will probe first.
+ *
+ * Safe to call lock-free inside an epoch; it never faults.
+ */
+void swiss_prefetch(const SwissTable *t, uint64_t h);
+
+/**
+ * @brief Call fn on every entry in the table.
+ *
+ * Walks one consistent snapshot of the arrays, so it is safe without
+ * the bucket lock inside an epoch critical section.
+ *
+ * @param t The table to walk.
+ * @param fn Called once per entry.
+ * @param ctx Passed through to fn.
+ */
+void swiss_for_each(const SwissTable *t, void (*fn)(struct Entry *entry, void *ctx), void *ctx);
+
+/**
+ * @brief The first entry at or after slot start (wrapping), for sampling.
+ *
+ * With the load factor capped at 7/8 this is a few slot loads on
+ * average. Safe without the bucket lock inside an epoch.
+ *
+ * @param t The table to sample.
+ * @param start Any number; reduced modulo the capacity.
+ * @return An entry, or NULL if the table is empty.
+ */
+struct Entry *swiss_sample(const SwissTable *t, size_t start);
+
+/**
+ * @brief Retire the control and slot arrays (entries are not freed).
+ *
+ * @param t The table to reset to its empty state.
+ */
+void swiss_free(SwissTable *t);
+
+/**
+ * @brief Reset the table to empty and hand its arrays to the caller.
+ *
+ * Readers inside an epoch may still be probing the returned arrays, so
+ * the caller must retire them (and the entries in their full slots)
+ * through the epoch reclaimer.
+ *
+ * @param t The table to empty.
+ * @return The detached arrays, or NULL if the table never allocated any.
+ */
+SwissArrays *swiss_detach(SwissTable *t);
+
+/**
+ * @brief Free arrays that are no longer reachable (entries are not freed).
+ *
+ * Takes a void pointer so it can be passed to epoch_retire().
+ */
+void swiss_free_arrays(void *arr);
+
+/**
+ * @brief Number of slots currently allocated.
+ */
+static inline size_t swiss_capacity(const SwissTable *t) {
+    return t->arr ? t->arr->capacity : 0;
+}
+
+#endif // SWISSTABLE_H
@@ -0,0 +1,132 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/timerWheel.c
+ * Module                    : Timing Wheel
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Implementation of the hierarchical timing wheel.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include "timerWheel.h"
+
+/*
+ * A node goes into the lowest level whose span covers its distance from
+ * the next tick to be processed. When the tick counter crosses a
+ * multiple of 64^L, the level-L slot for that range is emptied and its
+ * nodes are placed again, now on a finer level (the cascade). A node is
+ * therefore moved at most WHEEL_LEVELS - 1 times before it fires.
+ */
+
+#define SLOT_MASK (WHEEL_SLOTS - 1)
+#define LEVEL_SHIFT(l) ((l) * WHEEL_SLOT_BITS)
+#define WHEEL_RANGE (1LL << (WHEEL_LEVELS * WHEEL_SLOT_BITS))
+
+void wheel_init(TimerWheel *w, long long now) {
+    w->now = now;
+    w->count = 0;
+    for (int l = 0; l < WHEEL_LEVELS; l++) {
+        for (int s = 0; s < WHEEL_SLOTS; s++) {
+            w->slots[l][s] = 0;
+        }
+    }
+}
+
+static void link_node(WheelNode **head, WheelNode *node) {
+    node->next = *head;
+    if (node->next) node->next->pprev = &node->next;
+    node->pprev = head;
+    *head = node;
+}
+
+//-- Place relative to base, the first tick that has not been processed yet --//
+static void place(TimerWheel *w, WheelNode *node, long long base) {
+    long long expires = node->deadline < base ? base : node->deadline;
+    long long delta = expires - base;
+    if (delta >= WHEEL_RANGE) {
+        expires = base + WHEEL_RANGE - 1;
+        delta = WHEEL_RANGE - 1;
+    }
+
+    int level = 0;
+    while (level < WHEEL_LEVELS - 1 && delta >= (1LL << LEVEL_SHIFT(level + 1))) {
+        level++;
+    }
+    link_node(&w->slots[level][(expires >> LEVEL_SHIFT(level)) & SLOT_MASK], node);
+}
+
+void wheel_add(TimerWheel *w, WheelNode *node, long long deadline) {
+    //-- Owners may read the deadline without the wheel's lock --//
+    __atomic_store_n(&node->deadline, deadline, __ATOMIC_RELAXED);
+    place(w, node, w->now + 1);
+    w->count++;
+}
+
+void wheel_remove(TimerWheel *w, WheelNode *node) {
+    if (!node->pprev) return;
+    *node->pprev = node->next;
+    if (node->next) node->next->pprev = node->pprev;
+    node->next = 0;
+    node->pprev = 0;
+    w->count--;
+}
+
+void wheel_update(TimerWheel *w, WheelNode *node, long long deadline) {
+    wheel_remove(w, node);
+    wheel_add(w, node, deadline);
+}
+
+//-- Detach a slot's list; the nodes keep stale links until placed or fired --//
+static WheelNode *take_slot(WheelNode **head) {
+    WheelNode *list = *head;
+    *head = 0;
+    return list;
+}
+
+static void cascade(TimerWheel *w, int level, long long tick) {
+    WheelNode *node = take_slot(&w->slots[level][(tick >> LEVEL_SHIFT(level)) & SLOT_MASK]);
+    while (node) {
+        WheelNode *next = node->next;
+        place(w, node, tick);
+        node = next;
+    }
+}
+
+size_t wheel_advance(TimerWheel *w, long long now, void (*fire)(WheelNode *node, void *ctx), void *ctx) {
+    size_t fired = 0;
+    if (w->count == 0) {
+        //-- Nothing scheduled: the clock can jump --//
+        if (now > w->now) w->now = now;
+        return 0;
+    }
+
+    while (w->now < now && w->count > 0) {
+        long long tick = w->now + 1;
+        for (int l = 1; l < WHEEL_LEVELS; l++) {
+            if (tick & ((1LL << LEVEL_SHIFT(l)) - 1)) break;
+            cascade(w, l, tick);
+        }
+
+        WheelNode *node = take_slot(&w->slots[0][tick & SLOT_MASK]);
+        w->now = tick;
+        while (node) {
+            WheelNode *next = node->next;
+            node->next = 0;
+            node->pprev = 0;
+            w->count--;
+            fired++;
+            fire(node, ctx);
+            node = next;
+        }
+    }
+    if (now > w->now) w->now = now;
+    return fired;
+}
@@ -0,0 +1,96 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : src/utils/timerWheel.h
+ * Module                    : Timing Wheel
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Header for a hierarchical timing wheel with millisecond ticks and
+ *  intrusive nodes: O(1) insert, remove and reschedule, and amortized
+ *  O(1) expiry per node.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <stddef.h>
+
+/* ==================== Geometry ==================== */
+/*
+ * Level L has WHEEL_SLOTS slots of 64^L ms each, so four levels cover
+ * 2^24 ms (about 4.6 hours) ahead of the current tick. Later deadlines
+ * wait in the last slot of the top level and are placed again when it
+ * cascades.
+ */
+#define WHEEL_LEVELS 4
+#define WHEEL_SLOT_BITS 6
+#define WHEEL_SLOTS (1 << WHEEL_SLOT_BITS)
+
+/* ==================== Structs ==================== */
+/*
+ * Embedded in the object being timed. pprev points at whichever link
+ * points to this node, so removal never has to find the slot.
+ */
+typedef struct WheelNode {
+    struct WheelNode *next;
+    struct WheelNode **pprev;   //- NULL while not scheduled -//
+    long long deadline;         //- ms, same clock as the ticks; stored atomically -//
+} WheelNode;
+
+typedef struct TimerWheel {
+    long long now;              //- last tick processed -//
+    size_t count;               //- scheduled nodes -//
+    WheelNode *slots[WHEEL_LEVELS][WHEEL_SLOTS];
+} TimerWheel;
+
+/**
+ * @brief Initialize an empty wheel whose clock starts at now.
+ */
+void wheel_init(TimerWheel *w, long long now);
+
+/**
+ * @brief Schedule a node; deadlines already passed fire on the next tick.
+ *
+ * @param w The wheel.
+ * @param node A node that is not scheduled.
+ * @param deadline When it is due, in ms.
+ */
+void wheel_add(TimerWheel *w, WheelNode *node, long long deadline);
+
+/**
+ * @brief Unschedule a node. Does nothing if it is not scheduled.
+ */
+void wheel_remove(TimerWheel *w, WheelNode *node);
+
+/**
+ * @brief Move a node (scheduled or not) to a new deadline.
+ */
+void wheel_update(TimerWheel *w, WheelNode *node, long long deadline);
+
+static inline int wheel_scheduled(const WheelNode *node) {
+    return node->pprev != NULL;
+}
+
+/**
+ * @brief Process every tick up to now, firing the nodes that come due.
+ *
+ * Each node is unscheduled before fire() is called, so fire() may free
+ * it or schedule it again.
+ *
+ * @param w The wheel.
+ * @param now The current time in ms.
+ * @param fire Called once per due node.
+ * @param ctx Passed through to fire.
+ * @return Number of nodes fired.
+ */
+size_t wheel_advance(TimerWheel *w, long long now, void (*fire)(WheelNode *node, void *ctx), void *ctx);
+
+#endif // TIMERWHEEL_H
@@ -0,0 +1,105 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_arena.c
+ * Module                    : Scratch Arena Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit tests for the per-connection bump arena: alignment, block
+ *  reuse across resets, oversized requests and the retain limit.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include "../src/utils/arena.h"
+#include "test_framework.h"
+
+void test_alignment_and_copies() {
+    printf("Testing arena alignment and string copies...\n");
+
+    Arena arena;
+    arena_init(&arena);
+    TEST_ASSERT(arena.first == NULL && arena.retained == 0, "A fresh arena should hold no blocks");
+
+    int aligned = 1;
+    for (size_t size = 1; size < 100; size++) {
+        void *p = arena_alloc(&arena, size);
+        if (!p || ((uintptr_t)p & 15) != 0) aligned = 0;
+    }
+    TEST_ASSERT(aligned, "Every allocation should be 16-byte aligned");
+    TEST_ASSERT(arena.first != NULL && arena.first->next == NULL, "Small allocations should share one block");
+
+    char *copy = arena_strndup(&arena, "hello world", 5);
+    TEST_ASSERT(copy && strcmp(copy, "hello") == 0, "arena_strndup should copy and terminate");
+
+    arena_destroy(&arena);
+    TEST_ASSERT(arena.first == NULL && arena.retained == 0, "Destroy should release every block");
+    TEST_SUCCESS("Arena alignment test passed");
+}
+
+void test_reuse_after_reset() {
+    printf("Testing arena block reuse across resets...\n");
+
+    Arena arena;
+    arena_init(&arena);
+    //-- Spill into a second block, then replay the same pattern --//
+    for (int i = 0; i < 3; i++) arena_alloc(&arena, ARENA_BLOCK_SIZE / 2);
+    ArenaBlock *first = arena.first;
+    ArenaBlock *second = first->next;
+    size_t retained = arena.retained;
+    TEST_ASSERT(second != NULL, "Overflowing a block should chain a new one");
+
+    arena_reset(&arena);
+    TEST_ASSERT(arena.current == first && arena.used == 0, "Reset should rewind to the first block");
+    void *p = arena_alloc(&arena, 64);
+    TEST_ASSERT(p == first->data, "The first allocation after reset should reuse the first block");
+    for (int i = 0; i < 2; i++) arena_alloc(&arena, ARENA_BLOCK_SIZE / 2);
+    TEST_ASSERT(arena.current == second && arena.retained == retained, "Replaying the pattern should not allocate new blocks");
+
+    arena_destroy(&arena);
+    TEST_SUCCESS("Arena reuse test passed");
+}
+
+void test_large_and_trim() {
+    printf("Testing oversized allocations and the retain limit...\n");
+
+    Arena arena;
+    arena_init(&arena);
+    arena_alloc(&arena, 32);
+    size_t big = ARENA_BLOCK_SIZE * 4;
+    char *p = arena_alloc(&arena, big);
+    TEST_ASSERT(p != NULL && arena.current->size >= big, "Oversized requests should get a block of their own");
+    memset(p, 'x', big);
+
+    //-- Hold more than the limit, then reset --//
+    for (int i = 0; i < 8; i++) arena_alloc(&arena, ARENA_RETAIN_MAX / 4);
+    TEST_ASSERT(arena.retained > ARENA_RETAIN_MAX, "The arena should have grown past the retain limit");
+    arena_reset(&arena);
+    TEST_ASSERT(arena.retained <= ARENA_RETAIN_MAX, "Reset should trim the arena back under the limit");
+    TEST_ASSERT(arena.first == NULL || arena.first->next == NULL, "Only the first block should survive the trim");
+    TEST_ASSERT(arena_alloc(&arena, 16) != NULL, "The arena should stay usable after a trim");
+
+    arena_destroy(&arena);
+    TEST_SUCCESS("Arena trim test passed");
+}
+
+int main() {
+    init_test_framework();
+    printf("=== Scratch Arena Tests ===\n");
+
+    test_alignment_and_copies();
+    test_reuse_after_reset();
+    test_large_and_trim();
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,216 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_art.c
+ * Module                    : Adaptive Radix Tree Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit tests for the adaptive radix tree: lookups and ordering against
+ *  a sorted reference, every node size growing and shrinking, long
+ *  compressed paths, range and prefix walks, and memory accounting.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../src/utils/art.h"
+#include "test_framework.h"
+
+#define KEYS 20000
+
+typedef struct Collect {
+    char **keys;
+    size_t count;
+    size_t limit;            //- stop after this many, 0 = all -//
+} Collect;
+
+static int collect(const char *key, size_t len, void *ctx) {
+    Collect *c = ctx;
+    c->keys[c->count] = malloc(len + 1);
+    memcpy(c->keys[c->count], key, len + 1);
+    c->count++;
+    return c->limit && c->count == c->limit;
+}
+
+static void collect_free(Collect *c) {
+    for (size_t i = 0; i < c->count; i++) free(c->keys[i]);
+    c->count = 0;
+}
+
+static int by_string(const void *a, const void *b) {
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+//-- Keys with shared paths longer than ART_MAX_PREFIX, keys that prefix others, and all node sizes --//
+static char **make_keys(void) {
+    char **keys = malloc(KEYS * sizeof(char *));
+    char buf[96];
+    srand(7);
+    for (int i = 0; i < KEYS; i++) {
+        switch (i % 4) {
+        case 0: snprintf(buf, sizeof(buf), "tenant:%d:session:%d", rand() % 50, i); break;
+        case 1: snprintf(buf, sizeof(buf), "a-very-long-shared-namespace-prefix:%d", i); break;
+        case 2: snprintf(buf, sizeof(buf), "%c#%d", 1 + rand() % 255, i); break;
+        default: snprintf(buf, sizeof(buf), "k%d", i / 4); break;
+        }
+        keys[i] = strdup(buf);
+    }
+    return keys;
+}
+
+static int same_order(const Collect *c, char **expected, size_t n) {
+    if (c->count != n) return 0;
+    for (size_t i = 0; i < n; i++) {
+        if (strcmp(c->keys[i], expected[i]) != 0) return 0;
+    }
+    return 1;
+}
+
+void test_insert_lookup_order() {
+    printf("Testing inserts, lookups and in-order walks...\n");
+    ArtTree t;
+    art_init(&t);
+    char **keys = make_keys();
+
+    int dup = 0, inserted = 0;
+    for (int i = 0; i < KEYS; i++) inserted += art_insert(&t, keys[i], strlen(keys[i])) == 1;
+    for (int i = 0; i < KEYS; i += 7) dup += art_insert(&t, keys[i], strlen(keys[i])) == 0;
+    TEST_ASSERT(inserted == KEYS && t.size == KEYS, "Every distinct key should be added once");
+    TEST_ASSERT(dup == (KEYS + 6) / 7, "Adding a present key should report it");
+
+    int found = 1;
+    for (int i = 0; i < KEYS; i++) found &= art_contains(&t, keys[i], strlen(keys[i]));
+    TEST_ASSERT(found, "Every key should be found");
+    TEST_ASSERT(!art_contains(&t, "tenant:1", 8) && !art_contains(&t, "k", 1) && !art_contains(&t, "zzz", 3),
+                "Prefixes of keys and absent keys should not be found");
+
+    char **sorted = malloc(KEYS * sizeof(char *));
+    memcpy(sorted, keys, KEYS * sizeof(char *));
+    qsort(sorted, KEYS, sizeof(char *), by_string);
+    Collect c = { malloc(KEYS * sizeof(char *)), 0, 0 };
+    TEST_ASSERT(art_range(&t, NULL, 0, 0, NULL, 0, collect, &c) == 0, "A full walk should run to the end");
+    TEST_ASSERT(same_order(&c, sorted, KEYS), "A full walk should list the keys in byte order");
+    collect_free(&c);
+
+    //-- Delete every other key in sorted order, then check order again --//
+    size_t kept = 0;
+    int removed = 1;
+    for (int i = 0; i < KEYS; i++) {
+        if (i % 2) removed &= art_delete(&t, sorted[i], strlen(sorted[i])) == 1;
+        else sorted[kept++] = sorted[i];
+    }
+    TEST_ASSERT(removed && t.size == kept, "Deletes should remove exactly their keys");
+    TEST_ASSERT(art_delete(&t, "tenant:1", 8) == 0, "Deleting an absent key should do nothing");
+    art_range(&t, NULL, 0, 0, NULL, 0, collect, &c);
+    TEST_ASSERT(same_order(&c, sorted, kept), "Nodes should stay ordered as they shrink");
+    collect_free(&c);
+
+    for (size_t i = 0; i < kept; i++) art_delete(&t, sorted[i], strlen(sorted[i]));
+    TEST_ASSERT(t.size == 0 && t.root == NULL && t.bytes == 0, "Deleting every key should free every node");
+
+    for (int i = 0; i < KEYS; i++) free(keys[i]);
+    free(keys);
+    free(sorted);
+    free(c.keys);
+    TEST_SUCCESS("Insert, lookup and order test passed");
+}
+
+void test_range_and_prefix() {
+    printf("Testing range and prefix walks...\n");
+    ArtTree t;
+    art_init(&t);
+    const char *keys[] = { "user:1", "user:10", "user:100", "user:2", "user:20", "users", "user",
+                           "tenant:7:session:a", "tenant:7:session:b", "tenant:7:sessions", "tenant:70:session:a" };
+    const size_t n = sizeof(keys) / sizeof(keys[0]);
+    for (size_t i = 0; i < n; i++) art_insert(&t, keys[i], strlen(keys[i]));
+    Collect c = { malloc(n * sizeof(char *)), 0, 0 };
+
+    art_range(&t, "user:10", 7, 0, "user:3", 6, collect, &c);
+    char *inclusive[] = { "user:10", "user:100", "user:2", "user:20" };
+    TEST_ASSERT(same_order(&c, inclusive, 4), "A range should cover [lo, hi)");
+    collect_free(&c);
+
+    art_range(&t, "user:10", 7, 1, "user:20", 7, collect, &c);
+    char *exclusive[] = { "user:100", "user:2" };
+    TEST_ASSERT(same_order(&c, exclusive, 2), "An exclusive lower bound should leave lo out");
+    collect_free(&c);
+
+    art_range(&t, "user:15", 7, 0, NULL, 0, collect, &c);
+    char *open[] = { "user:2", "user:20", "users" };
+    TEST_ASSERT(same_order(&c, open, 3), "A bound between keys should start at the next one");
+    collect_free(&c);
+
+    art_prefix(&t, "tenant:7:", 9, NULL, 0, collect, &c);
+    char *tenant[] = { "tenant:7:session:a", "tenant:7:session:b", "tenant:7:sessions" };
+    TEST_ASSERT(same_order(&c, tenant, 3), "A prefix walk should list exactly the keys with that prefix");
+    collect_free(&c);
+
+    art_prefix(&t, "tenant:7:", 9, "tenant:7:session:a", 18, collect, &c);
+    TEST_ASSERT(same_order(&c, tenant + 1, 2), "A prefix walk should resume after a key");
+    collect_free(&c);
+
+    c.limit = 2;
+    TEST_ASSERT(art_prefix(&t, "user", 4, NULL, 0, collect, &c) == 1 && c.count == 2,
+                "A visitor should be able to stop the walk");
+    collect_free(&c);
+    c.limit = 0;
+
+    TEST_ASSERT(art_prefix(&t, "nobody", 6, NULL, 0, collect, &c) == 0 && c.count == 0,
+                "An unmatched prefix should visit nothing");
+    art_prefix(&t, "", 0, NULL, 0, collect, &c);
+    TEST_ASSERT(c.count == n, "An empty prefix should visit every key");
+    collect_free(&c);
+
+    art_clear(&t);
+    TEST_ASSERT(t.size == 0 && t.bytes == 0 && !art_contains(&t, "user", 4), "Clearing should empty the tree");
+    free(c.keys);
+    TEST_SUCCESS("Range and prefix test passed");
+}
+
+static int count_visit(const char *key, size_t len, void *ctx) {
+    (void)key;
+    (void)len;
+    (*(size_t *)ctx)++;
+    return 0;
+}
+
+void test_many_prefixes() {
+    printf("Testing prefix walks among many similar prefixes...\n");
+    ArtTree t;
+    art_init(&t);
+    char key[64];
+    for (int tenant = 0; tenant < 200; tenant++) {
+        for (int s = 0; s < 100; s++) {
+            snprintf(key, sizeof(key), "tenant:%d:session:%d", tenant, s);
+            art_insert(&t, key, strlen(key));
+        }
+    }
+    size_t visited = 0;
+    TEST_ASSERT(art_prefix(&t, "tenant:42:", 10, NULL, 0, count_visit, &visited) == 0 && visited == 100,
+                "A tenant's keys should all be found");
+    visited = 0;
+    art_prefix(&t, "tenant:4", 8, NULL, 0, count_visit, &visited);
+    TEST_ASSERT(visited == 1100, "A shorter prefix should take in every tenant it covers");
+    art_clear(&t);
+    TEST_SUCCESS("Many prefixes test passed");
+}
+
+int main() {
+    init_test_framework();
+    printf("=== Adaptive Radix Tree Tests ===\n");
+
+    test_insert_lookup_order();
+    test_range_and_prefix();
+    test_many_prefixes();
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}
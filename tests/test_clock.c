@@ -0,0 +1,79 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_clock.c
+ * Module                    : Server Clock Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit tests for the cached monotonic clock, its ticker and the
+ *  wall-clock conversions.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <assert.h>
+#include <unistd.h>
+#include "../src/utils/monoClock.h"
+#include "test_framework.h"
+
+void test_direct_reads() {
+    printf("Testing direct monotonic reads...\n");
+
+    TEST_ASSERT(mono_clock_cached == 0, "Nothing should be cached before the ticker starts");
+    long long a = mono_clock_ms();
+    usleep(20 * 1000);
+    long long b = mono_clock_ms();
+    TEST_ASSERT(a > 0 && b >= a + 15, "Direct reads should follow real time");
+
+    TEST_SUCCESS("Direct read test passed");
+}
+
+void test_ticker() {
+    printf("Testing the clock ticker...\n");
+
+    TEST_ASSERT(mono_clock_start() == 0, "The ticker should start");
+    TEST_ASSERT(mono_clock_cached > 0, "The cache should be filled right away");
+    long long a = mono_clock_ms();
+    usleep(30 * 1000);
+    long long b = mono_clock_ms();
+    TEST_ASSERT(b - a >= 20, "The cached clock should advance");
+    long long direct = mono_clock_read();
+    TEST_ASSERT(direct - b >= -2 && direct - b < 20, "The cache should stay within a few ticks of the clock");
+
+    mono_clock_stop();
+    TEST_ASSERT(mono_clock_cached == 0, "Stopping should fall back to direct reads");
+
+    TEST_SUCCESS("Ticker test passed");
+}
+
+void test_wall_conversion() {
+    printf("Testing wall-clock conversions...\n");
+
+    long long wall = wall_clock_ms();
+    TEST_ASSERT(wall > 1500000000000LL, "Wall clock should be Unix epoch milliseconds");
+    long long mono = wall_to_mono_ms(wall + 5000);
+    long long delta = mono - mono_clock_ms();
+    TEST_ASSERT(delta >= 4990 && delta <= 5010, "A wall deadline 5 s ahead should be 5 s ahead on the monotonic clock");
+    long long back = mono_to_wall_ms(mono);
+    TEST_ASSERT(back - (wall + 5000) >= -10 && back - (wall + 5000) <= 10, "Conversions should round-trip");
+
+    TEST_SUCCESS("Wall conversion test passed");
+}
+
+int main() {
+    init_test_framework();
+    printf("=== Server Clock Tests ===\n");
+
+    test_direct_reads();
+    test_ticker();
+    test_wall_conversion();
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,203 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_defrag.c
+ * Module                    : Active Defrag Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit tests for the active defragmenter: the CPU ramp between the
+ *  thresholds, compaction of a keyspace after mass deletes, and the
+ *  integrity of moved strings, TTLs and lists.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "../src/utils/hashTable.h"
+#include "../src/utils/defrag.h"
+#include "../src/utils/memAlloc.h"
+#include "../src/utils/slab.h"
+#include "../src/utils/epoch.h"
+#include "test_framework.h"
+
+#define KEYS 20000
+#define KEEP_EVERY 10
+#define LIST_LEN 8
+
+static const char *long_value = "this value is longer than sixty-four bytes so it is stored as its own raw allocation";
+
+static void make_key(char *buf, size_t size, int i) {
+    snprintf(buf, size, "defrag:%d", i);
+}
+
+static void make_value(char *buf, size_t size, int i) {
+    if (i % 3 == 0) {
+        snprintf(buf, size, "%s-%d", long_value, i);
+    } else {
+        snprintf(buf, size, "short-%d", i);
+    }
+}
+
+//-- Run defrag cycles until `passes` more full passes completed --//
+static void run_passes(unsigned long long passes) {
+    DefragStats st;
+    defrag_get_stats(&st);
+    unsigned long long target = st.passes + passes;
+    while (st.passes < target) {
+        defrag_cycle(1000000);
+        defrag_get_stats(&st);
+    }
+}
+
+void test_cpu_ramp() {
+    printf("Testing the defrag CPU ramp between thresholds...\n");
+
+    DefragConfig cfg;
+    defrag_default_config(&cfg);
+    cfg.ignore_bytes = 1000;
+    TEST_ASSERT(defrag_cpu_percent(&cfg, 5.0, 1 << 20) == 0, "Below the lower threshold nothing should run");
+    TEST_ASSERT(defrag_cpu_percent(&cfg, 50.0, 10) == 0, "Less waste than ignore_bytes should be left alone");
+    TEST_ASSERT(defrag_cpu_percent(&cfg, cfg.threshold_lower, 1 << 20) == cfg.cycle_min, "The lower threshold should get cycle_min");
+    TEST_ASSERT(defrag_cpu_percent(&cfg, 500.0, 1 << 20) == cfg.cycle_max, "Past the upper threshold should get cycle_max");
+    int mid = defrag_cpu_percent(&cfg, (cfg.threshold_lower + cfg.threshold_upper) / 2.0, 1 << 20);
+    TEST_ASSERT(mid > cfg.cycle_min && mid < cfg.cycle_max, "The CPU share should rise between the thresholds");
+
+    TEST_SUCCESS("CPU ramp test passed");
+}
+
+void test_compaction() {
+    printf("Testing compaction after mass deletes...\n");
+
+    char key[32], value[128];
+    for (int i = 0; i < KEYS; i++) {
+        make_key(key, sizeof(key), i);
+        make_value(value, sizeof(value), i);
+        set_value(key, value, i % 4 == 0 ? 3600 * 1000 : 0);
+    }
+    for (int i = 0; i < KEYS; i++) {
+        if (i % KEEP_EVERY == 0) continue;
+        make_key(key, sizeof(key), i);
+        delete_key(key);
+    }
+    epoch_synchronize();
+    slab_thread_flush();
+
+    MemStats before;
+    mem_stats(&before);
+#ifndef MEMORA_ALLOC_LIBC
+    size_t waste;
+    double frag = defrag_fragmentation(&waste);
+    TEST_ASSERT(frag > 100.0, "Deleting most keys should leave the chunks fragmented");
+#endif
+
+    DefragStats st0, st1;
+    defrag_get_stats(&st0);
+    run_passes(2);
+    slab_thread_flush();
+    defrag_get_stats(&st1);
+
+    MemStats after;
+    mem_stats(&after);
+    int intact = 1, ttl_kept = 1;
+    for (int i = 0; i < KEYS; i += KEEP_EVERY) {
+        make_key(key, sizeof(key), i);
+        make_value(value, sizeof(value), i);
+        const char *got = get_value(key);
+        if (!got || strcmp(got, value) != 0) intact = 0;
+        if (i % 4 == 0 && get_ttl_ms(key) <= 0) ttl_kept = 0;
+    }
+    TEST_ASSERT(intact, "Every surviving key should keep its value");
+    TEST_ASSERT(ttl_kept, "Moved keys should keep their TTL");
+    TEST_ASSERT(after.used == before.used, "Moving allocations should not change the bytes in use");
+
+#ifdef MEMORA_ALLOC_LIBC
+    TEST_ASSERT(st1.hits == st0.hits, "With plain malloc nothing should be moved");
+#else
+    TEST_ASSERT(st1.hits > st0.hits && st1.bytes_moved > st0.bytes_moved, "Allocations in sparse chunks should be moved");
+    TEST_ASSERT(st1.released_bytes > st0.released_bytes, "Emptied chunks should be released");
+    TEST_ASSERT(after.slab_reserved * 2 < before.slab_reserved, "Defrag should release at least half of the reserved chunks");
+    size_t waste_after;
+    TEST_ASSERT(defrag_fragmentation(&waste_after) < frag, "Fragmentation should drop");
+#endif
+
+    TEST_SUCCESS("Compaction test passed");
+}
+
+void test_list_integrity() {
+    printf("Testing that moved list nodes keep their order...\n");
+
+    char key[32], value[32];
+    for (int i = 0; i < KEYS / 10; i++) {
+        snprintf(key, sizeof(key), "defrag:list:%d", i);
+        List *list = get_or_create_list(key);
+        for (int j = 0; j < LIST_LEN; j++) {
+            snprintf(value, sizeof(value), "%d-%d", i, j);
+            list_rpush(list, value);
+        }
+    }
+    //-- Pop most elements so the node chunks end up sparse --//
+    for (int i = 0; i < KEYS / 10; i++) {
+        snprintf(key, sizeof(key), "defrag:list:%d", i);
+        List *list = get_list_if_exists(key);
+        for (int j = 0; j < LIST_LEN - 2; j++) mem_free_str(lpop_element(list));
+    }
+    slab_thread_flush();
+    DefragStats st0, st1;
+    defrag_get_stats(&st0);
+    run_passes(1);
+    defrag_get_stats(&st1);
+
+    Arena arena;
+    arena_init(&arena);
+    int ordered = 1, tails = 1;
+    for (int i = 0; i < KEYS / 10; i++) {
+        snprintf(key, sizeof(key), "defrag:list:%d", i);
+        List *list = get_list_if_exists(key);
+        int count = 0;
+        char **items = list ? list_range(list, 0, -1, &count, &arena) : NULL;
+        if (!items || count != 2) {
+            ordered = 0;
+        } else {
+            for (int j = 0; j < 2; j++) {
+                snprintf(value, sizeof(value), "%d-%d", i, LIST_LEN - 2 + j);
+                if (strcmp(items[j], value) != 0) ordered = 0;
+            }
+        }
+        //-- The tail must follow the moved node, or RPUSH would append to a stale copy --//
+        snprintf(value, sizeof(value), "%d-x", i);
+        if (list && (list_rpush(list, value) != 3 || strcmp(list->tail->value, value) != 0 ||
+                     list->head->next->next != list->tail)) {
+            tails = 0;
+        }
+        arena_reset(&arena);
+    }
+    arena_destroy(&arena);
+    TEST_ASSERT(ordered, "Lists should keep their elements in order");
+    TEST_ASSERT(tails, "List tails should point at the moved last node");
+#ifndef MEMORA_ALLOC_LIBC
+    TEST_ASSERT(st1.hits > st0.hits, "Nodes and elements in sparse chunks should be moved");
+#endif
+
+    TEST_SUCCESS("List integrity test passed");
+}
+
+int main() {
+    init_test_framework();
+    printf("=== Active Defrag Tests ===\n");
+    hashtable_lock_init();
+
+    test_cpu_ramp();
+    test_compaction();
+    test_list_integrity();
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,171 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_epoch.c
+ * Module                    : Epoch Reclamation Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit tests for epoch-based reclamation: deferred frees, grace periods
+ *  held open by readers, and lock-free GET racing SET/DEL.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include "../src/utils/hashTable.h"
+#include "../src/utils/epoch.h"
+#include "test_framework.h"
+
+#define EPOCH_TEST_BATCH 256
+#define EPOCH_STRESS_READERS 3
+#define EPOCH_STRESS_ROUNDS 20000
+
+static int freed_count = 0;
+
+static void count_free(void *ptr) {
+    __atomic_fetch_add(&freed_count, 1, __ATOMIC_RELAXED);
+    free(ptr);
+}
+
+void test_epoch_retire_and_synchronize() {
+    printf("Testing epoch retire/synchronize...\n");
+
+    freed_count = 0;
+    epoch_retire(malloc(16), count_free);
+    TEST_ASSERT(epoch_pending() >= 1, "Retired object should be pending");
+
+    epoch_synchronize();
+    TEST_ASSERT(freed_count == 1, "Synchronize should free the retired object");
+    TEST_ASSERT(epoch_pending() == 0, "Nothing should be pending after synchronize");
+
+    //-- Nested sections only withdraw on the outermost exit --//
+    epoch_enter();
+    epoch_enter();
+    epoch_exit();
+    epoch_exit();
+    epoch_synchronize();
+
+    TEST_SUCCESS("Epoch retire/synchronize test passed");
+}
+
+static volatile int reader_inside = 0;
+static volatile int reader_release = 0;
+
+static void *pinned_reader(void *arg) {
+    (void)arg;
+    epoch_enter();
+    __atomic_store_n(&reader_inside, 1, __ATOMIC_RELEASE);
+    while (!__atomic_load_n(&reader_release, __ATOMIC_ACQUIRE)) {
+        sched_yield();
+    }
+    epoch_exit();
+    return NULL;
+}
+
+void test_epoch_reader_blocks_reclaim() {
+    printf("Testing epoch grace period held by a reader...\n");
+
+    freed_count = 0;
+    reader_inside = 0;
+    reader_release = 0;
+
+    pthread_t reader;
+    pthread_create(&reader, NULL, pinned_reader, NULL);
+    while (!__atomic_load_n(&reader_inside, __ATOMIC_ACQUIRE)) {
+        sched_yield();
+    }
+
+    //-- Enough retires to trigger reclaim attempts, none may be freed yet --//
+    for (int i = 0; i < EPOCH_TEST_BATCH; i++) {
+        epoch_retire(malloc(16), count_free);
+        epoch_enter();
+        epoch_exit();
+    }
+    TEST_ASSERT(freed_count == 0, "Nothing may be freed while a reader is pinned");
+
+    __atomic_store_n(&reader_release, 1, __ATOMIC_RELEASE);
+    pthread_join(reader, NULL);
+
+    epoch_synchronize();
+    TEST_ASSERT(freed_count == EPOCH_TEST_BATCH, "Everything should be freed once the reader leaves");
+
+    TEST_SUCCESS("Epoch reader grace period test passed");
+}
+
+static volatile int stress_done = 0;
+static int stress_bad_reads = 0;
+
+static void *stress_reader(void *arg) {
+    (void)arg;
+    while (!__atomic_load_n(&stress_done, __ATOMIC_ACQUIRE)) {
+        epoch_enter();
+        const char *value = get_value("epoch:key");
+        //-- Hold the pointer across a yield, as a slow reply would --//
+        sched_yield();
+        if (value && strncmp(value, "value-", 6) != 0) {
+            __atomic_fetch_add(&stress_bad_reads, 1, __ATOMIC_RELAXED);
+        }
+        epoch_exit();
+    }
+    return NULL;
+}
+
+void test_epoch_get_races_set_delete() {
+    printf("Testing lock-free GET racing SET/DEL...\n");
+
+    stress_done = 0;
+    stress_bad_reads = 0;
+
+    pthread_t readers[EPOCH_STRESS_READERS];
+    for (int i = 0; i < EPOCH_STRESS_READERS; i++) {
+        pthread_create(&readers[i], NULL, stress_reader, NULL);
+    }
+
+    char value[128];
+    for (int i = 0; i < EPOCH_STRESS_ROUNDS; i++) {
+        //-- Alternate embedded and separately allocated values --//
+        if (i % 2) {
+            snprintf(value, sizeof(value), "value-%d", i);
+        } else {
+            snprintf(value, sizeof(value), "value-%d-%0100d", i, 0);
+        }
+        set_value("epoch:key", value, 0);
+        if (i % 7 == 0) {
+            delete_key("epoch:key");
+        }
+    }
+
+    __atomic_store_n(&stress_done, 1, __ATOMIC_RELEASE);
+    for (int i = 0; i < EPOCH_STRESS_READERS; i++) {
+        pthread_join(readers[i], NULL);
+    }
+    delete_key("epoch:key");
+    epoch_synchronize();
+
+    TEST_ASSERT(stress_bad_reads == 0, "Readers must never observe freed values");
+    TEST_ASSERT(get_value("epoch:key") == NULL, "Key should be gone after the final delete");
+
+    TEST_SUCCESS("Lock-free GET race test passed");
+}
+
+int main() {
+    init_test_framework();
+    hashtable_lock_init();
+    printf("=== Epoch Reclamation Tests ===\n");
+
+    test_epoch_retire_and_synchronize();
+    test_epoch_reader_blocks_reclaim();
+    test_epoch_get_races_set_delete();
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,276 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_evict.c
+ * Module                    : Eviction Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit tests for maxmemory eviction: the LFU counter and its decay,
+ *  access tracking, and which keys each policy gives up.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "../src/utils/hashTable.h"
+#include "../src/utils/evict.h"
+#include "../src/utils/epoch.h"
+#include "../src/utils/memAlloc.h"
+#include "test_framework.h"
+
+#define HOT_KEYS 200
+#define COLD_KEYS 1000
+#define NEW_KEYS 500
+#define VALUE_LEN 100     //- above ENTRY_EMBED_MAX, so every key owns a raw value -//
+
+static char value[VALUE_LEN + 1];
+
+//-- Empty keyspace, all retired memory freed, no limit --//
+static void reset(void) {
+    EvictConfig cfg;
+    evict_default_config(&cfg);
+    evict_configure(&cfg);
+    hashtable_flush(0);
+    epoch_synchronize();
+}
+
+//-- Limit memory to what is in use now plus extra bytes --//
+static size_t limit_to(evict_policy_t policy, size_t extra) {
+    EvictConfig cfg;
+    evict_default_config(&cfg);
+    cfg.maxmemory = evict_used_memory() + extra;
+    cfg.policy = policy;
+    evict_configure(&cfg);
+    return cfg.maxmemory;
+}
+
+//-- SET the way the server does: make room first --//
+static int set_key(const char *prefix, int i, long long px) {
+    char key[32];
+    snprintf(key, sizeof(key), "%s:%d", prefix, i);
+    if (evict_make_room() != 0) return -1;
+    set_value(key, value, px);
+    return 0;
+}
+
+static int count_keys(const char *prefix, int n) {
+    char key[32];
+    int found = 0;
+    for (int i = 0; i < n; i++) {
+        snprintf(key, sizeof(key), "%s:%d", prefix, i);
+        uint32_t idle;
+        uint8_t freq;
+        found += get_key_access(key, &idle, &freq);
+    }
+    return found;
+}
+
+void test_policy_names() {
+    printf("Testing eviction policy names...\n");
+
+    evict_policy_t policy;
+    int round_trip = 1;
+    for (int p = 0; p < EVICT_POLICY_COUNT; p++) {
+        if (evict_parse_policy(evict_policy_name((evict_policy_t)p), &policy) != 0 || policy != (evict_policy_t)p) {
+            round_trip = 0;
+        }
+    }
+    TEST_ASSERT(round_trip, "Every policy name should parse back to its policy");
+    TEST_ASSERT(evict_parse_policy("ALLKEYS-LFU", &policy) == 0 && policy == EVICT_ALLKEYS_LFU, "Policy names should be case-insensitive");
+    TEST_ASSERT(evict_parse_policy("volatile-lfu", &policy) == -1, "Unknown policies should be rejected");
+
+    TEST_SUCCESS("Policy name test passed");
+}
+
+void test_lfu_counter() {
+    printf("Testing the logarithmic LFU counter and its decay...\n");
+
+    uint8_t counter = LFU_INIT_VAL;
+    for (int i = 0; i < 1000; i++) counter = lfu_log_incr(counter);
+    TEST_ASSERT(counter > LFU_INIT_VAL + 5 && counter < 40, "A thousand hits should raise the counter logarithmically");
+    for (int i = 0; i < 2000000; i++) counter = lfu_log_incr(counter);
+    TEST_ASSERT(counter > 200, "Millions of hits should bring the counter near saturation");
+    for (int i = 0; i < 1000; i++) counter = lfu_log_incr(counter);
+    TEST_ASSERT(lfu_log_incr(255) == 255, "The counter should saturate at 255");
+
+    uint32_t then = 1000;
+    uint32_t access = ((uint32_t)20 << LRU_CLOCK_BITS) | then;
+    TEST_ASSERT(lfu_decayed(access, then + 59) == 20, "Less than a decay period should not decay");
+    TEST_ASSERT(lfu_decayed(access, then + 5 * 60) == 15, "Each idle minute should take one off the counter");
+    TEST_ASSERT(lfu_decayed(access, then + 3600) == 0, "Long idle keys should decay to zero");
+    hashtable_set_lfu_params(LFU_DEFAULT_LOG_FACTOR, 0);
+    TEST_ASSERT(lfu_decayed(access, then + 3600) == 20, "A decay time of 0 should keep the counter");
+    hashtable_set_lfu_params(LFU_DEFAULT_LOG_FACTOR, LFU_DEFAULT_DECAY_TIME);
+
+    access = LRU_CLOCK_MAX - 5;
+    TEST_ASSERT(lru_idle_seconds(access, 10) == 16, "Idle time should survive the LRU clock wrapping");
+
+    TEST_SUCCESS("LFU counter test passed");
+}
+
+void test_access_tracking() {
+    printf("Testing per-key access tracking...\n");
+
+    set_value("access:key", "v", 0);
+    uint32_t idle;
+    uint8_t freq, again;
+    TEST_ASSERT(get_key_access("access:key", &idle, &freq) == 1, "An existing key should report its access stats");
+    TEST_ASSERT(freq == LFU_INIT_VAL && idle <= 1, "A new key should start at LFU_INIT_VAL, just accessed");
+    TEST_ASSERT(get_key_access("access:key", &idle, &again) == 1 && again == freq, "Reading the stats should not count as an access");
+    for (int i = 0; i < 200; i++) get_value("access:key");
+    get_key_access("access:key", &idle, &freq);
+    TEST_ASSERT(freq > LFU_INIT_VAL, "Reads should raise the counter");
+    TEST_ASSERT(get_key_access("access:missing", &idle, &freq) == 0, "A missing key should report nothing");
+    TEST_ASSERT(ENTRY_HEADER_SIZE <= 32, "The access word should fit in the entry header");
+
+    delete_key("access:key");
+    TEST_SUCCESS("Access tracking test passed");
+}
+
+void test_noeviction() {
+    printf("Testing noeviction...\n");
+    reset();
+
+    for (int i = 0; i < HOT_KEYS; i++) set_key("noevict", i, 0);
+    EvictStats st0, st1;
+    evict_get_stats(&st0);
+    limit_to(EVICT_NOEVICTION, 0);
+    TEST_ASSERT(evict_make_room() == 0, "Memory at the limit should still allow writes");
+    set_value("noevict:over", value, 0);
+    TEST_ASSERT(evict_make_room() == -1, "Writes over the limit should be refused");
+    evict_get_stats(&st1);
+    TEST_ASSERT(st1.oom_rejections == st0.oom_rejections + 1, "The refusal should be counted");
+    TEST_ASSERT(st1.evicted_keys == st0.evicted_keys && count_keys("noevict", HOT_KEYS) == HOT_KEYS, "noeviction should keep every key");
+
+    TEST_SUCCESS("noeviction test passed");
+}
+
+void test_allkeys_lru() {
+    printf("Testing allkeys-lru keeps recently used keys...\n");
+    reset();
+
+    for (int i = 0; i < HOT_KEYS; i++) set_key("lru:hot", i, 0);
+    for (int i = 0; i < COLD_KEYS; i++) set_key("lru:cold", i, 0);
+    //-- The LRU clock counts seconds --//
+    usleep(1100 * 1000);
+    for (int i = 0; i < HOT_KEYS; i++) {
+        char key[32];
+        snprintf(key, sizeof(key), "lru:hot:%d", i);
+        get_value(key);
+    }
+    //-- Full now: every new key has to evict an old one --//
+    size_t limit = limit_to(EVICT_ALLKEYS_LRU, 0);
+
+    EvictStats st0, st1;
+    evict_get_stats(&st0);
+    int refused = 0;
+    for (int i = 0; i < NEW_KEYS; i++) refused += set_key("lru:new", i, 0) != 0;
+    evict_get_stats(&st1);
+
+    TEST_ASSERT(refused == 0, "allkeys-lru should always find room");
+    TEST_ASSERT(st1.evicted_keys > st0.evicted_keys, "Exceeding maxmemory should evict keys");
+    TEST_ASSERT(evict_used_memory() <= limit + 512, "Memory should stay at the limit");
+    TEST_ASSERT(count_keys("lru:hot", HOT_KEYS) >= HOT_KEYS * 95 / 100, "Recently read keys should survive");
+    TEST_ASSERT(count_keys("lru:cold", COLD_KEYS) < COLD_KEYS, "Idle keys should be evicted first");
+
+    epoch_synchronize();
+    TEST_ASSERT(hashtable_evict_pending() == 0, "Evicted memory should be freed after the grace period");
+    TEST_ASSERT(mem_used() <= limit + 512, "Freed memory should match what eviction counted");
+
+    TEST_SUCCESS("allkeys-lru test passed");
+}
+
+void test_allkeys_lfu() {
+    printf("Testing allkeys-lfu keeps frequently used keys...\n");
+    reset();
+
+    for (int i = 0; i < HOT_KEYS; i++) set_key("lfu:hot", i, 0);
+    for (int i = 0; i < COLD_KEYS; i++) set_key("lfu:cold", i, 0);
+    for (int r = 0; r < 100; r++) {
+        for (int i = 0; i < HOT_KEYS; i++) {
+            char key[32];
+            snprintf(key, sizeof(key), "lfu:hot:%d", i);
+            get_value(key);
+        }
+    }
+
+    limit_to(EVICT_ALLKEYS_LFU, 0);
+    int refused = 0;
+    for (int i = 0; i < COLD_KEYS * 2; i++) refused += set_key("lfu:new", i, 0) != 0;
+    EvictStats st;
+    evict_get_stats(&st);
+    TEST_ASSERT(refused == 0 && st.evicted_keys > 0, "allkeys-lfu should evict to make room");
+    TEST_ASSERT(count_keys("lfu:hot", HOT_KEYS) >= HOT_KEYS * 95 / 100, "Frequently read keys should survive");
+
+    TEST_SUCCESS("allkeys-lfu test passed");
+}
+
+void test_volatile_ttl() {
+    printf("Testing volatile-ttl and volatile-lru only evict keys with a TTL...\n");
+    reset();
+
+    for (int i = 0; i < HOT_KEYS; i++) set_key("ttl:persistent", i, 0);
+    //-- ttl:n:i expires after (i + 1) minutes --//
+    for (int i = 0; i < COLD_KEYS; i++) set_key("ttl:n", i, (long long)(i + 1) * 60000);
+    limit_to(EVICT_VOLATILE_TTL, 0);
+    for (int i = 0; i < NEW_KEYS; i++) set_key("ttl:m", i, 24LL * 3600 * 1000);
+
+    TEST_ASSERT(count_keys("ttl:persistent", HOT_KEYS) == HOT_KEYS, "Keys without a TTL should never be evicted");
+    TEST_ASSERT(count_keys("ttl:n", COLD_KEYS / 4) < COLD_KEYS / 8, "Keys closest to expiring should go first");
+    TEST_ASSERT(count_keys("ttl:m", NEW_KEYS) == NEW_KEYS, "Keys far from expiring should stay");
+
+    //-- Once no key has a TTL, there is nothing a volatile policy may evict --//
+    reset();
+    for (int i = 0; i < HOT_KEYS; i++) set_key("ttl:persistent", i, 0);
+    limit_to(EVICT_VOLATILE_LRU, 0);
+    set_value("ttl:over", value, 0);
+    TEST_ASSERT(evict_make_room() == -1, "volatile-lru should refuse writes when no key has a TTL");
+    TEST_ASSERT(count_keys("ttl:persistent", HOT_KEYS) == HOT_KEYS, "volatile-lru should not touch keys without a TTL");
+
+    TEST_SUCCESS("Volatile policy test passed");
+}
+
+void test_allkeys_random() {
+    printf("Testing allkeys-random...\n");
+    reset();
+
+    for (int i = 0; i < COLD_KEYS; i++) set_key("random", i, 0);
+    size_t limit = limit_to(EVICT_ALLKEYS_RANDOM, 0);
+    int refused = 0;
+    for (int i = COLD_KEYS; i < COLD_KEYS * 2; i++) refused += set_key("random", i, 0) != 0;
+    int left = count_keys("random", COLD_KEYS * 2);
+    TEST_ASSERT(refused == 0, "allkeys-random should always find room");
+    TEST_ASSERT(left < COLD_KEYS * 2 && left > COLD_KEYS / 2, "Random eviction should keep memory at the limit");
+    TEST_ASSERT(evict_used_memory() <= limit + 512, "Memory should stay at the limit");
+
+    reset();
+    TEST_SUCCESS("allkeys-random test passed");
+}
+
+int main() {
+    init_test_framework();
+    printf("=== Eviction Tests ===\n");
+    hashtable_lock_init();
+    memset(value, 'v', VALUE_LEN);
+
+    test_policy_names();
+    test_lfu_counter();
+    test_access_tracking();
+    test_noeviction();
+    test_allkeys_lru();
+    test_allkeys_lfu();
+    test_volatile_ttl();
+    test_allkeys_random();
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}
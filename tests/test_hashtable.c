@@ -5,8 +5,8 @@
  *
  * File                      : tests/test_hashtable.c
  * Module                    : Hash Table Unit Tests
- * Last Updating Author      : m0hamed541
- * Last Update               : 03/08/2026
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
  * Version                   : 1.0.0
  *
  * Description:
@@ -22,6 +22,10 @@
 #include <string.h>
 #include <unistd.h>
 #include "../src/utils/hashTable.h"
+#include "../src/utils/epoch.h"
+#include "../src/utils/expire.h"
+#include "../src/utils/glob.h"
+#include "../src/utils/numeric.h"
 #include "test_framework.h"
 
 void test_basic_set_get() {
@@ -69,6 +73,29 @@ void test_key_overwrite() {
     TEST_SUCCESS("Key overwrite test passed");
 }
 
+void test_embedded_and_raw_values() {
+    printf("Testing embedded and heap-allocated values...\n");
+
+    char big[ENTRY_EMBED_MAX + 32];
+    memset(big, 'x', sizeof(big) - 1);
+    big[sizeof(big) - 1] = '\0';
+
+    set_value("enc_key", "short", 0);
+    const char *result = get_value("enc_key");
+    TEST_ASSERT(result != NULL && strcmp(result, "short") == 0, "Short value should round-trip");
+
+    set_value("enc_key", big, 0);
+    result = get_value("enc_key");
+    TEST_ASSERT(result != NULL && strcmp(result, big) == 0, "Value above ENTRY_EMBED_MAX should round-trip");
+
+    set_value("enc_key", "again", 0);
+    result = get_value("enc_key");
+    TEST_ASSERT(result != NULL && strcmp(result, "again") == 0, "Overwriting a large value with a short one should work");
+
+    TEST_ASSERT(delete_key("enc_key") == 1, "Key should be deleted");
+    TEST_SUCCESS("Embedded and raw values test passed");
+}
+
 void test_nonexistent_key() {
     printf("Testing nonexistent key...\n");
 
@@ -78,6 +105,560 @@ void test_nonexistent_key() {
     TEST_SUCCESS("Nonexistent key test passed");
 }
 
+void test_many_keys_per_bucket() {
+    printf("Testing lookups with many keys per bucket...\n");
+
+    //-- 8 keys per bucket on average, so every chain / shard holds several entries --//
+    char key[32];
+    char value[32];
+    for (int i = 0; i < TABLE_SIZE * 8; i++) {
+        snprintf(key, sizeof(key), "bulk:%d", i);
+        snprintf(value, sizeof(value), "v%d", i);
+        set_value(key, value, 0);
+    }
+
+    int correct = 0;
+    for (int i = 0; i < TABLE_SIZE * 8; i++) {
+        snprintf(key, sizeof(key), "bulk:%d", i);
+        snprintf(value, sizeof(value), "v%d", i);
+        const char *result = get_value(key);
+        correct += result != NULL && strcmp(result, value) == 0;
+    }
+    TEST_ASSERT(correct == TABLE_SIZE * 8, "Every key should map to its own value");
+    TEST_ASSERT(get_value("bulk:") == NULL, "Prefix of a stored key should not match");
+
+    int deleted = 0;
+    for (int i = 0; i < TABLE_SIZE * 8; i++) {
+        snprintf(key, sizeof(key), "bulk:%d", i);
+        deleted += delete_key(key);
+    }
+    TEST_ASSERT(deleted == TABLE_SIZE * 8, "Every key should be deleted once");
+    TEST_ASSERT(get_value("bulk:0") == NULL, "Deleted key should be gone");
+
+    TEST_SUCCESS("Many keys per bucket test passed");
+}
+
+#define STRIPE_TEST_THREADS 4
+#define STRIPE_TEST_SETS 5000
+
+static void *stripe_writer(void *arg) {
+    (void)arg;
+    for (int i = 0; i < STRIPE_TEST_SETS; i++) {
+        set_value("stripe:hot", "v", 0);
+    }
+    return NULL;
+}
+
+void test_lock_stripe_stats() {
+    printf("Testing lock stripe counters...\n");
+
+    TEST_ASSERT(sizeof(StripeLock) % STRIPE_CACHE_LINE == 0, "Stripes should fill whole cache lines");
+    TEST_ASSERT((uintptr_t)&key_locks[1] - (uintptr_t)&key_locks[0] >= STRIPE_CACHE_LINE,
+                "Adjacent stripes should not share a cache line");
+
+    StripeStats before, after;
+    hashtable_lock_stats(&before);
+
+    pthread_t tids[STRIPE_TEST_THREADS];
+    for (int i = 0; i < STRIPE_TEST_THREADS; i++) {
+        pthread_create(&tids[i], NULL, stripe_writer, NULL);
+    }
+    for (int i = 0; i < STRIPE_TEST_THREADS; i++) {
+        pthread_join(tids[i], NULL);
+    }
+
+    hashtable_lock_stats(&after);
+    TEST_ASSERT(after.acquisitions - before.acquisitions == STRIPE_TEST_THREADS * STRIPE_TEST_SETS,
+                "Every SET should take its stripe exactly once");
+    TEST_ASSERT(after.contended - before.contended <= after.acquisitions - before.acquisitions,
+                "Contended count cannot exceed acquisitions");
+    TEST_ASSERT(after.parked <= after.contended, "Only contended acquisitions can park");
+    delete_key("stripe:hot");
+
+    TEST_SUCCESS("Lock stripe counters test passed");
+}
+
+#define SCAN_TEST_KEYS 3000
+
+typedef struct {
+    int seen[SCAN_TEST_KEYS];
+    int lists;
+} ScanSeen;
+
+static void scan_record(const Entry *entry, void *ctx) {
+    ScanSeen *st = ctx;
+    int id;
+    if (sscanf(entry->key, "scan:%d", &id) == 1 && id >= 0 && id < SCAN_TEST_KEYS) {
+        st->seen[id]++;
+    }
+    if (entry->type == VALUE_LIST) st->lists++;
+}
+
+void test_scan_full_iteration() {
+    printf("Testing SCAN cursor iteration...\n");
+
+    char key[32];
+    for (int i = 0; i < SCAN_TEST_KEYS; i++) {
+        snprintf(key, sizeof(key), "scan:%d", i);
+        set_value(key, "v", 0);
+    }
+    get_or_create_list("scan:list");
+
+    static ScanSeen st;
+    memset(&st, 0, sizeof(st));
+    unsigned long cursor = 0;
+    int calls = 0;
+    epoch_enter();
+    do {
+        cursor = hashtable_scan(cursor, 10, scan_record, &st);
+        calls++;
+    } while (cursor != 0 && calls < TABLE_SIZE * 2);
+    epoch_exit();
+
+    int missing = 0;
+    for (int i = 0; i < SCAN_TEST_KEYS; i++) {
+        if (st.seen[i] == 0) missing++;
+    }
+    TEST_ASSERT(cursor == 0, "SCAN should terminate with cursor 0");
+    TEST_ASSERT(missing == 0, "SCAN should return every key at least once");
+    TEST_ASSERT(st.lists == 1, "SCAN should visit list entries too");
+    TEST_ASSERT(calls > 1, "COUNT should bound the work done per call");
+
+    for (int i = 0; i < SCAN_TEST_KEYS; i++) {
+        snprintf(key, sizeof(key), "scan:%d", i);
+        delete_key(key);
+    }
+    delete_key("scan:list");
+
+    TEST_SUCCESS("SCAN cursor iteration test passed");
+}
+
+void test_glob_match() {
+    printf("Testing glob matching...\n");
+
+    TEST_ASSERT(glob_match("*", "anything"), "* should match anything");
+    TEST_ASSERT(glob_match("user:*", "user:42"), "Prefix pattern should match");
+    TEST_ASSERT(!glob_match("user:*", "session:42"), "Prefix pattern should reject other prefixes");
+    TEST_ASSERT(glob_match("*:42", "user:42"), "Suffix pattern should match");
+    TEST_ASSERT(glob_match("h?llo", "hello"), "? should match one character");
+    TEST_ASSERT(!glob_match("h?llo", "hllo"), "? should not match zero characters");
+    TEST_ASSERT(glob_match("h[ae]llo", "hallo"), "Class should match a listed character");
+    TEST_ASSERT(!glob_match("h[^e]llo", "hello"), "Negated class should reject a listed character");
+    TEST_ASSERT(glob_match("k[0-9]", "k7"), "Range should match");
+    TEST_ASSERT(glob_match("a\\*b", "a*b"), "Escaped * should match literally");
+    TEST_ASSERT(!glob_match("a\\*b", "axb"), "Escaped * should not act as a wildcard");
+    TEST_ASSERT(glob_match("*a*b*c*", "xxaxxbxxcxx"), "Multiple stars should backtrack");
+    TEST_ASSERT(!glob_match("*a*b*c", "xxaxxbxxcxx"), "Trailing literal must match the end");
+    TEST_ASSERT(glob_literal_prefix("user:*:name") == 5 && glob_literal_prefix("user") == 4,
+                "The literal prefix should stop at the first wildcard");
+    TEST_ASSERT(glob_literal_prefix("*") == 0 && glob_literal_prefix("a\\*") == 1 && glob_literal_prefix("k[0-9]") == 1,
+                "Escapes and classes should end the literal prefix");
+
+    TEST_SUCCESS("Glob matching test passed");
+}
+
+#define ORDERED_MAX 16
+
+typedef struct OrderedSeen {
+    char keys[ORDERED_MAX][32];
+    int count;
+} OrderedSeen;
+
+static void ordered_record(const Entry *entry, void *ctx) {
+    OrderedSeen *st = ctx;
+    if (st->count < ORDERED_MAX) snprintf(st->keys[st->count++], sizeof(st->keys[0]), "%s", entry->key);
+}
+
+static int ordered_is(const OrderedSeen *st, const char *const *expected, int n) {
+    if (st->count != n) return 0;
+    for (int i = 0; i < n; i++) {
+        if (strcmp(st->keys[i], expected[i]) != 0) return 0;
+    }
+    return 1;
+}
+
+void test_ordered_key_index() {
+    printf("Testing the ordered key index...\n");
+
+    OrderedSeen st = { .count = 0 };
+    TEST_ASSERT(hashtable_scan_prefix("", NULL, 0, ordered_record, &st, NULL) == -1,
+                "A prefix scan should fail while the index is off");
+
+    //-- Keys stored before the index is turned on are indexed by the backfill --//
+    set_value("ord:b", "v", 0);
+    set_value("ord:c", "v", 0);
+    set_value("other", "v", 0);
+    TEST_ASSERT(hashtable_set_key_index(1) == 0 && hashtable_key_index_enabled(), "The index should turn on");
+    set_value("ord:a", "v", 0);
+    set_value("ord:b", "w", 0);
+    set_value("ord:x", "v", 1);
+    get_or_create_list("ord:list");
+    usleep(5 * 1000);
+
+    epoch_enter();
+    hashtable_scan_prefix("ord:", NULL, 0, ordered_record, &st, NULL);
+    const char *all[] = { "ord:a", "ord:b", "ord:c", "ord:list" };
+    TEST_ASSERT(ordered_is(&st, all, 4), "A prefix scan should return the live keys in byte order");
+
+    char *next = NULL;
+    st.count = 0;
+    hashtable_scan_prefix("ord:", NULL, 2, ordered_record, &st, &next);
+    TEST_ASSERT(ordered_is(&st, all, 2) && next && strcmp(next, "ord:b") == 0,
+                "COUNT should stop the scan and return where it stopped");
+    st.count = 0;
+    hashtable_scan_prefix("ord:", next, 0, ordered_record, &st, NULL);
+    TEST_ASSERT(ordered_is(&st, all + 2, 2), "A scan should resume after the returned key");
+    free(next);
+    epoch_exit();
+
+    delete_key("ord:b");
+    st.count = 0;
+    epoch_enter();
+    hashtable_scan_prefix("ord:", NULL, 0, ordered_record, &st, &next);
+    epoch_exit();
+    const char *after_del[] = { "ord:a", "ord:c", "ord:list" };
+    TEST_ASSERT(ordered_is(&st, after_del, 3) && next == NULL, "A deleted key should leave the index");
+
+    size_t keys, bytes;
+    hashtable_flush(0);
+    hashtable_key_index_stats(&keys, &bytes);
+    TEST_ASSERT(keys == 0 && bytes == 0, "A flush should empty the index");
+    set_value("ord:a", "v", 0);
+    hashtable_key_index_stats(&keys, &bytes);
+    TEST_ASSERT(keys == 1 && bytes > 0, "Keys stored after a flush should be indexed");
+
+    hashtable_set_key_index(0);
+    hashtable_key_index_stats(&keys, &bytes);
+    TEST_ASSERT(!hashtable_key_index_enabled() && keys == 0 && bytes == 0, "Turning the index off should free it");
+    delete_key("ord:a");
+
+    TEST_SUCCESS("Ordered key index test passed");
+}
+
+void test_integer_encoding() {
+    printf("Testing integer-encoded strings...\n");
+
+    set_value("int:small", "42", 0);
+    set_value("int:big", "-9000000000", 0);
+    set_value("int:padded", "007", 0);
+
+    StringValue v;
+    TEST_ASSERT(get_string("int:small", &v) && v.is_int && v.int_value == 42, "Canonical integers should be INT encoded");
+    TEST_ASSERT(get_string("int:padded", &v) && !v.is_int && strcmp(v.ptr, "007") == 0,
+                "Non-canonical numbers should stay strings");
+    TEST_ASSERT(strcmp(get_value("int:small"), "42") == 0, "get_value should render small integers");
+    TEST_ASSERT(strcmp(get_value("int:big"), "-9000000000") == 0, "get_value should render large integers");
+    TEST_ASSERT(strcmp(get_type("int:small"), "string") == 0, "Integers are still strings");
+
+    delete_key("int:small");
+    delete_key("int:big");
+    delete_key("int:padded");
+    TEST_SUCCESS("Integer encoding test passed");
+}
+
+void test_incr_family() {
+    printf("Testing INCR family...\n");
+
+    long long r = 0;
+    TEST_ASSERT(incr_by("ctr", 1, &r) == INCR_OK && r == 1, "INCR on a missing key should start at 0");
+    TEST_ASSERT(incr_by("ctr", 10, &r) == INCR_OK && r == 11, "INCRBY should add");
+    TEST_ASSERT(incr_by("ctr", -12, &r) == INCR_OK && r == -1, "DECRBY should subtract");
+    TEST_ASSERT(strcmp(get_value("ctr"), "-1") == 0, "GET should see the counter");
+
+    set_value("ctr:str", "100", 0);
+    TEST_ASSERT(incr_by("ctr:str", 1, &r) == INCR_OK && r == 101, "INCR should accept integer strings");
+
+    set_value("ctr:max", "9223372036854775807", 0);
+    TEST_ASSERT(incr_by("ctr:max", 1, &r) == INCR_OVERFLOW, "INCR past LLONG_MAX should overflow");
+    TEST_ASSERT(strcmp(get_value("ctr:max"), "9223372036854775807") == 0, "Overflow should leave the value unchanged");
+
+    set_value("ctr:text", "hello", 0);
+    TEST_ASSERT(incr_by("ctr:text", 1, &r) == INCR_NOT_INTEGER, "INCR on text should fail");
+    get_or_create_list("ctr:list");
+    TEST_ASSERT(incr_by("ctr:list", 1, &r) == INCR_WRONGTYPE, "INCR on a list should fail");
+
+    set_value("ctr:ttl", "x5", 1);
+    usleep(5 * 1000);
+    TEST_ASSERT(incr_by("ctr:ttl", 1, &r) == INCR_OK && r == 1, "INCR on an expired key should start at 0");
+
+    char out[LD_STR_SIZE];
+    size_t out_len = 0;
+    TEST_ASSERT(incr_by_float("ctr:f", 10.5L, out, &out_len) == INCR_OK && strcmp(out, "10.5") == 0,
+                "INCRBYFLOAT on a missing key should start at 0");
+    TEST_ASSERT(incr_by_float("ctr:f", 0.5L, out, &out_len) == INCR_OK && strcmp(out, "11") == 0,
+                "INCRBYFLOAT should trim to an integer when exact");
+    StringValue v;
+    TEST_ASSERT(get_string("ctr:f", &v) && v.is_int && v.int_value == 11, "Integral float results become INT encoded");
+    TEST_ASSERT(incr_by_float("ctr:text", 1.0L, out, &out_len) == INCR_NOT_FLOAT, "INCRBYFLOAT on text should fail");
+
+    const char *keys[] = { "ctr", "ctr:str", "ctr:max", "ctr:text", "ctr:list", "ctr:ttl", "ctr:f" };
+    for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); i++) {
+        delete_key(keys[i]);
+    }
+    TEST_SUCCESS("INCR family test passed");
+}
+
+#define INCR_TEST_THREADS 4
+#define INCR_TEST_OPS 10000
+
+static void *incr_worker(void *arg) {
+    (void)arg;
+    long long r;
+    for (int i = 0; i < INCR_TEST_OPS; i++) {
+        incr_by("ctr:race", 1, &r);
+    }
+    return NULL;
+}
+
+void test_incr_atomic() {
+    printf("Testing concurrent INCR...\n");
+
+    pthread_t tids[INCR_TEST_THREADS];
+    for (int i = 0; i < INCR_TEST_THREADS; i++) {
+        pthread_create(&tids[i], NULL, incr_worker, NULL);
+    }
+    for (int i = 0; i < INCR_TEST_THREADS; i++) {
+        pthread_join(tids[i], NULL);
+    }
+
+    StringValue v;
+    TEST_ASSERT(get_string("ctr:race", &v) && v.is_int && v.int_value == INCR_TEST_THREADS * INCR_TEST_OPS,
+                "No increment should be lost");
+    delete_key("ctr:race");
+    TEST_SUCCESS("Concurrent INCR test passed");
+}
+
+#define MULTI_TEST_KEYS 200
+
+void test_multi_key() {
+    printf("Testing MGET/MSET/MSETNX...\n");
+
+    static char key_buf[MULTI_TEST_KEYS][32];
+    static char val_buf[MULTI_TEST_KEYS][32];
+    const char *keys[MULTI_TEST_KEYS + 1];
+    const char *vals[MULTI_TEST_KEYS];
+    for (int i = 0; i < MULTI_TEST_KEYS; i++) {
+        snprintf(key_buf[i], sizeof(key_buf[i]), "multi:%d", i);
+        snprintf(val_buf[i], sizeof(val_buf[i]), i % 2 ? "%d" : "v%d", i);
+        keys[i] = key_buf[i];
+        vals[i] = val_buf[i];
+    }
+    keys[MULTI_TEST_KEYS] = "multi:missing";
+
+    TEST_ASSERT(set_values(keys, vals, MULTI_TEST_KEYS, 0) == 1, "MSET should succeed");
+
+    StringValue out[MULTI_TEST_KEYS + 1];
+    epoch_enter();
+    size_t found = get_strings(keys, MULTI_TEST_KEYS + 1, out);
+    int wrong = 0;
+    for (int i = 0; i < MULTI_TEST_KEYS; i++) {
+        if (i % 2) {
+            wrong += !out[i].is_int || out[i].int_value != i;
+        } else {
+            wrong += !out[i].ptr || strcmp(out[i].ptr, val_buf[i]) != 0;
+        }
+    }
+    epoch_exit();
+    TEST_ASSERT(found == MULTI_TEST_KEYS, "MGET should find every stored key");
+    TEST_ASSERT(wrong == 0, "MGET should return each key's own value in order");
+    TEST_ASSERT(out[MULTI_TEST_KEYS].ptr == NULL && !out[MULTI_TEST_KEYS].is_int, "Missing key should be a miss");
+
+    const char *nx_keys[] = { "multi:new", "multi:0" };
+    const char *nx_vals[] = { "a", "b" };
+    TEST_ASSERT(set_values(nx_keys, nx_vals, 2, 1) == 0, "MSETNX should fail if any key exists");
+    TEST_ASSERT(get_value("multi:new") == NULL, "Failed MSETNX should set nothing");
+    nx_keys[1] = "multi:new2";
+    TEST_ASSERT(set_values(nx_keys, nx_vals, 2, 1) == 1, "MSETNX should succeed when no key exists");
+
+    const char *dup_keys[] = { "multi:dup", "multi:dup" };
+    const char *dup_vals[] = { "first", "second" };
+    set_values(dup_keys, dup_vals, 2, 0);
+    TEST_ASSERT(strcmp(get_value("multi:dup"), "second") == 0, "Later duplicates should win");
+
+    for (int i = 0; i < MULTI_TEST_KEYS; i++) delete_key(keys[i]);
+    delete_key("multi:new");
+    delete_key("multi:new2");
+    delete_key("multi:dup");
+    TEST_SUCCESS("MGET/MSET/MSETNX test passed");
+}
+
+void test_lazy_expiry_reclaims() {
+    printf("Testing lazy expiry on every lookup path...\n");
+
+    unsigned long long before = hashtable_expired_keys();
+    set_value("lazy:type", "v", 1);
+    set_value("lazy:list", "v", 1);
+    set_value("lazy:create", "v", 1);
+    usleep(5 * 1000);
+
+    TEST_ASSERT(strcmp(get_type("lazy:type"), "none") == 0, "TYPE of an expired key should be none");
+    TEST_ASSERT(get_list_if_exists("lazy:list") == NULL, "An expired key should not be a list");
+    TEST_ASSERT(get_or_create_list("lazy:create") != NULL, "An expired string should not block list creation");
+    TEST_ASSERT(strcmp(get_type("lazy:create"), "list") == 0, "The expired string should be replaced by a list");
+    TEST_ASSERT(hashtable_expired_keys() - before == 3, "Each lookup path should reclaim the expired entry");
+
+    delete_key("lazy:create");
+    TEST_SUCCESS("Lazy expiry test passed");
+}
+
+void test_active_expire_cycle() {
+    printf("Testing active expiry cycle...\n");
+
+    char key[32];
+    for (int i = 0; i < 500; i++) {
+        snprintf(key, sizeof(key), "active:ttl:%d", i);
+        set_value(key, "v", 1);
+    }
+    for (int i = 0; i < 50; i++) {
+        snprintf(key, sizeof(key), "active:keep:%d", i);
+        set_value(key, "v", 0);
+    }
+    usleep(5 * 1000);
+
+    size_t reclaimed = 0;
+    for (int cycle = 0; cycle < 100 && reclaimed < 500; cycle++) {
+        reclaimed += expire_cycle(1000000);
+    }
+    TEST_ASSERT(reclaimed >= 500, "Write-once TTL keys should be reclaimed without being read");
+
+    ExpireStats st;
+    expire_get_stats(&st);
+    TEST_ASSERT(st.cycles > 0 && st.active_expired >= 500, "Cycle counters should be updated");
+    TEST_ASSERT(st.stale_perc > 0.0, "A stale keyspace should raise the stale estimate");
+
+    int kept = 0;
+    for (int i = 0; i < 50; i++) {
+        snprintf(key, sizeof(key), "active:keep:%d", i);
+        kept += get_value(key) != NULL;
+        delete_key(key);
+    }
+    TEST_ASSERT(kept == 50, "Keys without a TTL should survive the cycle");
+
+    TEST_ASSERT(expire_start(100) == 0, "The expiry thread should start");
+    expire_stop();
+    TEST_SUCCESS("Active expiry test passed");
+}
+
+void test_wheel_expiry() {
+    printf("Testing deadline expiry through the timing wheels...\n");
+
+    char key[32];
+    for (int i = 0; i < 100; i++) {
+        snprintf(key, sizeof(key), "wheel:%d", i);
+        set_value(key, "v", 20);
+    }
+    set_value("wheel:persist", "v", 20);
+    set_value("wheel:persist", "v", 0);        //- overwrite drops the TTL -//
+    set_value("wheel:deleted", "v", 20);
+    delete_key("wheel:deleted");
+
+    TEST_ASSERT(hashtable_expire_due(current_millis()) == 0, "Nothing should be due before the deadline");
+    usleep(30 * 1000);
+
+    unsigned long long before = hashtable_expired_keys();
+    size_t reclaimed = hashtable_expire_due(current_millis());
+    TEST_ASSERT(reclaimed == 100, "Every key should be reclaimed once its deadline passed");
+    TEST_ASSERT(hashtable_expired_keys() - before == 100, "Wheel reclaims should count as expired keys");
+    TEST_ASSERT(get_value("wheel:persist") != NULL, "A key whose TTL was cleared should stay");
+    TEST_ASSERT(hashtable_expire_due(current_millis()) == 0, "Nothing should be due twice");
+
+    delete_key("wheel:persist");
+    TEST_SUCCESS("Timing wheel expiry test passed");
+}
+
+void test_ttl_family() {
+    printf("Testing TTL commands and compact expiry storage...\n");
+
+    TEST_ASSERT(ENTRY_HEADER_SIZE <= 32, "Entries without a TTL should not carry a deadline");
+
+    set_value("ttl:key", "v", 0);
+    TEST_ASSERT(get_ttl_ms("ttl:key") == -1, "A key without a TTL should report -1");
+    TEST_ASSERT(get_ttl_ms("ttl:missing") == -2, "A missing key should report -2");
+    TEST_ASSERT(set_expiry("ttl:missing", current_millis() + 1000, EXPIRE_ALWAYS) == 0, "EXPIRE on a missing key should fail");
+
+    TEST_ASSERT(set_expiry("ttl:key", current_millis() + 10000, EXPIRE_XX) == 0, "XX should need an existing TTL");
+    TEST_ASSERT(set_expiry("ttl:key", current_millis() + 10000, EXPIRE_GT) == 0, "GT should treat no TTL as infinite");
+    TEST_ASSERT(set_expiry("ttl:key", current_millis() + 10000, EXPIRE_NX) == 1, "NX should set the first TTL");
+    long long ttl = get_ttl_ms("ttl:key");
+    TEST_ASSERT(ttl > 9000 && ttl <= 10000, "PTTL should report the remaining time");
+    TEST_ASSERT(strcmp(get_value("ttl:key"), "v") == 0, "Adding a TTL should keep the value");
+
+    TEST_ASSERT(set_expiry("ttl:key", current_millis() + 5000, EXPIRE_GT) == 0, "GT should refuse an earlier deadline");
+    TEST_ASSERT(set_expiry("ttl:key", current_millis() + 5000, EXPIRE_LT) == 1, "LT should accept an earlier deadline");
+    TEST_ASSERT(get_ttl_ms("ttl:key") <= 5000, "The TTL should move in place");
+
+    TEST_ASSERT(persist_key("ttl:key") == 1, "PERSIST should remove the TTL");
+    TEST_ASSERT(persist_key("ttl:key") == 0, "PERSIST without a TTL should report 0");
+    TEST_ASSERT(get_ttl_ms("ttl:key") == -1 && strcmp(get_value("ttl:key"), "v") == 0, "A persisted key keeps its value");
+
+    //-- Lists can expire too, and keep their elements while the entry is rebuilt --//
+    List *list = get_or_create_list("ttl:list");
+    list_rpush(list, "a");
+    TEST_ASSERT(set_expiry("ttl:list", current_millis() + 20, EXPIRE_ALWAYS) == 1, "EXPIRE should work on lists");
+    list = get_list_if_exists("ttl:list");
+    TEST_ASSERT(list && list_length(list) == 1, "The list should survive gaining a TTL");
+    usleep(30 * 1000);
+    TEST_ASSERT(get_list_if_exists("ttl:list") == NULL && get_ttl_ms("ttl:list") == -2, "An expired list should be gone");
+
+    set_value("ttl:past", "v", 0);
+    TEST_ASSERT(set_expiry("ttl:past", current_millis() - 1, EXPIRE_ALWAYS) == 1, "A past deadline should succeed");
+    TEST_ASSERT(get_value("ttl:past") == NULL, "A past deadline should delete the key");
+
+    set_value("ttl:ctr", "5", 0);
+    set_expiry("ttl:ctr", current_millis() + 10000, EXPIRE_ALWAYS);
+    long long r;
+    incr_by("ttl:ctr", 1, &r);
+    TEST_ASSERT(get_ttl_ms("ttl:ctr") > 9000, "INCR should keep the TTL");
+
+    delete_key("ttl:key");
+    delete_key("ttl:ctr");
+    TEST_SUCCESS("TTL family test passed");
+}
+
+#define LIST_RACE_ROUNDS 200000
+
+static volatile int list_race_done;
+
+//-- Replace the list with a string and delete it, over and over --//
+static void *list_race_deleter(void *arg) {
+    (void)arg;
+    while (!list_race_done) {
+        delete_key("race:list");
+        set_value("race:list", "s", 0);
+        delete_key("race:list");
+    }
+    return NULL;
+}
+
+void test_list_lock_vs_delete() {
+    printf("Testing list pushes racing DEL and SET...\n");
+
+    list_race_done = 0;
+    pthread_t tid;
+    pthread_create(&tid, NULL, list_race_deleter, NULL);
+
+    int orphaned = 0, pushed = 0;
+    for (int i = 0; i < LIST_RACE_ROUNDS; i++) {
+        StripeLock *lock;
+        List *list = lock_list("race:list", 1, &lock);
+        if (list) {
+            list_rpush(list, "v");
+            pushed++;
+            //-- Under the stripe the list must still be the one stored at the key --//
+            orphaned += get_list_if_exists("race:list") != list;
+        }
+        stripe_lock_release(lock);
+    }
+    list_race_done = 1;
+    pthread_join(tid, NULL);
+
+    TEST_ASSERT(pushed > 0, "Some pushes should find or create the list");
+    TEST_ASSERT(orphaned == 0, "A push should never land in a list that was deleted or replaced");
+    delete_key("race:list");
+
+    TEST_SUCCESS("List lock race test passed");
+}
+
 int main() {
     hashtable_lock_init();
     init_test_framework();
@@ -86,7 +667,22 @@ int main() {
     test_basic_set_get();
     test_key_expiry();
     test_key_overwrite();
+    test_embedded_and_raw_values();
     test_nonexistent_key();
+    test_many_keys_per_bucket();
+    test_lock_stripe_stats();
+    test_scan_full_iteration();
+    test_glob_match();
+    test_ordered_key_index();
+    test_integer_encoding();
+    test_incr_family();
+    test_incr_atomic();
+    test_multi_key();
+    test_lazy_expiry_reclaims();
+    test_active_expire_cycle();
+    test_wheel_expiry();
+    test_ttl_family();
+    test_list_lock_vs_delete();
 
     save_test_results();
     return total_tests_failed > 0 ? 1 : 0;
@@ -0,0 +1,187 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_hotkeys.c
+ * Module                    : Hot Key Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit tests for hot-key detection: Space-Saving accuracy on a skewed
+ *  workload, merging per-thread sketches, sampled rate estimates,
+ *  truncated keys, reset and disabling.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include "../src/utils/hotKeys.h"
+#include "test_framework.h"
+
+#define THREADS 4
+#define PER_THREAD 1000
+
+static void record(const char *key) {
+    hotkeys_record(key, strlen(key));
+}
+
+void test_skewed_workload() {
+    printf("Testing that a skewed workload ranks the hot keys first...\n");
+    hotkeys_set_sample_rate(1);
+    hotkeys_reset();
+
+    //-- Far more distinct cold keys than counters, interleaved with the hot ones --//
+    char key[32];
+    for (int i = 0; i < 6000; i++) {
+        snprintf(key, sizeof(key), "cold:%d", i);
+        record(key);
+        if (i % 2 == 0) record("hot:a");
+        if (i % 4 == 0) record("hot:b");
+    }
+
+    HotKey top[3];
+    size_t n = hotkeys_top(top, 3);
+    TEST_ASSERT(n == 3, "Three keys should be reported");
+    TEST_ASSERT(strcmp(top[0].key, "hot:a") == 0 && strcmp(top[1].key, "hot:b") == 0,
+                "The hot keys should come first, hottest first");
+    TEST_ASSERT(top[0].count >= 3000 && top[0].count - top[0].error <= 3000,
+                "The true count should lie within [count - error, count]");
+    TEST_ASSERT(top[1].count >= 1500 && top[1].count - top[1].error <= 1500,
+                "The bound should hold for every key");
+    TEST_ASSERT(top[0].ops_per_sec > top[1].ops_per_sec && top[1].ops_per_sec > top[2].ops_per_sec,
+                "Keys should be ordered by estimated rate");
+
+    TEST_SUCCESS("Skewed workload test passed");
+}
+
+static void *record_thread(void *arg) {
+    char key[32];
+    snprintf(key, sizeof(key), "own:%ld", (long)(intptr_t)arg);
+    for (int i = 0; i < PER_THREAD; i++) {
+        record("shared");
+        if (i % 4 == 0) record(key);
+    }
+    return NULL;
+}
+
+void test_thread_merge() {
+    printf("Testing that per-thread sketches are merged...\n");
+    hotkeys_set_sample_rate(1);
+    hotkeys_reset();
+
+    pthread_t threads[THREADS];
+    for (long t = 0; t < THREADS; t++) pthread_create(&threads[t], NULL, record_thread, (void *)(intptr_t)t);
+    for (int t = 0; t < THREADS; t++) pthread_join(threads[t], NULL);
+
+    HotKey top[THREADS + 1];
+    size_t n = hotkeys_top(top, THREADS + 1);
+    TEST_ASSERT(n == THREADS + 1, "Every key should be reported once");
+    TEST_ASSERT(strcmp(top[0].key, "shared") == 0, "The key every thread used should be the hottest");
+    TEST_ASSERT(top[0].count == THREADS * PER_THREAD && top[0].error == 0,
+                "Counts of the same key should add up across threads");
+
+    HotKeysStats st;
+    hotkeys_stats(&st);
+    TEST_ASSERT(st.sketches >= 2, "Each recording thread should own a sketch");
+
+    TEST_SUCCESS("Thread merge test passed");
+}
+
+void test_sampled_rate() {
+    printf("Testing sampled counts and rate estimates...\n");
+    hotkeys_set_sample_rate(16);
+    hotkeys_reset();
+
+    HotKeysStats before, after;
+    hotkeys_stats(&before);
+    for (int i = 0; i < 16000; i++) record("sampled");
+    hotkeys_stats(&after);
+
+    unsigned long long sampled = after.sampled - before.sampled;
+    TEST_ASSERT(sampled > 700 && sampled < 1300, "About one access in sample_rate should be recorded");
+
+    HotKey top;
+    TEST_ASSERT(hotkeys_top(&top, 1) == 1 && strcmp(top.key, "sampled") == 0, "The sampled key should be reported");
+    //-- All accesses fell within the one-second minimum window --//
+    TEST_ASSERT(top.ops_per_sec > 11000 && top.ops_per_sec < 21000, "The rate should scale samples back up");
+
+    TEST_SUCCESS("Sampled rate test passed");
+}
+
+#define SHORT_THREADS 2000
+
+static void *record_once(void *arg) {
+    (void)arg;
+    record("once");
+    return NULL;
+}
+
+//-- One access per connection thread must be sampled at the same rate as a long-lived thread's --//
+void test_short_lived_threads() {
+    printf("Testing sampling across short-lived threads...\n");
+    hotkeys_set_sample_rate(16);
+    hotkeys_reset();
+
+    HotKeysStats before, after;
+    hotkeys_stats(&before);
+    for (int i = 0; i < SHORT_THREADS; i++) {
+        pthread_t tid;
+        pthread_create(&tid, NULL, record_once, NULL);
+        pthread_join(tid, NULL);
+    }
+    hotkeys_stats(&after);
+
+    unsigned long long sampled = after.sampled - before.sampled;
+    //-- SHORT_THREADS / 16 = 125 expected --//
+    TEST_ASSERT(sampled >= 80 && sampled <= 170, "A thread's first access should not always be sampled");
+
+    TEST_SUCCESS("Short-lived thread test passed");
+}
+
+void test_long_keys_reset_and_disable() {
+    printf("Testing truncated keys, reset and disabling...\n");
+    hotkeys_set_sample_rate(1);
+    hotkeys_reset();
+
+    char key[HOTKEYS_KEY_MAX * 2];
+    memset(key, 'k', sizeof(key) - 1);
+    key[sizeof(key) - 1] = '\0';
+    for (int i = 0; i < 10; i++) record(key);
+    HotKey top;
+    TEST_ASSERT(hotkeys_top(&top, 1) == 1, "A long key should be counted");
+    TEST_ASSERT(strlen(top.key) == HOTKEYS_KEY_MAX && top.len == sizeof(key) - 1,
+                "A long key should be reported truncated with its full length");
+
+    hotkeys_reset();
+    TEST_ASSERT(hotkeys_top(&top, 1) == 0, "A reset should forget every key");
+
+    hotkeys_set_sample_rate(0);
+    HotKeysStats before, after;
+    hotkeys_stats(&before);
+    for (int i = 0; i < 100; i++) record("off");
+    hotkeys_stats(&after);
+    TEST_ASSERT(after.sampled == before.sampled && after.sample_rate == 0, "A rate of 0 should record nothing");
+
+    TEST_SUCCESS("Long key, reset and disable test passed");
+}
+
+int main() {
+    init_test_framework();
+    printf("=== Hot Key Tests ===\n");
+
+    test_skewed_workload();
+    test_thread_merge();
+    test_sampled_rate();
+    test_short_lived_threads();
+    test_long_keys_reset_and_disable();
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_hugepages.c
+ * Module                    : Huge Page Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit tests for the huge page mappings: mode parsing, fixing the mode
+ *  on first use, aligned mappings with their fallback, and accounting
+ *  of large storage allocations.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include "../src/utils/hugePages.h"
+#include "../src/utils/memAlloc.h"
+#include "../src/utils/hashTable.h"
+#include "test_framework.h"
+
+void test_parse_modes() {
+    printf("Testing huge page mode names...\n");
+
+    hugepages_mode_t mode;
+    for (int m = HUGEPAGES_OFF; m <= HUGEPAGES_EXPLICIT; m++) {
+        TEST_ASSERT(hugepages_parse(hugepages_mode_name((hugepages_mode_t)m), &mode) == 0 && mode == (hugepages_mode_t)m,
+                    "Every mode name should parse back to its mode");
+    }
+    TEST_ASSERT(hugepages_parse("THP", &mode) == 0 && mode == HUGEPAGES_THP, "Mode names should be case-insensitive");
+    TEST_ASSERT(hugepages_parse("1gb", &mode) == -1, "Unknown names should be rejected");
+    TEST_ASSERT(hugepages_parse("", &mode) == -1, "An empty name should be rejected");
+
+    TEST_SUCCESS("Mode parsing test passed");
+}
+
+void test_mode_fixed_on_use() {
+    printf("Testing that the mode is fixed once used...\n");
+
+    TEST_ASSERT(hugepages_set_mode(HUGEPAGES_OFF) == 0, "The mode should be settable before first use");
+    TEST_ASSERT(hugepages_set_mode(HUGEPAGES_EXPLICIT) == 0, "The mode should be changeable before first use");
+    TEST_ASSERT(hugepages_mode() == HUGEPAGES_EXPLICIT, "The last mode set should be in effect");
+    TEST_ASSERT(hugepages_set_mode(HUGEPAGES_OFF) == -1, "The mode should be fixed once read");
+    TEST_ASSERT(hugepages_mode() == HUGEPAGES_EXPLICIT, "A rejected change should leave the mode alone");
+
+    TEST_SUCCESS("Fixed mode test passed");
+}
+
+void test_huge_map() {
+    printf("Testing huge page mappings and their fallback...\n");
+
+    HugePagesStats before, during, after;
+    hugepages_stats(&before);
+    size_t len = 2 * HUGE_PAGE_SIZE;
+    char *ptr = huge_map(len);
+    TEST_ASSERT(ptr != NULL, "Explicit mode should map memory even without reserved huge pages");
+    TEST_ASSERT((uintptr_t)ptr % HUGE_PAGE_SIZE == 0, "Mappings should be aligned to a huge page");
+    TEST_ASSERT(ptr[0] == 0 && ptr[len - 1] == 0, "Mappings should start zeroed");
+    memset(ptr, 0x5a, len);
+    TEST_ASSERT(ptr[len - 1] == 0x5a, "The whole mapping should be writable");
+
+    hugepages_stats(&during);
+    TEST_ASSERT(during.mapped - before.mapped == len, "Mapped bytes should be counted");
+    TEST_ASSERT(during.explicit_total > before.explicit_total || during.fallbacks > before.fallbacks,
+                "A mapping should come from the pool or be counted as a fallback");
+
+    huge_unmap(ptr, len);
+    hugepages_stats(&after);
+    TEST_ASSERT(after.mapped == before.mapped, "Unmapped bytes should no longer count");
+
+    TEST_SUCCESS("Huge map test passed");
+}
+
+void test_large_alloc_accounting() {
+    printf("Testing accounting of huge-page storage allocations...\n");
+
+    MemStats before, during, after;
+    HugePagesStats hp_before, hp_during;
+    mem_stats(&before);
+    hugepages_stats(&hp_before);
+
+    size_t size = HUGE_PAGE_SIZE + 100;
+    char *big = mem_alloc(size);
+    TEST_ASSERT(big != NULL, "A large allocation should succeed");
+    memset(big, 1, size);
+    mem_stats(&during);
+    hugepages_stats(&hp_during);
+    TEST_ASSERT(during.requested - before.requested == size, "Requested bytes should be exact");
+#ifndef MEMORA_ALLOC_LIBC
+    TEST_ASSERT(mem_alloc_size(size) == 2 * HUGE_PAGE_SIZE, "Large allocations should round up to whole huge pages");
+    TEST_ASSERT(during.used - before.used == 2 * HUGE_PAGE_SIZE, "Used bytes should include the rounding");
+    TEST_ASSERT((uintptr_t)big % HUGE_PAGE_SIZE == 0, "Large allocations should start on a huge page");
+    TEST_ASSERT(hp_during.mapped - hp_before.mapped >= 2 * HUGE_PAGE_SIZE, "Large allocations should be huge mappings");
+#endif
+
+    mem_free(big, size);
+    mem_stats(&after);
+    TEST_ASSERT(after.used == before.used && after.allocations == before.allocations, "Frees should give every byte back");
+
+    //-- The keyspace still works on huge-page backed memory --//
+    set_value("huge:key", "value", 0);
+    const char *got = get_value("huge:key");
+    TEST_ASSERT(got && strcmp(got, "value") == 0, "Keys should be stored in huge-page regions");
+
+    TEST_SUCCESS("Large allocation accounting test passed");
+}
+
+int main() {
+    init_test_framework();
+    printf("=== Huge Page Tests ===\n");
+
+    test_parse_modes();
+    test_mode_fixed_on_use();
+    hashtable_lock_init();
+    test_huge_map();
+    test_large_alloc_accounting();
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_lazyfree.c
+ * Module                    : Lazy Free Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit tests for the background free thread, UNLINK and flushing the
+ *  keyspace.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "../src/utils/hashTable.h"
+#include "../src/utils/lazyfree.h"
+#include "../src/utils/epoch.h"
+#include "test_framework.h"
+
+//-- Wait (bounded) for the worker to drain what the grace period released --//
+static int drain(void) {
+    epoch_synchronize();
+    for (int i = 0; i < 200 && lazyfree_pending() > 0; i++) {
+        usleep(1000);
+    }
+    return lazyfree_pending() == 0;
+}
+
+static void fill_list(const char *key, int n) {
+    List *list = get_or_create_list(key);
+    char buf[16];
+    for (int i = 0; i < n; i++) {
+        snprintf(buf, sizeof(buf), "%d", i);
+        list_rpush(list, buf);
+    }
+}
+
+void test_inline_without_thread() {
+    printf("Testing lazy free without a running thread...\n");
+
+    unsigned long long before = lazyfree_freed();
+    fill_list("lf:inline", LAZYFREE_THRESHOLD * 2);
+    TEST_ASSERT(unlink_key("lf:inline") == 1, "UNLINK should remove an existing key");
+    TEST_ASSERT(get_list_if_exists("lf:inline") == NULL, "The key should be gone immediately");
+    TEST_ASSERT(lazyfree_pending() == 1, "A big list should be queued for lazy free");
+    TEST_ASSERT(drain(), "Without a thread the epoch reclaimer should free it");
+    TEST_ASSERT(lazyfree_freed() == before + 1, "The free should be counted");
+
+    TEST_SUCCESS("Inline lazy free test passed");
+}
+
+void test_unlink_threshold() {
+    printf("Testing the lazy free size threshold...\n");
+
+    TEST_ASSERT(lazyfree_start() == 0, "The lazyfree thread should start");
+    unsigned long long before = lazyfree_freed();
+
+    set_value("lf:small", "v", 0);
+    fill_list("lf:short", 3);
+    TEST_ASSERT(unlink_key("lf:small") == 1 && unlink_key("lf:short") == 1, "UNLINK should remove small values");
+    TEST_ASSERT(lazyfree_pending() == 0, "Small values should not be queued");
+    TEST_ASSERT(unlink_key("lf:missing") == 0, "UNLINK of a missing key should report 0");
+
+    fill_list("lf:big", LAZYFREE_THRESHOLD * 4);
+    TEST_ASSERT(unlink_key("lf:big") == 1, "UNLINK should remove a big list");
+    TEST_ASSERT(drain(), "The thread should free the big list");
+    TEST_ASSERT(lazyfree_freed() == before + 1, "Only the big list should go through lazy free");
+
+    //-- DEL stays synchronous by default, and follows UNLINK when asked to --//
+    fill_list("lf:del", LAZYFREE_THRESHOLD * 2);
+    TEST_ASSERT(delete_key("lf:del") == 1 && lazyfree_pending() == 0, "DEL should not queue by default");
+    hashtable_set_lazy_user_del(1);
+    fill_list("lf:del", LAZYFREE_THRESHOLD * 2);
+    TEST_ASSERT(delete_key("lf:del") == 1, "Lazy DEL should remove the key");
+    hashtable_set_lazy_user_del(0);
+    TEST_ASSERT(drain() && lazyfree_freed() == before + 2, "Lazy DEL should free big values in the background");
+
+    //-- Overwriting a big list frees it in the background too --//
+    fill_list("lf:over", LAZYFREE_THRESHOLD * 2);
+    set_value("lf:over", "string", 0);
+    TEST_ASSERT(drain() && lazyfree_freed() == before + 3, "An overwritten big list should be freed in the background");
+    delete_key("lf:over");
+
+    TEST_SUCCESS("Threshold test passed");
+}
+
+static void count_key(const Entry *entry, void *ctx) {
+    (void)entry;
+    (*(size_t *)ctx)++;
+}
+
+static size_t count_keys(void) {
+    size_t n = 0;
+    unsigned long cursor = 0;
+    epoch_enter();
+    do {
+        cursor = hashtable_scan(cursor, 1000, count_key, &n);
+    } while (cursor != 0);
+    epoch_exit();
+    return n;
+}
+
+void test_flush() {
+    printf("Testing FLUSHALL SYNC and ASYNC...\n");
+
+    char key[32];
+    for (int pass = 0; pass < 2; pass++) {
+        for (int i = 0; i < 3000; i++) {
+            snprintf(key, sizeof(key), "flush:%d", i);
+            set_value(key, "value", i % 3 == 0 ? current_millis() + 60000 : 0);
+        }
+        fill_list("flush:list", LAZYFREE_THRESHOLD * 2);
+        TEST_ASSERT(count_keys() == 3001, "The keyspace should be filled");
+
+        unsigned long long before = lazyfree_freed();
+        hashtable_flush(pass);
+        TEST_ASSERT(count_keys() == 0, "Flush should empty the keyspace");
+        TEST_ASSERT(get_value("flush:0") == NULL && get_ttl_ms("flush:0") == -2, "Flushed keys should be gone");
+        TEST_ASSERT(hashtable_expire_due(current_millis() + 120000) == 0, "Flush should clear the timing wheels");
+        TEST_ASSERT(drain(), "Everything detached should be freed");
+        if (pass) {
+            TEST_ASSERT(lazyfree_freed() > before, "ASYNC should free through the lazyfree thread");
+        } else {
+            TEST_ASSERT(lazyfree_freed() == before, "SYNC should not use the lazyfree thread");
+        }
+
+        set_value("flush:0", "again", 0);
+        TEST_ASSERT(strcmp(get_value("flush:0"), "again") == 0, "The keyspace should be usable after a flush");
+        delete_key("flush:0");
+    }
+
+    lazyfree_stop();
+    TEST_SUCCESS("Flush test passed");
+}
+
+int main() {
+    hashtable_lock_init();
+    init_test_framework();
+    printf("=== Lazy Free Tests ===\n");
+
+    test_inline_without_thread();
+    test_unlink_threshold();
+    test_flush();
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,240 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_lfmap.c
+ * Module                    : Lock-Free Map Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit and stress tests for the experimental lock-free map: basic
+ *  operations, growth, and concurrent histories that a linearizable
+ *  map must never produce.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "../src/utils/lfMap.h"
+#include "../src/utils/epoch.h"
+#include "test_framework.h"
+
+#define LF_GROWTH_KEYS 50000
+#define LF_THREADS 4
+#define LF_DELETE_KEYS 64
+#define LF_DELETE_ROUNDS 200
+#define LF_REGISTER_WRITES 20000
+
+void test_lfmap_basic() {
+    printf("Testing lock-free map set/get/delete...\n");
+
+    LfMap *map = lfmap_create();
+    TEST_ASSERT(map != NULL, "Map creation should succeed");
+    TEST_ASSERT(lfmap_get(map, "missing") == NULL, "Empty map lookup should miss");
+
+    TEST_ASSERT(lfmap_set(map, "alpha", "1", 0) == 0, "Set should succeed");
+    const char *v = lfmap_get(map, "alpha");
+    TEST_ASSERT(v && strcmp(v, "1") == 0, "Get should return the stored value");
+
+    lfmap_set(map, "alpha", "2", 0);
+    v = lfmap_get(map, "alpha");
+    TEST_ASSERT(v && strcmp(v, "2") == 0, "Overwrite should replace the value");
+    TEST_ASSERT(lfmap_size(map) == 1, "Overwrite should not change the size");
+
+    TEST_ASSERT(lfmap_delete(map, "alpha") == 1, "Delete of present key should return 1");
+    TEST_ASSERT(lfmap_delete(map, "alpha") == 0, "Second delete should return 0");
+    TEST_ASSERT(lfmap_get(map, "alpha") == NULL, "Deleted key should miss");
+
+    lfmap_set(map, "alpha", "3", 0);
+    v = lfmap_get(map, "alpha");
+    TEST_ASSERT(v && strcmp(v, "3") == 0, "Key should be settable again after delete");
+
+    lfmap_set(map, "short", "lived", 1);
+    usleep(5 * 1000);
+    TEST_ASSERT(lfmap_get(map, "short") == NULL, "Expired key should miss");
+    TEST_ASSERT(lfmap_size(map) == 1, "Expired key should no longer count");
+
+    lfmap_free(map);
+    epoch_synchronize();
+    TEST_SUCCESS("Lock-free map basic test passed");
+}
+
+void test_lfmap_growth() {
+    printf("Testing lock-free map growth...\n");
+
+    LfMap *map = lfmap_create();
+    char key[32], value[32];
+    for (int i = 0; i < LF_GROWTH_KEYS; i++) {
+        snprintf(key, sizeof(key), "key:%d", i);
+        snprintf(value, sizeof(value), "v%d", i);
+        lfmap_set(map, key, value, 0);
+    }
+    TEST_ASSERT(map->bucket_count > 2, "Bucket count should have grown");
+    TEST_ASSERT(lfmap_size(map) == LF_GROWTH_KEYS, "Every key should be counted");
+
+    int misses = 0;
+    for (int i = 0; i < LF_GROWTH_KEYS; i++) {
+        snprintf(key, sizeof(key), "key:%d", i);
+        snprintf(value, sizeof(value), "v%d", i);
+        const char *v = lfmap_get(map, key);
+        if (!v || strcmp(v, value) != 0) misses++;
+    }
+    TEST_ASSERT(misses == 0, "Every key should be found after growth");
+
+    for (int i = 0; i < LF_GROWTH_KEYS; i += 2) {
+        snprintf(key, sizeof(key), "key:%d", i);
+        lfmap_delete(map, key);
+    }
+    TEST_ASSERT(lfmap_size(map) == LF_GROWTH_KEYS / 2, "Half the keys should remain");
+
+    lfmap_free(map);
+    epoch_synchronize();
+    TEST_SUCCESS("Lock-free map growth test passed");
+}
+
+/*
+ * Racing deletes: after every key is set, all threads delete all keys at
+ * once. In any linearizable history exactly one DEL per key returns 1.
+ */
+static LfMap *race_map;
+static pthread_barrier_t race_barrier;
+static int delete_wins[LF_DELETE_KEYS];
+
+static void *delete_racer(void *arg) {
+    long id = (long)arg;
+    char key[32];
+    for (int round = 0; round < LF_DELETE_ROUNDS; round++) {
+        if (id == 0) {
+            for (int k = 0; k < LF_DELETE_KEYS; k++) {
+                snprintf(key, sizeof(key), "race:%d", k);
+                lfmap_set(race_map, key, "x", 0);
+            }
+        }
+        pthread_barrier_wait(&race_barrier);
+        for (int k = 0; k < LF_DELETE_KEYS; k++) {
+            int j = (k + (int)id * 17) % LF_DELETE_KEYS;
+            snprintf(key, sizeof(key), "race:%d", j);
+            if (lfmap_delete(race_map, key)) {
+                __atomic_fetch_add(&delete_wins[j], 1, __ATOMIC_RELAXED);
+            }
+        }
+        pthread_barrier_wait(&race_barrier);
+    }
+    return NULL;
+}
+
+void test_lfmap_racing_deletes() {
+    printf("Testing lock-free map racing deletes...\n");
+
+    race_map = lfmap_create();
+    memset(delete_wins, 0, sizeof(delete_wins));
+    pthread_barrier_init(&race_barrier, NULL, LF_THREADS);
+
+    pthread_t tids[LF_THREADS];
+    for (long i = 0; i < LF_THREADS; i++) {
+        pthread_create(&tids[i], NULL, delete_racer, (void *)i);
+    }
+    for (int i = 0; i < LF_THREADS; i++) {
+        pthread_join(tids[i], NULL);
+    }
+
+    int wrong = 0;
+    for (int k = 0; k < LF_DELETE_KEYS; k++) {
+        if (delete_wins[k] != LF_DELETE_ROUNDS) wrong++;
+    }
+    TEST_ASSERT(wrong == 0, "Exactly one delete per key and round should succeed");
+    TEST_ASSERT(lfmap_size(race_map) == 0, "Map should be empty after the last round");
+
+    pthread_barrier_destroy(&race_barrier);
+    lfmap_free(race_map);
+    epoch_synchronize();
+    TEST_SUCCESS("Lock-free map racing deletes test passed");
+}
+
+/*
+ * Single-writer register: one writer stores increasing counters while
+ * another thread deletes and readers watch. A reader must never see a
+ * value older than one it has already seen.
+ */
+static LfMap *reg_map;
+static volatile int reg_done;
+static int reg_regressions;
+
+static void *register_reader(void *arg) {
+    (void)arg;
+    long last = -1;
+    while (!__atomic_load_n(&reg_done, __ATOMIC_ACQUIRE)) {
+        epoch_enter();
+        const char *v = lfmap_get(reg_map, "register");
+        long seen = v ? atol(v) : -1;
+        epoch_exit();
+        if (seen >= 0) {
+            if (seen < last) __atomic_fetch_add(&reg_regressions, 1, __ATOMIC_RELAXED);
+            last = seen;
+        }
+    }
+    return NULL;
+}
+
+static void *register_deleter(void *arg) {
+    (void)arg;
+    while (!__atomic_load_n(&reg_done, __ATOMIC_ACQUIRE)) {
+        lfmap_delete(reg_map, "register");
+        sched_yield();
+    }
+    return NULL;
+}
+
+void test_lfmap_monotonic_reads() {
+    printf("Testing lock-free map monotonic reads...\n");
+
+    reg_map = lfmap_create();
+    reg_done = 0;
+    reg_regressions = 0;
+
+    pthread_t readers[LF_THREADS - 2], deleter;
+    for (int i = 0; i < LF_THREADS - 2; i++) {
+        pthread_create(&readers[i], NULL, register_reader, NULL);
+    }
+    pthread_create(&deleter, NULL, register_deleter, NULL);
+
+    char value[32];
+    for (int i = 0; i < LF_REGISTER_WRITES; i++) {
+        snprintf(value, sizeof(value), "%d", i);
+        lfmap_set(reg_map, "register", value, 0);
+    }
+    __atomic_store_n(&reg_done, 1, __ATOMIC_RELEASE);
+
+    for (int i = 0; i < LF_THREADS - 2; i++) {
+        pthread_join(readers[i], NULL);
+    }
+    pthread_join(deleter, NULL);
+
+    TEST_ASSERT(reg_regressions == 0, "Readers must never observe an older value");
+
+    lfmap_free(reg_map);
+    epoch_synchronize();
+    TEST_SUCCESS("Lock-free map monotonic reads test passed");
+}
+
+int main() {
+    init_test_framework();
+    printf("=== Lock-Free Map Tests ===\n");
+
+    test_lfmap_basic();
+    test_lfmap_growth();
+    test_lfmap_racing_deletes();
+    test_lfmap_monotonic_reads();
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}
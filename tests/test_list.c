@@ -5,8 +5,8 @@
  * 
  * File                      : tests/test_list.c
  * Module                    : List Operations Unit Tests
- * Last Updating Author      : sch0penheimer
- * Last Update               : 2025/31/07
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
  * Version                   : 1.0.0
  *
  * Description:
@@ -74,8 +74,10 @@ void test_lrange_operations() {
     list_rpush(list, "item2");
     list_rpush(list, "item3");
     
+    Arena arena;
+    arena_init(&arena);
     int count;
-    char **result = list_range(list, 0, -1, &count);
+    char **result = list_range(list, 0, -1, &count, &arena);
     
     TEST_ASSERT(result != NULL, "LRANGE should return non-NULL result");
     TEST_ASSERT(count == 3, "LRANGE should return 3 items");
@@ -83,11 +85,8 @@ void test_lrange_operations() {
     TEST_ASSERT(strcmp(result[1], "item2") == 0, "Second item should be item2");
     TEST_ASSERT(strcmp(result[2], "item3") == 0, "Third item should be item3");
     
-    //-- Free result --//
-    for (int i = 0; i < count; i++) {
-        free(result[i]);
-    }
-    free(result);
+    //-- Result and its copies live in the arena --//
+    arena_destroy(&arena);
     list_free(list);
     
     TEST_SUCCESS("LRANGE operations test passed");
@@ -0,0 +1,176 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_memalloc.c
+ * Module                    : Storage Allocator Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit tests for the storage allocation layer: byte accounting across
+ *  threads, large allocations, the keyspace's use of it and per-key
+ *  memory usage.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+#include "../src/utils/memAlloc.h"
+#include "../src/utils/hashTable.h"
+#include "../src/utils/epoch.h"
+#include "test_framework.h"
+
+#define OBJECTS 1000
+
+void test_accounting() {
+    printf("Testing exact byte accounting...\n");
+
+    MemStats before, during, after;
+    mem_stats(&before);
+
+    void *small = mem_alloc(20);
+    void *large = mem_alloc(100000);
+    TEST_ASSERT(small && large, "Allocations should succeed");
+    TEST_ASSERT((uintptr_t)small % 16 == 0 && (uintptr_t)large % 16 == 0, "Storage memory should be 16-byte aligned");
+    memset(large, 1, 100000);
+
+    mem_stats(&during);
+    TEST_ASSERT(during.requested - before.requested == 100020, "Requested bytes should be exact");
+    TEST_ASSERT(during.allocations - before.allocations == 2, "Live allocations should be counted");
+    TEST_ASSERT(during.used - before.used >= 100020, "Used bytes should include rounding");
+#ifndef MEMORA_ALLOC_LIBC
+    TEST_ASSERT(mem_alloc_size(20) == 32, "A 20-byte request should take the 32-byte class");
+    TEST_ASSERT(during.used - before.used >= mem_alloc_size(20) + 100000, "Used bytes should follow the size classes");
+#endif
+
+    mem_free(small, 20);
+    mem_free(large, 100000);
+    mem_stats(&after);
+    TEST_ASSERT(after.used == before.used && after.requested == before.requested, "Frees should give every byte back");
+    TEST_ASSERT(after.allocations == before.allocations, "Freed allocations should no longer count");
+
+    char *s = mem_strdup("hello");
+    TEST_ASSERT(s && strcmp(s, "hello") == 0, "mem_strdup should copy the string");
+    TEST_ASSERT(mem_used() > before.used, "A duplicated string should be accounted");
+    mem_free_str(s);
+    TEST_ASSERT(mem_used() == before.used, "mem_free_str should give its bytes back");
+
+    TEST_SUCCESS("Accounting test passed");
+}
+
+static void *alloc_and_exit(void *arg) {
+    void **objs = arg;
+    for (int i = 0; i < OBJECTS; i++) objs[i] = mem_alloc(40);
+    return NULL;
+}
+
+static void *free_and_exit(void *arg) {
+    void **objs = arg;
+    for (int i = 0; i < OBJECTS; i++) mem_free(objs[i], 40);
+    return NULL;
+}
+
+void test_cross_thread_accounting() {
+    printf("Testing accounting across threads...\n");
+
+    static void *objs[OBJECTS];
+    size_t base = mem_used();
+    pthread_t t;
+    pthread_create(&t, NULL, alloc_and_exit, objs);
+    pthread_join(t, NULL);
+    TEST_ASSERT(mem_used() - base == OBJECTS * mem_alloc_size(40), "An exited thread's allocations should stay counted");
+
+    pthread_create(&t, NULL, free_and_exit, objs);
+    pthread_join(t, NULL);
+    TEST_ASSERT(mem_used() == base, "Frees on another thread should balance the books");
+
+    TEST_SUCCESS("Cross-thread accounting test passed");
+}
+
+void test_keyspace_accounting() {
+    printf("Testing keyspace memory accounting...\n");
+
+    char big[200];
+    memset(big, 'x', sizeof(big) - 1);
+    big[sizeof(big) - 1] = '\0';
+    size_t base = 0;
+    //-- The first round also sizes the index (Swiss arrays stay allocated) --//
+    for (int round = 0; round < 2; round++) {
+        epoch_synchronize();
+        base = mem_used();
+        set_value("mem:small", "v", 0);
+        set_value("mem:big", big, current_millis() + 60000);
+        List *list = get_or_create_list("mem:list");
+        list_rpush(list, "a");
+        list_rpush(list, "b");
+        TEST_ASSERT(mem_used() > base, "Keys should be accounted");
+
+        delete_key("mem:small");
+        delete_key("mem:big");
+        delete_key("mem:list");
+    }
+    epoch_synchronize();
+    TEST_ASSERT(mem_used() == base, "Deleting every key should give all of its bytes back");
+
+    TEST_SUCCESS("Keyspace accounting test passed");
+}
+
+void test_key_memory() {
+    printf("Testing per-key memory usage and the per-type breakdown...\n");
+
+    char big[200];
+    memset(big, 'x', sizeof(big) - 1);
+    big[sizeof(big) - 1] = '\0';
+    size_t base = 0, used = 0;
+    //-- As above, the second round finds the index already sized --//
+    for (int round = 0; round < 2; round++) {
+        delete_key("usage:int");
+        delete_key("usage:big");
+        delete_key("usage:list");
+        epoch_synchronize();
+        base = mem_used();
+        set_value("usage:int", "12345", 0);
+        set_value("usage:big", big, current_millis() + 60000);
+        List *list = get_or_create_list("usage:list");
+        list_rpush(list, "a");
+        list_rpush(list, big);
+        used = mem_used() - base;
+    }
+
+    size_t ints = get_key_memory("usage:int");
+    size_t bigs = get_key_memory("usage:big");
+    size_t lists = get_key_memory("usage:list");
+    TEST_ASSERT(ints > 0 && bigs > sizeof(big) && lists > sizeof(big), "Every key should report its bytes");
+    TEST_ASSERT(get_key_memory("usage:missing") == 0, "A missing key should report 0");
+    TEST_ASSERT(ints + bigs + lists == used, "Per-key usage should add up to the bytes the keys allocated");
+
+    KeyspaceMemory km;
+    hashtable_memory_stats(&km);
+    TEST_ASSERT(km.strings.keys == 2 && km.lists.keys == 1 && km.expires == 1, "Keys should be counted by type");
+    TEST_ASSERT(km.strings.bytes == ints + bigs && km.lists.bytes == lists, "Bytes should be summed by type");
+
+    hashtable_flush(0);
+    epoch_synchronize();
+    TEST_SUCCESS("Key memory test passed");
+}
+
+int main() {
+    hashtable_lock_init();
+    init_test_framework();
+    printf("=== Storage Allocator Tests ===\n");
+
+    test_accounting();
+    test_cross_thread_accounting();
+    test_keyspace_accounting();
+    test_key_memory();
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,109 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_numeric.c
+ * Module                    : Numeric Conversion Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit tests for strict integer/float parsing, integer formatting and
+ *  the shared small-integer table.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <assert.h>
+#include <limits.h>
+#include <string.h>
+#include "../src/utils/numeric.h"
+#include "test_framework.h"
+
+static int parses(const char *s, long long *v) {
+    return string2ll(s, strlen(s), v);
+}
+
+void test_string2ll() {
+    printf("Testing strict integer parsing...\n");
+
+    long long v = 0;
+    TEST_ASSERT(parses("0", &v) && v == 0, "0 should parse");
+    TEST_ASSERT(parses("12345", &v) && v == 12345, "Positive integer should parse");
+    TEST_ASSERT(parses("-42", &v) && v == -42, "Negative integer should parse");
+    TEST_ASSERT(parses("9223372036854775807", &v) && v == LLONG_MAX, "LLONG_MAX should parse");
+    TEST_ASSERT(parses("-9223372036854775808", &v) && v == LLONG_MIN, "LLONG_MIN should parse");
+
+    TEST_ASSERT(!parses("9223372036854775808", &v), "LLONG_MAX + 1 should overflow");
+    TEST_ASSERT(!parses("-9223372036854775809", &v), "LLONG_MIN - 1 should overflow");
+    TEST_ASSERT(!parses("", &v), "Empty string is not an integer");
+    TEST_ASSERT(!parses("-", &v), "Lone sign is not an integer");
+    TEST_ASSERT(!parses("+1", &v), "Leading + is not canonical");
+    TEST_ASSERT(!parses("007", &v), "Leading zeros are not canonical");
+    TEST_ASSERT(!parses("-0", &v), "-0 is not canonical");
+    TEST_ASSERT(!parses(" 1", &v), "Leading space is not canonical");
+    TEST_ASSERT(!parses("1.0", &v), "Decimal point is not an integer");
+
+    TEST_SUCCESS("Strict integer parsing test passed");
+}
+
+void test_ll2str() {
+    printf("Testing integer formatting...\n");
+
+    char buf[LL_STR_SIZE];
+    long long cases[] = { 0, 7, 10, 99, 100, 12345, -1, -100, LLONG_MAX, LLONG_MIN };
+    int mismatches = 0;
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        char expected[LL_STR_SIZE];
+        snprintf(expected, sizeof(expected), "%lld", cases[i]);
+        size_t n = ll2str(buf, cases[i]);
+        if (strcmp(buf, expected) != 0 || n != strlen(expected)) mismatches++;
+    }
+    TEST_ASSERT(mismatches == 0, "ll2str should match printf for every case");
+
+    size_t len = 0;
+    const char *s = shared_integer(4242, &len);
+    TEST_ASSERT(s && strcmp(s, "4242") == 0 && len == 4, "Shared integer should be pre-rendered");
+    TEST_ASSERT(shared_integer(42, NULL) == shared_integer(42, NULL), "Shared integers should be the same object");
+    TEST_ASSERT(shared_integer(SHARED_INTEGERS, NULL) == NULL, "Out-of-range integers are not shared");
+    TEST_ASSERT(shared_integer(-1, NULL) == NULL, "Negative integers are not shared");
+
+    TEST_SUCCESS("Integer formatting test passed");
+}
+
+void test_float_conversions() {
+    printf("Testing float parsing and formatting...\n");
+
+    long double v = 0;
+    TEST_ASSERT(string2ld("3.5", 3, &v) && v == 3.5L, "Decimal should parse");
+    TEST_ASSERT(string2ld("-2e3", 4, &v) && v == -2000.0L, "Exponent should parse");
+    TEST_ASSERT(!string2ld("abc", 3, &v), "Junk should not parse");
+    TEST_ASSERT(!string2ld("inf", 3, &v), "Infinity should be rejected");
+    TEST_ASSERT(!string2ld("nan", 3, &v), "NaN should be rejected");
+    TEST_ASSERT(!string2ld("", 0, &v), "Empty string should not parse");
+
+    char buf[LD_STR_SIZE];
+    ld2str(buf, 10.5L);
+    TEST_ASSERT(strcmp(buf, "10.5") == 0, "Trailing zeros should be trimmed");
+    ld2str(buf, 3.0L);
+    TEST_ASSERT(strcmp(buf, "3") == 0, "Integral floats should print without a point");
+    ld2str(buf, -0.0L);
+    TEST_ASSERT(strcmp(buf, "0") == 0, "Negative zero should print as 0");
+
+    TEST_SUCCESS("Float conversion test passed");
+}
+
+int main() {
+    init_test_framework();
+    printf("=== Numeric Conversion Tests ===\n");
+
+    test_string2ll();
+    test_ll2str();
+    test_float_conversions();
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}
@@ -5,8 +5,8 @@
  * 
  * File                      : tests/test_parser.c
  * Module                    : RESP Parser Unit Tests
- * Last Updating Author      : sch0penheimer
- * Last Update               : 2025/31/07
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
  * Version                   : 1.0.0
  *
  * Description:
@@ -17,8 +17,14 @@
  */
 
 #include <assert.h>
+#include <fcntl.h>
+#include <pthread.h>
 #include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
 #include "../src/parser/parser.h"
+#include "../src/utils/epoch.h"
+#include "../src/utils/hashTable.h"
 #include "test_framework.h"
 
 void test_command_parsing() {
@@ -43,6 +49,23 @@ void test_command_identification() {
     TEST_ASSERT(identify_command("ping") == CMD_PING, "ping lowercase identification failed");
     TEST_ASSERT(identify_command("SET") == CMD_SET, "SET command identification failed");
     TEST_ASSERT(identify_command("GET") == CMD_GET, "GET command identification failed");
+    TEST_ASSERT(identify_command("info") == CMD_INFO, "INFO command identification failed");
+    TEST_ASSERT(identify_command("SCAN") == CMD_SCAN, "SCAN command identification failed");
+    TEST_ASSERT(identify_command("KEYS") == CMD_KEYS, "KEYS command identification failed");
+    TEST_ASSERT(identify_command("incr") == CMD_INCR, "INCR command identification failed");
+    TEST_ASSERT(identify_command("INCRBYFLOAT") == CMD_INCRBYFLOAT, "INCRBYFLOAT command identification failed");
+    TEST_ASSERT(identify_command("mget") == CMD_MGET, "MGET command identification failed");
+    TEST_ASSERT(identify_command("MSETNX") == CMD_MSETNX, "MSETNX command identification failed");
+    TEST_ASSERT(identify_command("expire") == CMD_EXPIRE, "EXPIRE command identification failed");
+    TEST_ASSERT(identify_command("PEXPIREAT") == CMD_PEXPIREAT, "PEXPIREAT command identification failed");
+    TEST_ASSERT(identify_command("PTTL") == CMD_PTTL, "PTTL command identification failed");
+    TEST_ASSERT(identify_command("PERSIST") == CMD_PERSIST, "PERSIST command identification failed");
+    TEST_ASSERT(identify_command("UNLINK") == CMD_UNLINK, "UNLINK command identification failed");
+    TEST_ASSERT(identify_command("flushall") == CMD_FLUSHALL, "FLUSHALL command identification failed");
+    TEST_ASSERT(identify_command("FLUSHDB") == CMD_FLUSHDB, "FLUSHDB command identification failed");
+    TEST_ASSERT(identify_command("STRLEN") == CMD_STRLEN, "STRLEN command identification failed");
+    TEST_ASSERT(identify_command("memory") == CMD_MEMORY, "MEMORY command identification failed");
+    TEST_ASSERT(identify_command("HOTKEYS") == CMD_HOTKEYS, "HOTKEYS command identification failed");
     TEST_ASSERT(identify_command("UNKNOWN") == CMD_UNKNOWN, "Unknown command identification failed");
     
     TEST_SUCCESS("Command identification test passed");
@@ -60,6 +83,132 @@ void test_invalid_resp_format() {
     TEST_SUCCESS("Invalid RESP format test passed");
 }
 
+#define LIST_RACE_ROUNDS 100000
+
+static volatile int list_race_done;
+static int devnull_fd;
+
+//-- Push four elements and pop them again, one at a time and two at once --//
+static void *list_popper(void *arg) {
+    (void)arg;
+    Arena arena;
+    arena_init(&arena);
+    char *push[] = { "RPUSH", "race:list", "a", "b", "c", "d" };
+    char *pop[] = { "LPOP", "race:list" };
+    char *pop_two[] = { "LPOP", "race:list", "2" };
+    for (int i = 0; i < LIST_RACE_ROUNDS; i++) {
+        dispatch_command(devnull_fd, push, 6, &arena);
+        dispatch_command(devnull_fd, pop, 2, &arena);
+        dispatch_command(devnull_fd, pop_two, 3, &arena);
+        dispatch_command(devnull_fd, pop, 2, &arena);
+    }
+    list_race_done = 1;
+    arena_destroy(&arena);
+    return NULL;
+}
+
+void test_list_read_vs_pop() {
+    printf("Testing LRANGE and LLEN racing LPOP...\n");
+
+    devnull_fd = open("/dev/null", O_WRONLY);
+    list_race_done = 0;
+    pthread_t tid;
+    pthread_create(&tid, NULL, list_popper, NULL);
+
+    Arena arena;
+    arena_init(&arena);
+    char *range[] = { "LRANGE", "race:list", "0", "-1" };
+    char *llen[] = { "LLEN", "race:list" };
+    int reads = 0;
+    while (!list_race_done) {
+        dispatch_command(devnull_fd, range, 4, &arena);
+        dispatch_command(devnull_fd, llen, 2, &arena);
+        reads++;
+    }
+    pthread_join(tid, NULL);
+
+    int fds[2];
+    char reply[64] = {0};
+    TEST_ASSERT(pipe(fds) == 0, "Pipe creation failed");
+    dispatch_command(fds[1], llen, 2, &arena);
+    ssize_t n = read(fds[0], reply, sizeof(reply) - 1);
+    TEST_ASSERT(reads > 0, "The reader should run alongside the popper");
+    TEST_ASSERT(n > 0 && strcmp(reply, ":0\r\n") == 0, "Every pushed element should have been popped");
+
+    close(fds[0]);
+    close(fds[1]);
+    close(devnull_fd);
+    arena_destroy(&arena);
+    TEST_SUCCESS("List read/pop race test passed");
+}
+
+#define SLOW_VALUE_SIZE (4 << 20)
+
+typedef struct SlowReply {
+    int fd;
+    volatile int done;
+} SlowReply;
+
+static void *slow_get(void *arg) {
+    SlowReply *r = arg;
+    Arena arena;
+    arena_init(&arena);
+    char *get[] = { "GET", "slow:value" };
+    dispatch_command(r->fd, get, 2, &arena);
+    arena_destroy(&arena);
+    r->done = 1;
+    return NULL;
+}
+
+static void *synchronize(void *arg) {
+    epoch_synchronize();
+    *(volatile int *)arg = 1;
+    return NULL;
+}
+
+//-- A client that stops reading may block its reply, but not the epoch --//
+void test_slow_reader_releases_epoch() {
+    printf("Testing a blocked reply outside the epoch...\n");
+
+    char *value = malloc(SLOW_VALUE_SIZE + 1);
+    memset(value, 'v', SLOW_VALUE_SIZE);
+    value[SLOW_VALUE_SIZE] = '\0';
+    set_value("slow:value", value, 0);
+
+    int sv[2];
+    TEST_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, sv) == 0, "Socketpair creation failed");
+    SlowReply reply = { sv[1], 0 };
+    pthread_t writer;
+    pthread_create(&writer, NULL, slow_get, &reply);
+    usleep(100 * 1000);
+    TEST_ASSERT(!reply.done, "The reply should be blocked on the unread socket");
+
+    volatile int synced = 0;
+    pthread_t syncer;
+    pthread_create(&syncer, NULL, synchronize, (void *)&synced);
+    for (int i = 0; i < 200 && !synced; i++) usleep(10 * 1000);
+    TEST_ASSERT(synced, "A grace period should end while the reply is blocked");
+
+    //-- Drain the socket so the writer can finish --//
+    char buf[65536];
+    size_t total = 0, expected = SLOW_VALUE_SIZE + 12;   //- "$4194304\r\n", the value, CRLF -//
+    while (total < expected) {
+        ssize_t n = read(sv[0], buf, sizeof(buf));
+        if (n <= 0) break;
+        total += (size_t)n;
+    }
+    pthread_join(writer, NULL);
+    pthread_join(syncer, NULL);
+    TEST_ASSERT(total == expected && reply.done, "The whole reply should arrive once the client reads");
+
+    close(sv[0]);
+    close(sv[1]);
+    delete_key("slow:value");
+    epoch_synchronize();
+    free(value);
+    TEST_SUCCESS("Slow reader test passed");
+}
+
 int main() {
     init_test_framework();
     printf("=== RESP Parser Tests ===\n");
@@ -67,6 +216,9 @@ int main() {
     test_command_parsing();
     test_command_identification();
     test_invalid_resp_format();
+    hashtable_lock_init();
+    test_list_read_vs_pop();
+    test_slow_reader_releases_epoch();
     
     save_test_results();
     return total_tests_failed > 0 ? 1 : 0;
@@ -5,8 +5,8 @@
  * 
  * File                      : tests/test_ping_echo.c
  * Module                    : Client-Server Socket Communication Tests
- * Last Updating Author      : sch0penheimer
- * Last Update               : 2025/31/07
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
  * Version                   : 1.0.0
  * 
  * Description:
@@ -24,6 +24,7 @@
 #include <unistd.h>
 #include <sys/socket.h>
 #include <pthread.h>
+#include "../src/utils/arena.h"
 #include "test_framework.h"
 
 #define BUFFER_SIZE 1024
@@ -31,7 +32,7 @@
 
 extern void* handle_client(void*);
 extern int parse_command(char *input, char *tokens[], int max_tokens);
-extern void dispatch_command(int client_fd, char *tokens[], int token_count);
+extern void dispatch_command(int client_fd, char *tokens[], int token_count, Arena *arena);
 
 void test_ping_echo() {
     printf("Testing PING and ECHO commands via socketpair...\n");
@@ -0,0 +1,183 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_reply.c
+ * Module                    : Reply Encoder Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit tests for the RESP reply encoder: shared and formatted headers
+ *  on both sides of the table limits, constant replies, bulk and array
+ *  replies, and deferred output, all read back from a pipe.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include "../src/parser/reply.h"
+#include "test_framework.h"
+
+static int fds[2];
+
+//-- Everything written to the pipe so far, NUL-terminated --//
+static const char *drain(size_t *len) {
+    static char buf[1 << 16];
+    ssize_t n = read(fds[0], buf, sizeof(buf) - 1);
+    *len = n > 0 ? (size_t)n : 0;
+    buf[*len] = '\0';
+    return buf;
+}
+
+static int header_is(char type, long long v, const char *expected) {
+    char buf[REPLY_HEADER_SIZE];
+    size_t n = resp_encode_header(buf, type, v);
+    return n == strlen(expected) && memcmp(buf, expected, n) == 0;
+}
+
+void test_headers() {
+    printf("Testing shared and formatted headers...\n");
+
+    TEST_ASSERT(header_is(':', 0, ":0\r\n") && header_is(':', 42, ":42\r\n"), "Small integers should be encoded");
+    TEST_ASSERT(header_is(':', SHARED_INTEGERS - 1, ":9999\r\n") && header_is(':', SHARED_INTEGERS, ":10000\r\n"),
+                "Integers on both sides of the shared table should be encoded");
+    TEST_ASSERT(header_is(':', -2, ":-2\r\n") && header_is(':', LLONG_MIN, ":-9223372036854775808\r\n"),
+                "Negative integers should be encoded");
+    TEST_ASSERT(header_is('$', REPLY_SHARED_HEADERS - 1, "$1023\r\n") && header_is('$', REPLY_SHARED_HEADERS, "$1024\r\n"),
+                "Bulk headers on both sides of the shared table should be encoded");
+    TEST_ASSERT(header_is('$', -1, "$-1\r\n") && header_is('*', 3, "*3\r\n"), "Null bulk and array headers should be encoded");
+
+    size_t len;
+    const char *shared = resp_shared_header(':', 7, &len);
+    TEST_ASSERT(shared && len == 4 && memcmp(shared, ":7\r\n", 4) == 0, "Small integers should have a shared encoding");
+    TEST_ASSERT(resp_shared_header(':', 7, NULL) == shared, "The shared encoding should be the same every time");
+    TEST_ASSERT(!resp_shared_header(':', -1, NULL) && !resp_shared_header('$', REPLY_SHARED_HEADERS, NULL)
+                && !resp_shared_header('+', 1, NULL), "Values outside the tables should have no shared encoding");
+
+    char buf[64];
+    len = resp_encode_bulk(buf, "hello", 5);
+    TEST_ASSERT(len == 11 && memcmp(buf, "$5\r\nhello\r\n", len) == 0, "A bulk string should be encoded");
+    len = resp_encode_bulk(buf, "", 0);
+    TEST_ASSERT(len == 6 && memcmp(buf, "$0\r\n\r\n", len) == 0, "An empty bulk string should be encoded");
+
+    TEST_SUCCESS("Header test passed");
+}
+
+void test_simple_replies() {
+    printf("Testing constant, status and integer replies...\n");
+    size_t len;
+
+    reply_shared(fds[1], REPLY_OK);
+    reply_shared(fds[1], REPLY_PONG);
+    reply_shared(fds[1], REPLY_NULL_BULK);
+    reply_shared(fds[1], REPLY_EMPTY_ARRAY);
+    reply_shared(fds[1], REPLY_ZERO);
+    reply_shared(fds[1], REPLY_ONE);
+    TEST_ASSERT(strcmp(drain(&len), "+OK\r\n+PONG\r\n$-1\r\n*0\r\n:0\r\n:1\r\n") == 0,
+                "Constant replies should be sent as-is");
+
+    reply_status(fds[1], "string");
+    reply_integer(fds[1], 12);
+    reply_integer(fds[1], -1);
+    reply_integer(fds[1], 123456789012LL);
+    TEST_ASSERT(strcmp(drain(&len), "+string\r\n:12\r\n:-1\r\n:123456789012\r\n") == 0,
+                "Status and integer replies should be encoded");
+
+    TEST_SUCCESS("Simple reply test passed");
+}
+
+void test_bulk_replies() {
+    printf("Testing bulk and array replies...\n");
+    size_t len;
+
+    reply_bulk(fds[1], "value", 5);
+    reply_bulk_integer(fds[1], 77);
+    reply_bulk_integer(fds[1], -123456);
+    TEST_ASSERT(strcmp(drain(&len), "$5\r\nvalue\r\n$2\r\n77\r\n$7\r\n-123456\r\n") == 0,
+                "Short bulk replies should be encoded");
+
+    //-- Past REPLY_INLINE_MAX the value is written from where it lives --//
+    size_t big = REPLY_INLINE_MAX * 4;
+    char *value = malloc(big);
+    memset(value, 'v', big);
+    reply_bulk(fds[1], value, big);
+    const char *out = drain(&len);
+    char header[16];
+    int header_len = snprintf(header, sizeof(header), "$%zu\r\n", big);
+    TEST_ASSERT(len == (size_t)header_len + big + 2 && memcmp(out, header, header_len) == 0
+                && memcmp(out + header_len, value, big) == 0 && memcmp(out + len - 2, "\r\n", 2) == 0,
+                "A long bulk reply should arrive whole");
+    free(value);
+
+    Arena arena;
+    arena_init(&arena);
+    char *items[] = { "a", "", "three" };
+    reply_bulk_array(fds[1], items, 3, &arena);
+    reply_bulk_array(fds[1], items, 0, &arena);
+    TEST_ASSERT(strcmp(drain(&len), "*3\r\n$1\r\na\r\n$0\r\n\r\n$5\r\nthree\r\n*0\r\n") == 0,
+                "Array replies should be encoded in one piece");
+    arena_destroy(&arena);
+
+    TEST_SUCCESS("Bulk reply test passed");
+}
+
+void test_deferred_replies() {
+    printf("Testing deferred replies...\n");
+    size_t len;
+
+    size_t big = REPLY_INLINE_MAX * 4;
+    char *value = malloc(big + 1);
+    memset(value, 'v', big);
+    value[big] = '\0';
+
+    reply_defer_begin();
+    reply_shared(fds[1], REPLY_OK);
+    reply_integer(fds[1], 12345678);
+    reply_printf(fds[1], "-ERR %s\r\n", "bad");
+    reply_bulk(fds[1], value, big);
+    int queued = -1;
+    ioctl(fds[0], FIONREAD, &queued);
+    TEST_ASSERT(queued == 0, "Deferred replies should not reach the socket before the flush");
+
+    reply_defer_flush(fds[1]);
+    const char *out = drain(&len);
+    const char *head = "+OK\r\n:12345678\r\n-ERR bad\r\n$2048\r\n";
+    size_t head_len = strlen(head);
+    TEST_ASSERT(len == head_len + big + 2 && memcmp(out, head, head_len) == 0
+                && memcmp(out + head_len, value, big) == 0 && memcmp(out + len - 2, "\r\n", 2) == 0,
+                "A flush should send every deferred reply in order");
+
+    reply_shared(fds[1], REPLY_PONG);
+    TEST_ASSERT(strcmp(drain(&len), "+PONG\r\n") == 0, "Replies after a flush should be written directly");
+    free(value);
+
+    TEST_SUCCESS("Deferred reply test passed");
+}
+
+int main() {
+    init_test_framework();
+    printf("=== Reply Encoder Tests ===\n");
+
+    if (pipe(fds) != 0) {
+        perror("pipe");
+        return 1;
+    }
+    test_headers();
+    test_simple_replies();
+    test_bulk_replies();
+    test_deferred_replies();
+    close(fds[0]);
+    close(fds[1]);
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,140 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_slab.c
+ * Module                    : Slab Allocator Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit tests for the slab pools: size classes, object reuse,
+ *  cross-thread frees and the usage counters.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+#include "../src/utils/slab.h"
+#include "../src/utils/list.h"
+#include "test_framework.h"
+
+#define OBJECTS 1000
+
+static int node_class(void) {
+    return slab_class_for(sizeof(ListNode));
+}
+
+void test_size_classes() {
+    printf("Testing slab size classes and alignment...\n");
+
+    TEST_ASSERT(slab_class_for(0) == -1 && slab_class_for(SLAB_MAX_SIZE + 1) == -1, "Sizes outside the classes should be refused");
+    int prev = -1, monotonic = 1, fits = 1;
+    for (size_t size = 1; size <= SLAB_MAX_SIZE; size++) {
+        int cls = slab_class_for(size);
+        if (cls < prev) monotonic = 0;
+        if (cls < 0 || slab_class_size(cls) < size) fits = 0;
+        if (cls > 0 && slab_class_size(cls - 1) >= size) fits = 0;
+        prev = cls;
+    }
+    TEST_ASSERT(fits, "Every size should map to the smallest class that holds it");
+    TEST_ASSERT(monotonic && prev == SLAB_CLASS_COUNT - 1, "Classes should grow with the size up to the last one");
+    TEST_ASSERT(slab_class_size(node_class()) == 16, "List nodes should pack four to a cache line");
+
+    int cls = slab_class_for(64);
+    void *a = slab_alloc(cls);
+    TEST_ASSERT(a && (uintptr_t)a % 64 == 0, "64-byte objects should be line-aligned");
+    memset(a, 0xab, 64);
+    slab_free(cls, a);
+    TEST_ASSERT(slab_alloc(cls) == a, "The last freed object should be reused first");
+    slab_free(cls, a);
+
+    TEST_SUCCESS("Size class test passed");
+}
+
+void test_counters() {
+    printf("Testing slab usage counters...\n");
+
+    static void *objs[OBJECTS];
+    int cls = node_class();
+    slab_thread_flush();
+    SlabStats before, during, after;
+    slab_stats(cls, &before);
+
+    int failed = 0;
+    for (int i = 0; i < OBJECTS; i++) {
+        objs[i] = slab_alloc(cls);
+        failed += objs[i] == NULL;
+    }
+    TEST_ASSERT(failed == 0, "Allocations should succeed");
+    slab_thread_flush();
+    slab_stats(cls, &during);
+    TEST_ASSERT(during.allocs - before.allocs == OBJECTS, "Allocations should be counted");
+    TEST_ASSERT(during.objects_in_use == before.objects_in_use + OBJECTS, "Objects in use should grow");
+    TEST_ASSERT(during.objects_total >= during.objects_in_use, "Carved objects should cover those in use");
+    TEST_ASSERT(during.chunks * SLAB_CHUNK_SIZE >= during.objects_total * during.object_size, "Objects should fit their chunks");
+
+    for (int i = 0; i < OBJECTS; i++) slab_free(cls, objs[i]);
+    slab_thread_flush();
+    slab_stats(cls, &after);
+    TEST_ASSERT(after.objects_in_use == before.objects_in_use, "Freed objects should no longer be in use");
+
+    //-- Reallocating reuses freed objects instead of carving new chunks --//
+    for (int i = 0; i < OBJECTS; i++) objs[i] = slab_alloc(cls);
+    for (int i = 0; i < OBJECTS; i++) slab_free(cls, objs[i]);
+    SlabStats again;
+    slab_stats(cls, &again);
+    TEST_ASSERT(again.chunks == after.chunks, "Reuse should not reserve new chunks");
+
+    TEST_SUCCESS("Counter test passed");
+}
+
+static void *free_all(void *arg) {
+    void **objs = arg;
+    for (int i = 0; i < OBJECTS; i++) slab_free(node_class(), objs[i]);
+    return NULL;
+}
+
+void test_cross_thread_free() {
+    printf("Testing frees from another thread...\n");
+
+    static void *objs[OBJECTS];
+    int cls = node_class();
+    slab_thread_flush();
+    SlabStats before, after;
+    slab_stats(cls, &before);
+    for (int i = 0; i < OBJECTS; i++) objs[i] = slab_alloc(cls);
+
+    pthread_t t;
+    pthread_create(&t, NULL, free_all, objs);
+    pthread_join(t, NULL);
+    slab_thread_flush();
+
+    slab_stats(cls, &after);
+    TEST_ASSERT(after.objects_in_use == before.objects_in_use, "An exiting thread should publish its frees");
+    for (int i = 0; i < OBJECTS; i++) objs[i] = slab_alloc(cls);
+    SlabStats again;
+    slab_stats(cls, &again);
+    TEST_ASSERT(again.chunks == after.chunks, "Objects freed by an exited thread should be reusable");
+    for (int i = 0; i < OBJECTS; i++) slab_free(cls, objs[i]);
+
+    TEST_SUCCESS("Cross-thread free test passed");
+}
+
+int main() {
+    init_test_framework();
+    printf("=== Slab Allocator Tests ===\n");
+
+    test_size_classes();
+    test_counters();
+    test_cross_thread_free();
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}
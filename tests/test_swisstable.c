@@ -0,0 +1,215 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_swisstable.c
+ * Module                    : Swiss Table Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/19/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit tests for the open-addressing Swiss table index: lookup,
+ *  growth, removal, tombstone handling and probe spread.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <assert.h>
+#include <string.h>
+#include "../src/utils/hashTable.h"
+#include "test_framework.h"
+
+#define SWISS_TEST_KEYS 5000
+
+static Entry *make_entry(const char *key) {
+    size_t len = strlen(key);
+    Entry *e = calloc(1, ENTRY_HEADER_SIZE + len + 1);
+    memcpy(e->key, key, len + 1);
+    e->key_len = len;
+    e->hash = hash_key(key, len);
+    return e;
+}
+
+static void free_entry(Entry *e) {
+    free(e);
+}
+
+static uint64_t key_hash(const char *key) {
+    return hash_key(key, strlen(key));
+}
+
+void test_swiss_insert_find() {
+    printf("Testing Swiss table insert/find...\n");
+
+    SwissTable t = {0};
+    TEST_ASSERT(swiss_find(&t, "missing", 7, key_hash("missing")) == NULL, "Empty table lookup should miss");
+
+    Entry *a = make_entry("alpha");
+    Entry *b = make_entry("beta");
+    TEST_ASSERT(swiss_insert(&t, a, key_hash("alpha")) == 0, "Insert alpha should succeed");
+    TEST_ASSERT(swiss_insert(&t, b, key_hash("beta")) == 0, "Insert beta should succeed");
+
+    TEST_ASSERT(swiss_find(&t, "alpha", 5, key_hash("alpha")) == a, "Lookup should return alpha entry");
+    TEST_ASSERT(swiss_find(&t, "beta", 4, key_hash("beta")) == b, "Lookup should return beta entry");
+    TEST_ASSERT(swiss_find(&t, "gamma", 5, key_hash("gamma")) == NULL, "Lookup of absent key should miss");
+    TEST_ASSERT(t.size == 2, "Table size should be 2");
+
+    swiss_free(&t);
+    free_entry(a);
+    free_entry(b);
+    TEST_SUCCESS("Swiss table insert/find test passed");
+}
+
+void test_swiss_growth() {
+    printf("Testing Swiss table growth...\n");
+
+    SwissTable t = {0};
+    Entry **entries = malloc(sizeof(Entry *) * SWISS_TEST_KEYS);
+    char key[32];
+
+    for (int i = 0; i < SWISS_TEST_KEYS; i++) {
+        snprintf(key, sizeof(key), "key:%d", i);
+        entries[i] = make_entry(key);
+        swiss_insert(&t, entries[i], key_hash(key));
+    }
+
+    int found = 0;
+    for (int i = 0; i < SWISS_TEST_KEYS; i++) {
+        snprintf(key, sizeof(key), "key:%d", i);
+        found += swiss_find(&t, key, strlen(key), key_hash(key)) == entries[i];
+    }
+
+    TEST_ASSERT(found == SWISS_TEST_KEYS, "Every key should be found after growth");
+    TEST_ASSERT(t.size == SWISS_TEST_KEYS, "Size should match number of inserts");
+    TEST_ASSERT(t.size * 8 <= swiss_capacity(&t) * 7, "Load factor should stay at or below 7/8");
+
+    swiss_free(&t);
+    for (int i = 0; i < SWISS_TEST_KEYS; i++) {
+        free_entry(entries[i]);
+    }
+    free(entries);
+    TEST_SUCCESS("Swiss table growth test passed");
+}
+
+void test_swiss_remove() {
+    printf("Testing Swiss table removal and tombstones...\n");
+
+    SwissTable t = {0};
+    Entry **entries = malloc(sizeof(Entry *) * SWISS_TEST_KEYS);
+    char key[32];
+
+    for (int i = 0; i < SWISS_TEST_KEYS; i++) {
+        snprintf(key, sizeof(key), "key:%d", i);
+        entries[i] = make_entry(key);
+        swiss_insert(&t, entries[i], key_hash(key));
+    }
+
+    //-- Remove every even key --//
+    int removed = 0;
+    for (int i = 0; i < SWISS_TEST_KEYS; i += 2) {
+        removed += swiss_remove(&t, entries[i], key_hash(entries[i]->key));
+    }
+    TEST_ASSERT(removed == SWISS_TEST_KEYS / 2, "Every even key should be removed");
+    TEST_ASSERT(swiss_remove(&t, entries[0], key_hash(entries[0]->key)) == 0, "Second removal should report not found");
+
+    int ok = 1;
+    for (int i = 0; i < SWISS_TEST_KEYS; i++) {
+        Entry *e = swiss_find(&t, entries[i]->key, entries[i]->key_len, entries[i]->hash);
+        if ((i % 2 == 0 && e != NULL) || (i % 2 == 1 && e != entries[i])) ok = 0;
+    }
+    TEST_ASSERT(ok, "Odd keys should survive and even keys should be gone");
+
+    //-- Reinsert the removed keys; tombstones must be reused or purged --//
+    for (int i = 0; i < SWISS_TEST_KEYS; i += 2) {
+        swiss_insert(&t, entries[i], key_hash(entries[i]->key));
+    }
+    TEST_ASSERT(t.size == SWISS_TEST_KEYS, "Size should be restored after reinsert");
+    TEST_ASSERT(swiss_find(&t, entries[0]->key, entries[0]->key_len, entries[0]->hash) == entries[0], "Reinserted key should be found");
+
+    swiss_free(&t);
+    for (int i = 0; i < SWISS_TEST_KEYS; i++) {
+        free_entry(entries[i]);
+    }
+    free(entries);
+    TEST_SUCCESS("Swiss table removal test passed");
+}
+
+void test_swiss_replace() {
+    printf("Testing Swiss table slot replacement...\n");
+
+    SwissTable t = {0};
+    Entry *old = make_entry("session");
+    Entry *fresh = make_entry("session");
+    swiss_insert(&t, old, old->hash);
+
+    TEST_ASSERT(swiss_replace(&t, old, fresh, old->hash) == 1, "Replace should find the linked entry");
+    TEST_ASSERT(swiss_find(&t, "session", 7, old->hash) == fresh, "Lookup should return the new entry");
+    TEST_ASSERT(swiss_replace(&t, old, fresh, old->hash) == 0, "Replacing an unlinked entry should fail");
+    TEST_ASSERT(t.size == 1, "Replace should not change the size");
+
+    swiss_free(&t);
+    free_entry(old);
+    free_entry(fresh);
+    TEST_SUCCESS("Swiss table replace test passed");
+}
+
+#define SPREAD_KEYS 1000
+
+//-- Keys of one outer bucket must still start their probes all over the table --//
+void test_swiss_probe_spread() {
+    printf("Testing probe start spread within one bucket...\n");
+
+    SwissTable t = {0};
+    Entry **entries = malloc(sizeof(Entry *) * SPREAD_KEYS);
+    char key[32];
+    int n = 0;
+    for (int i = 0; n < SPREAD_KEYS; i++) {
+        snprintf(key, sizeof(key), "key:%d", i);
+        if (key_hash(key) % TABLE_SIZE != 0) continue;
+        entries[n] = make_entry(key);
+        swiss_insert(&t, entries[n], entries[n]->hash);
+        n++;
+    }
+
+    size_t groups = swiss_capacity(&t) / SWISS_GROUP_WIDTH;
+    char *started = calloc(groups, 1);
+    size_t distinct = 0, displaced = 0;
+    for (int i = 0; i < SPREAD_KEYS; i++) {
+        size_t g = (size_t)(entries[i]->hash >> SWISS_H1_SHIFT) & (groups - 1);
+        if (!started[g]) distinct++;
+        started[g] = 1;
+        for (size_t slot = 0; slot < swiss_capacity(&t); slot++) {
+            if (t.arr->slots[slot] == entries[i]) {
+                displaced += slot / SWISS_GROUP_WIDTH != g;
+                break;
+            }
+        }
+    }
+    TEST_ASSERT(distinct * 10 >= groups * 9, "Probes should start in nearly every group");
+    TEST_ASSERT(displaced * 10 <= SPREAD_KEYS, "Few entries should land outside their starting group");
+
+    swiss_free(&t);
+    for (int i = 0; i < SPREAD_KEYS; i++) {
+        free_entry(entries[i]);
+    }
+    free(entries);
+    free(started);
+    TEST_SUCCESS("Swiss table probe spread test passed");
+}
+
+int main() {
+    init_test_framework();
+    printf("=== Swiss Table Tests ===\n");
+
+    test_swiss_insert_find();
+    test_swiss_growth();
+    test_swiss_remove();
+    test_swiss_replace();
+    test_swiss_probe_spread();
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}
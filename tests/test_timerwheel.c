@@ -0,0 +1,137 @@
+/**
+ * =====================================================
+ * MemoraDB - In-Memory Database System
+ * =====================================================
+ *
+ * File                      : tests/test_timerwheel.c
+ * Module                    : Timing Wheel Unit Tests
+ * Last Updating Author      : agent
+ * Last Update               : 10/18/2026
+ * Version                   : 1.0.0
+ *
+ * Description:
+ *  Unit tests for the hierarchical timing wheel: exact firing ticks on
+ *  every level, removal, rescheduling and deadlines beyond the range.
+ *
+ * Copyright (c) 2025 MemoraDB Project
+ * =====================================================
+ */
+
+#include <assert.h>
+#include <string.h>
+#include "../src/utils/timerWheel.h"
+#include "test_framework.h"
+
+typedef struct Timer {
+    WheelNode node;
+    long long fired_at;     //- wheel time when fired, 0 = not yet -//
+} Timer;
+
+typedef struct FireLog {
+    TimerWheel *wheel;
+    size_t fired;
+} FireLog;
+
+static void record_fire(WheelNode *node, void *ctx) {
+    FireLog *log = ctx;
+    Timer *t = (Timer *)node;
+    t->fired_at = log->wheel->now;
+    log->fired++;
+}
+
+//-- Advance one ms at a time so fired_at is the exact tick --//
+static void step_to(TimerWheel *w, long long target, FireLog *log) {
+    for (long long t = w->now + 1; t <= target; t++) {
+        wheel_advance(w, t, record_fire, log);
+    }
+}
+
+void test_exact_deadlines() {
+    printf("Testing firing at the exact tick on every level...\n");
+
+    TimerWheel w;
+    wheel_init(&w, 1000);
+    FireLog log = { &w, 0 };
+    long long offsets[] = { 1, 5, 63, 64, 65, 200, 4095, 4096, 4097, 70000, 300000 };
+    size_t n = sizeof(offsets) / sizeof(offsets[0]);
+    Timer timers[sizeof(offsets) / sizeof(offsets[0])];
+    memset(timers, 0, sizeof(timers));
+    for (size_t i = 0; i < n; i++) {
+        wheel_add(&w, &timers[i].node, 1000 + offsets[i]);
+    }
+    TEST_ASSERT(w.count == n, "Every timer should be scheduled");
+
+    step_to(&w, 1000 + 300000, &log);
+    int exact = 0;
+    for (size_t i = 0; i < n; i++) {
+        exact += timers[i].fired_at == 1000 + offsets[i];
+    }
+    TEST_ASSERT(exact == (int)n, "Each timer should fire exactly at its deadline");
+    TEST_ASSERT(log.fired == n && w.count == 0, "The wheel should be empty afterwards");
+
+    TEST_SUCCESS("Exact deadline test passed");
+}
+
+void test_remove_and_update() {
+    printf("Testing removal and rescheduling...\n");
+
+    TimerWheel w;
+    wheel_init(&w, 0);
+    FireLog log = { &w, 0 };
+    Timer a = {0}, b = {0}, c = {0};
+    wheel_add(&w, &a.node, 100);
+    wheel_add(&w, &b.node, 100);
+    wheel_add(&w, &c.node, 5000);
+
+    wheel_remove(&w, &a.node);
+    TEST_ASSERT(!wheel_scheduled(&a.node) && w.count == 2, "Removed timer should be unscheduled");
+    wheel_remove(&w, &a.node);
+    TEST_ASSERT(w.count == 2, "Removing twice should be harmless");
+
+    wheel_update(&w, &c.node, 50);
+    wheel_update(&w, &b.node, 7000);
+    step_to(&w, 7000, &log);
+    TEST_ASSERT(a.fired_at == 0, "Removed timer should never fire");
+    TEST_ASSERT(c.fired_at == 50, "Timer moved earlier should fire at its new deadline");
+    TEST_ASSERT(b.fired_at == 7000, "Timer moved later should fire at its new deadline");
+
+    TEST_SUCCESS("Remove and update test passed");
+}
+
+void test_late_and_far_deadlines() {
+    printf("Testing past and out-of-range deadlines...\n");
+
+    TimerWheel w;
+    wheel_init(&w, 10000);
+    FireLog log = { &w, 0 };
+    Timer past = {0}, far = {0};
+    wheel_add(&w, &past.node, 10);
+    long long far_deadline = 10000 + (1LL << 25) + 123;   //- twice the wheel range -//
+    wheel_add(&w, &far.node, far_deadline);
+
+    wheel_advance(&w, 10001, record_fire, &log);
+    TEST_ASSERT(past.fired_at == 10001, "A deadline in the past should fire on the next tick");
+
+    //-- Large jumps are processed tick by tick, so the far timer still fires on time --//
+    wheel_advance(&w, far_deadline - 1, record_fire, &log);
+    TEST_ASSERT(far.fired_at == 0, "Far timer should not fire early");
+    wheel_advance(&w, far_deadline, record_fire, &log);
+    TEST_ASSERT(far.fired_at == far_deadline, "Far timer should fire at its deadline");
+
+    TEST_ASSERT(wheel_advance(&w, far_deadline + 100000, record_fire, &log) == 0 && w.now == far_deadline + 100000,
+                "An empty wheel should jump straight to now");
+
+    TEST_SUCCESS("Past and far deadline test passed");
+}
+
+int main() {
+    init_test_framework();
+    printf("=== Timing Wheel Tests ===\n");
+
+    test_exact_deadlines();
+    test_remove_and_update();
+    test_late_and_far_deadlines();
+
+    save_test_results();
+    return total_tests_failed > 0 ? 1 : 0;
+}